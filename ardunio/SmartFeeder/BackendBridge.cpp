@@ -0,0 +1,166 @@
+#define LOG_MODULE LOG_MOD_BACKEND
+#include "BackendBridge.h"
+#include "Metrics.h"
+
+BackendBridge::BackendBridge(BackendClient* bc, ProvisionManager* pm, OfflineScheduler* sched,
+                             TimeManager* tm, ServoController* servo, FeedTracer* tracer)
+  : backend(bc)
+  , provisioning(pm)
+  , scheduler(sched)
+  , timeManager(tm)
+  , servo(servo)
+  , tracer(tracer)
+  , provisioningLoaded(false) {
+}
+
+void BackendBridge::start(const String& host, uint16_t port, const String& token, bool useHttps) {
+  // Last accepted bundle is applied from loop() before the first heartbeat.
+  // Loaded from NVS once; a factory reset clears it in memory as well
+  if (!provisioningLoaded) {
+    provisioningLoaded = true;
+    if (provisioning->begin()) {
+      LOG("Provisioning restored (v%lu)", (unsigned long)provisioning->getVersion());
+    }
+    backend->setProvisioning(provisioning);
+  }
+  
+  backend->begin(host, port, token, useHttps);
+  backend->setTimezoneOffset(timeManager->getTimezoneOffset());
+  
+  // begin() loads the compiled-in endpoints: put the active bundle's backends
+  // and heartbeat floor back on every switch to online, not only the first
+  const ProvisionConfig& bundle = provisioning->getConfig();
+  backend->setMinHeartbeatMs(bundle.telemetryMs);
+  if (bundle.backends[0] != '\0') {
+    backend->setEndpoints(bundle.backends);
+  }
+  LOG("Backend client initialized - MAC: %s", backend->getMacAddress().c_str());
+}
+
+void BackendBridge::stop() {
+  backend->stop();
+}
+
+void BackendBridge::markFed() {
+  if (timeManager->isSet()) {
+    backend->setLastFeedEpoch(timeManager->getLocalEpoch() + timeManager->getTimezoneOffset() * 60);
+  }
+}
+
+bool BackendBridge::applyBackendSchedule() {
+  FeedTime times[MAX_FEED_TIMES];
+  uint8_t count = 0;
+  
+  if (!backend->takeSchedule(times, count)) {
+    return false;
+  }
+  
+  // Compile synced schedule into the local scheduler (no-op if unchanged)
+  scheduler->setFeedTimes(times, count);
+  return true;
+}
+
+bool BackendBridge::applyProvisioning() {
+  ProvisionConfig cfg;
+  if (!provisioning->takeUpdate(cfg)) {
+    return false;
+  }
+  
+  // One bundle, applied to all modules in the same loop pass; the schedule
+  // part only if it differs from the bundle the scheduler last took (local
+  // edits win over that one)
+  scheduler->applyProvisioned(cfg);
+  servo->setCalibration(cfg.servoClosedUs, cfg.servoOpenUs);
+  backend->setMinHeartbeatMs(cfg.telemetryMs);
+  if (cfg.backends[0] != '\0') {
+    backend->setEndpoints(cfg.backends);
+  }
+  LOG("Provisioning v%lu applied", (unsigned long)cfg.version);
+  return true;
+}
+
+void BackendBridge::applyBackendClock() {
+  uint32_t serverEpoch = 0;
+  if (!backend->takeServerEpoch(serverEpoch)) {
+    return;
+  }
+  
+  // Take the backend clock if the device has none, so the schedule can run locally;
+  // otherwise correct only real drift
+  if (timeManager->isSet()) {
+    int32_t deviceUtc = (int32_t)(timeManager->getLocalEpoch() + timeManager->getTimezoneOffset() * 60);
+    int32_t drift = deviceUtc - (int32_t)serverEpoch;
+    if (drift > -CLOCK_MAX_DRIFT_S && drift < CLOCK_MAX_DRIFT_S) {
+      return;
+    }
+    LOG("Clock drift %ld s - correcting from backend", (long)drift);
+  } else {
+    LOG("Time set from backend clock");
+  }
+  timeManager->setTime(serverEpoch, timeManager->getTimezoneOffset());
+}
+
+bool BackendBridge::isLocalScheduleActive() const {
+  // Local execution needs a clock and a schedule (synced now or persisted earlier)
+  if (!timeManager->isSet()) return false;
+  return backend->hasSyncedSchedule() || scheduler->getConfig().timesCount > 0;
+}
+
+bool BackendBridge::handleFeedCommand() {
+  FeedCommand feedCmd;
+  if (!backend->takeFeedCommand(feedCmd)) {
+    return false;
+  }
+  
+  LOG("Backend: Feed command received (%s)", feedCmd.id.length() > 0 ? feedCmd.id.c_str() : "no id");
+  if (feedCmd.id.length() > 0) {
+    tracer->begin(feedCmd.id, feedCmd.receivedAt, timeManager->getUtcEpochMs());
+  }
+  
+  // Lid still moving: nothing is fed, so no cooldown and no success event;
+  // the trace finishes as "busy"
+  if (!servo->isIdle()) {
+    metrics.inc(MET_FEEDS_MISSED_BACKEND);
+    LOG("Backend: Feed command refused - servo busy");
+    String meta = "{\"source\":\"backend\",\"reason\":\"busy\"";
+    if (feedCmd.id.length() > 0) meta += ",\"feedId\":\"" + feedCmd.id + "\"";
+    meta += "}";
+    backend->sendLog("warn", "FEED_REFUSED", meta);
+    return false;
+  }
+  
+  // Override duration if specified
+  uint32_t feedDuration = feedCmd.durationMs;
+  if (feedDuration > 0) {
+    scheduler->setOpenHoldDuration(feedDuration);
+  }
+  
+  // Trigger feed
+  metrics.inc(MET_FEEDS_BACKEND);
+  servo->open();
+  tracer->actuatorStarted(*servo);
+  markFed();
+  
+  // Log feed event
+  String meta = "{\"duration_ms\":" + String(feedDuration > 0 ? feedDuration : OPEN_HOLD_MS) + ",\"source\":\"backend\"}";
+  backend->sendLog("info", "Feeding triggered by backend", meta);
+  return true;
+}
+
+void BackendBridge::reportScheduledFeed(bool wasIdle) {
+  if (!wasIdle || servo->isIdle()) {
+    return;
+  }
+  
+  // FEED_EXECUTED also arms the backend cooldown for heartbeat feed decisions
+  markFed();
+  String meta = "{\"duration_ms\":" + String(scheduler->getConfig().openHoldMs) + ",\"source\":\"local_schedule\"}";
+  backend->sendLog("info", "FEED_EXECUTED", meta);
+}
+
+void BackendBridge::reportFeedTrace() {
+  String traceMeta;
+  if (tracer->tick(*servo, traceMeta)) {
+    backend->sendLog("info", "FEED_TRACE", traceMeta);
+  }
+}
@@ -0,0 +1,97 @@
+#ifndef BACKEND_BRIDGE_H
+#define BACKEND_BRIDGE_H
+
+#include "Config.h"
+#include "BackendClient.h"
+#include "ProvisionManager.h"
+#include "OfflineScheduler.h"
+#include "TimeManager.h"
+#include "ServoController.h"
+#include "FeedTracer.h"
+#include <Arduino.h>
+
+/**
+ * @brief Online-mode glue between BackendClient and the local modules
+ * 
+ * BackendClient only queues requests and parses answers; this applies
+ * what it pulled (clock, provisioning bundle, schedule, feed commands) to
+ * the scheduler, clock and servo, and reports local feeds back to it.
+ * SmartFeeder.ino and the fleet simulator both run the online mode
+ * through this class, so the simulated fleet behaves like real devices.
+ */
+class BackendBridge {
+private:
+  BackendClient* backend;
+  ProvisionManager* provisioning;
+  OfflineScheduler* scheduler;
+  TimeManager* timeManager;
+  ServoController* servo;
+  FeedTracer* tracer;
+  bool provisioningLoaded;
+  
+  /**
+   * @brief Arm the backend feed cooldown with the current time
+   */
+  void markFed();
+  
+public:
+  BackendBridge(BackendClient* bc, ProvisionManager* pm, OfflineScheduler* sched,
+                TimeManager* tm, ServoController* servo, FeedTracer* tracer);
+  
+  /**
+   * @brief Start the backend client (entering online mode)
+   * 
+   * The persisted bundle is loaded once; its backends and heartbeat floor
+   * are put back on every start, as BackendClient::begin() resets them.
+   */
+  void start(const String& host, uint16_t port, const String& token, bool useHttps);
+  
+  /**
+   * @brief Stop the backend client (leaving online mode)
+   */
+  void stop();
+  
+  /**
+   * @brief Take the backend clock if unset, or correct drift beyond CLOCK_MAX_DRIFT_S
+   */
+  void applyBackendClock();
+  
+  /**
+   * @brief Apply a newly accepted provisioning bundle to all modules
+   * @return true if a bundle was pending
+   */
+  bool applyProvisioning();
+  
+  /**
+   * @brief Compile a synced schedule into the local scheduler
+   * @return true if a schedule was pending
+   */
+  bool applyBackendSchedule();
+  
+  /**
+   * @brief Whether the schedule runs locally (clock and schedule present)
+   */
+  bool isLocalScheduleActive() const;
+  
+  /**
+   * @brief Run a feed command pulled by the heartbeat
+   * 
+   * A command arriving while the lid is moving is refused (counted as
+   * missed, FEED_REFUSED event) and does not arm the feed cooldown.
+   * @return true if the servo opened
+   */
+  bool handleFeedCommand();
+  
+  /**
+   * @brief Report a feed the local scheduler just started (FEED_EXECUTED)
+   * @param wasIdle Servo state before OfflineScheduler::tick()
+   */
+  void reportScheduledFeed(bool wasIdle);
+  
+  /**
+   * @brief Send the stage breakdown of a traced command once the lid has closed
+   */
+  void reportFeedTrace();
+};
+
+#endif // BACKEND_BRIDGE_H
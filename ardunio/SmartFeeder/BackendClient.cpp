@@ -1,22 +1,71 @@
+#define LOG_MODULE LOG_MOD_BACKEND
 #include "BackendClient.h"
+#include "Metrics.h"
+#include "ResponseWriter.h"
 
 #if defined(ESP32)
   #include <WiFi.h>
-  #include <HTTPClient.h>
-  #include <Preferences.h>
 #elif defined(ESP8266)
   #include <ESP8266WiFi.h>
-  #include <ESP8266HTTPClient.h>
-  #include <EEPROM.h>
 #endif
 
+// Latency budget, attempts and staleness per request class
+const BackendClient::RequestPolicy BackendClient::POLICIES[REQ_TYPE_COUNT] = {
+  /* REQ_HEARTBEAT     */ { 3000, 1,  30000 },   // Next heartbeat supersedes a failed one
+  /* REQ_PROVISION     */ { 5000, 3, 600000 },
+  /* REQ_SCHEDULE_SYNC */ { 5000, 3, 600000 }
+};
+
 BackendClient::BackendClient() 
   : backendPort(0)
   , useHttps(false)
   , timezoneOffset(0)
-  , lastFeedCheck(0)
-  , lastLogSent(0)
-  , lastScheduleSync(0) {
+  , localScheduleActive(false)
+  , nextHeartbeatAt(0)
+  , heartbeatIntervalMs(HEARTBEAT_INTERVAL_MS)
+  , minHeartbeatMs(0)
+  , heartbeatCount(0)
+  , scheduleSynced(false)
+  , lastServerEpoch(0)
+  , lastFeedEpoch(0)
+  , provisioning(nullptr)
+  , eventCount(0)
+  , eventsDropped(0)
+  , clockPending(false)
+  , feedCommandPending(false)
+  , pendingFeedDurationMs(0)
+  , feedReceivedAt(0)
+  , schedulePending(false)
+  , pendingTimesCount(0)
+  , macHash(0)
+  , backoffUntil(0)
+  , backoffLevel(0)
+  , breakerState(BREAKER_CLOSED)
+  , consecutiveFailures(0)
+  , breakerTrips(0)
+  , breakerOpenUntil(0)
+  , requestsSent(0)
+  , requestsSucceeded(0)
+  , requestsFailed(0)
+  , requestsDropped(0)
+  , budgetOverruns(0)
+  , connectCount(0)
+  , reuseCount(0)
+  , handshakeCount(0)
+  , handshakeTotalMs(0)
+  , lastHandshakeMs(0)
+  , pinFailures(0)
+  , endpointCount(0)
+  , activeEndpoint(0)
+  , nextProbeEndpoint(0)
+  , nextEndpointProbeAt(0)
+  , failoverCount(0) {
+  
+  for (uint8_t i = 0; i < QUEUE_SIZE; i++) {
+    queue[i].used = false;
+  }
+  memset(rtt, 0, sizeof(rtt));
+  memset(&probeRtt, 0, sizeof(probeRtt));
   
   // Get MAC address
 #if defined(ESP32)
@@ -29,69 +78,680 @@ BackendClient::BackendClient()
 }
 
 void BackendClient::begin(const String& host, uint16_t port, const String& token, bool https) {
-  backendHost = host;
-  backendPort = port;
   authToken = token;
   useHttps = https;
-  LOG("BackendClient: Configured - %s://%s:%d (Token: %s)", 
-      https ? "https" : "http", host.c_str(), port, 
+  
+  // MAC may not be available when constructed before WiFi init
+  if (macAddress.length() == 0 || macAddress == "00:00:00:00:00:00") {
+    macAddress = WiFi.macAddress();
+  }
+  
+  // FNV-1a over MAC: stable per device, uniform across the fleet
+  macHash = 2166136261UL;
+  for (unsigned int i = 0; i < macAddress.length(); i++) {
+    macHash ^= (uint8_t)macAddress[i];
+    macHash *= 16777619UL;
+  }
+  
+  // Keep the connection open between requests
+  http.setReuse(true);
+  
+  if (useHttps) {
+    // Pin the server certificate; fall back to CA validation, never silently insecure
+#if defined(ESP32)
+    if (strlen(BACKEND_TLS_CA_CERT) > 0) {
+      secureClient.setCACert(BACKEND_TLS_CA_CERT);
+    } else if (strlen(BACKEND_TLS_FINGERPRINT) > 0) {
+      secureClient.setInsecure();  // Chain not validated, fingerprint checked after connect
+    } else {
+      secureClient.setInsecure();
+      LOGW("BackendClient: WARNING - HTTPS without CA or fingerprint, server not verified");
+    }
+    secureClient.setHandshakeTimeout(TLS_HANDSHAKE_TIMEOUT_MS / 1000);
+#elif defined(ESP8266)
+    if (strlen(BACKEND_TLS_FINGERPRINT) > 0) {
+      secureClient.setFingerprint(BACKEND_TLS_FINGERPRINT);
+    } else {
+      secureClient.setInsecure();
+      LOGW("BackendClient: WARNING - HTTPS without fingerprint, server not verified");
+    }
+    // Resume the previous session on reconnect (abbreviated handshake)
+    secureClient.setSession(&tlsSession);
+    secureClient.setBufferSizes(1024, 1024);
+#endif
+  }
+  
+  // Primary backend first, compiled-in fallbacks after it
+  String list = host + ":" + String(port);
+  if (strlen(BACKEND_FALLBACKS) > 0) {
+    list += ",";
+    list += BACKEND_FALLBACKS;
+  }
+  setEndpoints(list);
+  
+  // Spread first requests after a building-wide power outage
+  unsigned long now = millis();
+  nextHeartbeatAt = now + phaseOffset(STARTUP_SPREAD_MS);
+  nextEndpointProbeAt = now + phaseOffset(ENDPOINT_PROBE_MS);
+  
+  LOG("BackendClient: Configured - %s://%s:%d, %u endpoint(s) (Token: %s)", 
+      https ? "https" : "http", host.c_str(), port, endpointCount,
       token.length() > 0 ? "Set" : "Not Set");
+  LOG("BackendClient: First heartbeat in %lu ms", nextHeartbeatAt - now);
+}
+
+void BackendClient::stop() {
+  for (uint8_t i = 0; i < QUEUE_SIZE; i++) {
+    queue[i].used = false;
+    queue[i].endpoint = "";
+    queue[i].body = "";
+  }
+  
+  // A feed command or schedule taken after the switch would act on stale intent
+  feedCommandPending = false;
+  schedulePending = false;
+  clockPending = false;
+  
+  transport().stop();
+  authToken = "";  // isConfigured() false until begin()
+  LOG("BackendClient: Stopped");
+}
+
+uint32_t BackendClient::phaseOffset(uint32_t periodMs) const {
+  if (periodMs == 0) return 0;
+  return macHash % periodMs;
+}
+
+unsigned long BackendClient::scheduleAfter(uint32_t intervalMs) {
+  uint32_t jitterMax = intervalMs / 100 * JITTER_PERCENT;
+  uint32_t jitter = jitterMax > 0 ? (uint32_t)random((long)jitterMax) : 0;
+  return millis() + intervalMs + jitter;
+}
+
+void BackendClient::enterBackoff(const String& retryAfter) {
+  uint32_t waitMs = 0;
+  
+  // Retry-After in delta-seconds form (HTTP-date form is not used by config-service)
+  long seconds = retryAfter.toInt();
+  if (seconds > 0) {
+    waitMs = (uint32_t)seconds * 1000;
+  } else {
+    waitMs = BACKOFF_BASE_MS << (backoffLevel < 6 ? backoffLevel : 6);
+  }
+  if (waitMs > BACKOFF_MAX_MS) waitMs = BACKOFF_MAX_MS;
+  if (backoffLevel < 255) backoffLevel++;
+  
+  // Jitter so devices told the same Retry-After do not return together
+  backoffUntil = scheduleAfter(waitMs);
+  LOG("BackendClient: Server busy - backing off %lu ms (level %u)",
+      (unsigned long)(backoffUntil - millis()), backoffLevel);
 }
 
 void BackendClient::setTimezoneOffset(int offsetMinutes) {
   timezoneOffset = offsetMinutes;
 }
 
-bool BackendClient::httpGet(const String& endpoint, String& response) {
-  if (WiFi.status() != WL_CONNECTED) {
+void BackendClient::tick() {
+  if (!isConfigured() || macAddress.length() == 0) {
+    return;
+  }
+  
+  // Single periodic request; body is built at dispatch so it carries the latest events
+  if (isDue(nextHeartbeatAt) && !isQueued(REQ_HEARTBEAT)) {
+    nextHeartbeatAt = scheduleAfter(heartbeatIntervalMs);
+    heartbeatCount++;
+    enqueue(REQ_HEARTBEAT, "/heartbeat?mac=" + macAddress);
+  }
+  
+  // Nothing leaves the device while offline or told to back off
+  if (WiFi.status() != WL_CONNECTED || inBackoff()) {
+    return;
+  }
+  
+  // Circuit breaker: no requests while open, a single cheap probe when half-open
+  if (breakerState == BREAKER_OPEN) {
+    if (!isDue(breakerOpenUntil)) return;
+    breakerState = BREAKER_HALF_OPEN;
+    LOG("BackendClient: Breaker half-open - probing backend");
+  }
+  
+  if (breakerState == BREAKER_HALF_OPEN) {
+    probeBackend();
+    return;
+  }
+  
+  int index = selectNext();
+  if (index >= 0) {
+    dispatch(index);
+    return;
+  }
+  
+  // Idle: keep standby latencies current and move to a faster endpoint
+  if (endpointCount > 1) {
+    if (isDue(nextEndpointProbeAt)) {
+      nextEndpointProbeAt = scheduleAfter(ENDPOINT_PROBE_MS);
+      probeStandbyEndpoint();
+    }
+    reevaluateEndpoint();
+  }
+}
+
+bool BackendClient::enqueue(BackendRequestType type, const String& endpoint, const String& body) {
+  int slot = -1;
+  for (uint8_t i = 0; i < QUEUE_SIZE; i++) {
+    if (!queue[i].used) {
+      slot = i;
+      break;
+    }
+  }
+  
+  // Queue full: evict oldest request of the lowest priority not above ours
+  if (slot < 0) {
+    for (uint8_t i = 0; i < QUEUE_SIZE; i++) {
+      if (queue[i].type < type) continue;
+      if (slot < 0 || queue[i].type > queue[slot].type ||
+          (queue[i].type == queue[slot].type &&
+           (int32_t)(queue[i].enqueuedAt - queue[slot].enqueuedAt) < 0)) {
+        slot = i;
+      }
+    }
+    if (slot < 0) {
+      requestsDropped++;
+      LOG("BackendClient: Queue full - dropping request type %u", type);
+      return false;
+    }
+    requestsDropped++;
+    LOG("BackendClient: Queue full - evicted request type %u", queue[slot].type);
+  }
+  
+  PendingRequest& req = queue[slot];
+  req.used = true;
+  req.type = type;
+  req.attempts = 0;
+  req.enqueuedAt = millis();
+  req.notBefore = req.enqueuedAt;
+  req.endpoint = endpoint;
+  req.body = body;
+  return true;
+}
+
+bool BackendClient::isQueued(BackendRequestType type) const {
+  for (uint8_t i = 0; i < QUEUE_SIZE; i++) {
+    if (queue[i].used && queue[i].type == type) return true;
+  }
+  return false;
+}
+
+uint8_t BackendClient::getQueueDepth() const {
+  uint8_t depth = 0;
+  for (uint8_t i = 0; i < QUEUE_SIZE; i++) {
+    if (queue[i].used) depth++;
+  }
+  return depth;
+}
+
+int BackendClient::selectNext() {
+  unsigned long now = millis();
+  int best = -1;
+  
+  for (uint8_t i = 0; i < QUEUE_SIZE; i++) {
+    PendingRequest& req = queue[i];
+    if (!req.used) continue;
+    
+    // Drop stale requests (e.g. a feed check that waited out a breaker trip)
+    if (now - req.enqueuedAt > POLICIES[req.type].maxAgeMs) {
+      LOG("BackendClient: Dropping stale request type %u after %u attempts", req.type, req.attempts);
+      req.used = false;
+      req.endpoint = "";
+      req.body = "";
+      requestsDropped++;
+      continue;
+    }
+    
+    if (!isDue(req.notBefore)) continue;
+    
+    if (best < 0 || req.type < queue[best].type ||
+        (req.type == queue[best].type && (int32_t)(req.enqueuedAt - queue[best].enqueuedAt) < 0)) {
+      best = i;
+    }
+  }
+  
+  return best;
+}
+
+void BackendClient::dispatch(int index) {
+  PendingRequest& req = queue[index];
+  const RequestPolicy& policy = POLICIES[req.type];
+  BackendRequestType type = req.type;
+  
+  req.attempts++;
+  requestsSent++;
+  
+  uint8_t eventsSent = 0;
+  if (type == REQ_HEARTBEAT) {
+    req.body = buildHeartbeatBody(eventsSent);
+  }
+  
+  String response;
+  unsigned long start = millis();
+  int httpCode;
+  if (type == REQ_PROVISION) {
+    httpCode = fetchProvisioning(policy.timeoutMs, req.endpoint);
+  } else {
+    httpCode = performRequest(rtt[type], policy.timeoutMs, req.endpoint, req.body, response);
+  }
+  unsigned long elapsed = millis() - start;
+  
+  if (elapsed > policy.timeoutMs) {
+    budgetOverruns++;
+    LOG("BackendClient: Request type %u took %lu ms (budget %u ms)", type, elapsed, policy.timeoutMs);
+  }
+  
+  // 304: bundle already current (version raced with the heartbeat)
+  if ((httpCode >= 200 && httpCode < 300) || httpCode == HTTP_CODE_NOT_MODIFIED) {
+    recordSuccess();
+    endpoints[activeEndpoint].consecutiveFailures = 0;
+    endpoints[activeEndpoint].downUntil = 0;
+    req.used = false;
+    req.endpoint = "";
+    req.body = "";
+    
+    if (type == REQ_HEARTBEAT) {
+      handleHeartbeatResponse(response, eventsSent);
+    } else if (type == REQ_SCHEDULE_SYNC) {
+      handleScheduleResponse(response);
+    }
+    return;
+  }
+  
+  requestsFailed++;
+  metrics.inc(MET_BACKEND_FAILURES);
+  
+  // Transport errors and 5xx count against the backend; 503/429 already set backoff
+  bool backendFault = (httpCode < 0 || httpCode >= 500);
+  if (backendFault && httpCode != 503) {
+    // Another healthy endpoint: retry there right away, attempt not counted
+    if (failoverEndpoint()) {
+      req.attempts--;
+      req.notBefore = millis();
+      return;
+    }
+    recordFailure();
+  }
+  
+  // Other 4xx: retrying the same request will not help
+  bool retryable = backendFault || httpCode == 429;
+  
+  // Rejected heartbeat: the same events would make every later one fail too
+  if (type == REQ_HEARTBEAT && !retryable && httpCode >= 400 && httpCode < 500 && eventsSent > 0) {
+    LOG("BackendClient: Heartbeat rejected (%d) - dropping %u buffered events", httpCode, eventsSent);
+    dropEvents(eventsSent);
+    eventsDropped += eventsSent;
+  }
+  
+  if (!retryable || req.attempts >= policy.maxAttempts) {
+    LOG("BackendClient: Request type %u failed (code %d) - dropped after %u attempts",
+        type, httpCode, req.attempts);
+    req.used = false;
+    req.endpoint = "";
+    req.body = "";
+    requestsDropped++;
+    return;
+  }
+  
+  // Exponential backoff with jitter between attempts
+  uint8_t shift = req.attempts - 1;
+  if (shift > 6) shift = 6;
+  req.notBefore = scheduleAfter(RETRY_BASE_MS << shift);
+  LOG("BackendClient: Request type %u failed (code %d) - retry %u in ~%lu ms",
+      type, httpCode, req.attempts, (unsigned long)(RETRY_BASE_MS << shift));
+}
+
+void BackendClient::probeBackend() {
+  // All endpoints failed: probe the one expected to recover first
+  uint8_t index = pickEndpoint();
+  if (index != activeEndpoint) {
+    useEndpoint(index, true);
+  }
+  
+  String response;
+  requestsSent++;
+  int httpCode = performRequest(probeRtt, PROBE_TIMEOUT_MS, "/health", "", response);
+  
+  if (httpCode >= 200 && httpCode < 300) {
+    LOG("BackendClient: Probe OK on %s:%u - breaker closed", backendHost.c_str(), backendPort);
+    breakerState = BREAKER_CLOSED;
+    endpoints[activeEndpoint].consecutiveFailures = 0;
+    endpoints[activeEndpoint].downUntil = 0;
+    recordSuccess();
+    return;
+  }
+  
+  requestsFailed++;
+  metrics.inc(MET_BACKEND_FAILURES);
+  openBreaker();
+}
+
+bool BackendClient::setEndpoints(const String& list) {
+  BackendEndpoint parsed[MAX_ENDPOINTS];
+  uint8_t count = 0;
+  int start = 0;
+  
+  while (start < (int)list.length() && count < MAX_ENDPOINTS) {
+    int end = list.indexOf(',', start);
+    if (end < 0) end = list.length();
+    String entry = list.substring(start, end);
+    entry.trim();
+    start = end + 1;
+    
+    int colon = entry.lastIndexOf(':');
+    long port = colon > 0 ? entry.substring(colon + 1).toInt() : 0;
+    if (port <= 0 || port > 65535) {
+      if (entry.length() > 0) LOG("BackendClient: Ignoring invalid endpoint: %s", entry.c_str());
+      continue;
+    }
+    
+    BackendEndpoint& ep = parsed[count++];
+    ep.host = entry.substring(0, colon);
+    ep.port = (uint16_t)port;
+    memset(&ep.connectRtt, 0, sizeof(ep.connectRtt));
+    ep.consecutiveFailures = 0;
+    ep.downUntil = 0;
+    ep.requests = 0;
+    ep.failures = 0;
+    
+    // Known endpoint: keep its health and latency
+    for (uint8_t i = 0; i < endpointCount; i++) {
+      if (endpoints[i].host == ep.host && endpoints[i].port == ep.port) {
+        ep = endpoints[i];
+        break;
+      }
+    }
+  }
+  
+  if (count == 0) {
+    LOG("BackendClient: No valid endpoint in list - keeping current");
     return false;
   }
   
-  WiFiClient client;
-  HTTPClient http;
+  String activeHost = backendHost;
+  uint16_t activePort = backendPort;
+  for (uint8_t i = 0; i < count; i++) {
+    endpoints[i] = parsed[i];
+  }
+  endpointCount = count;
   
-  String protocol = useHttps ? "https://" : "http://";
-  String url = protocol + backendHost + ":" + String(backendPort) + endpoint;
+  // Stay on the active endpoint if it is still listed
+  for (uint8_t i = 0; i < count; i++) {
+    if (endpoints[i].host == activeHost && endpoints[i].port == activePort) {
+      activeEndpoint = i;
+      return true;
+    }
+  }
+  useEndpoint(0, true);
+  LOG("BackendClient: %u endpoint(s), active %s:%u", count, backendHost.c_str(), backendPort);
+  return true;
+}
+
+bool BackendClient::isEndpointHealthy(uint8_t index) const {
+  return endpoints[index].downUntil == 0 || isDue(endpoints[index].downUntil);
+}
+
+uint8_t BackendClient::pickEndpoint() const {
+  int best = -1;
+  for (uint8_t i = 0; i < endpointCount; i++) {
+    if (!isEndpointHealthy(i)) continue;
+    if (best < 0) {
+      best = i;
+      continue;
+    }
+    // Measured beats unmeasured; otherwise lower smoothed RTT wins
+    const RttEstimator& a = endpoints[i].connectRtt;
+    const RttEstimator& b = endpoints[best].connectRtt;
+    if (a.samples > 0 && (b.samples == 0 || a.srttMs < b.srttMs)) {
+      best = i;
+    }
+  }
+  if (best >= 0) return (uint8_t)best;
   
-  http.setTimeout(5000);
-  if (!http.begin(client, url)) {
-    LOG("BackendClient: HTTP begin failed");
+  // None healthy: the one whose down period ends first
+  uint8_t earliest = 0;
+  for (uint8_t i = 1; i < endpointCount; i++) {
+    if ((int32_t)(endpoints[i].downUntil - endpoints[earliest].downUntil) < 0) earliest = i;
+  }
+  return earliest;
+}
+
+void BackendClient::useEndpoint(uint8_t index, bool resetStats) {
+  if (index >= endpointCount) return;
+  
+  // Open connection belongs to the previous endpoint
+  transport().stop();
+  activeEndpoint = index;
+  backendHost = endpoints[index].host;
+  backendPort = endpoints[index].port;
+  
+  if (resetStats) {
+    memset(rtt, 0, sizeof(rtt));
+    memset(&probeRtt, 0, sizeof(probeRtt));
+  }
+}
+
+bool BackendClient::failoverEndpoint() {
+  BackendEndpoint& ep = endpoints[activeEndpoint];
+  ep.failures++;
+  if (ep.consecutiveFailures < 255) ep.consecutiveFailures++;
+  
+  // Down period doubles while the endpoint keeps failing
+  uint8_t shift = ep.consecutiveFailures - 1;
+  if (shift > 4) shift = 4;
+  uint32_t downMs = ENDPOINT_DOWN_MS << shift;
+  if (downMs > ENDPOINT_DOWN_MAX_MS) downMs = ENDPOINT_DOWN_MAX_MS;
+  ep.downUntil = scheduleAfter(downMs);
+  if (ep.downUntil == 0) ep.downUntil = 1;
+  
+  if (endpointCount < 2) return false;
+  
+  uint8_t next = pickEndpoint();
+  if (next == activeEndpoint || !isEndpointHealthy(next)) {
     return false;
   }
   
-  // Add Authorization header
-  if (authToken.length() > 0) {
-    http.addHeader("Authorization", "Bearer " + authToken);
+  failoverCount++;
+  LOG("BackendClient: Endpoint %s:%u down for ~%lu ms - failover to %s:%u (#%lu)",
+      ep.host.c_str(), ep.port, (unsigned long)downMs,
+      endpoints[next].host.c_str(), endpoints[next].port, (unsigned long)failoverCount);
+  useEndpoint(next, true);
+  return true;
+}
+
+void BackendClient::reevaluateEndpoint() {
+  uint8_t best = pickEndpoint();
+  if (best == activeEndpoint || !isEndpointHealthy(best)) return;
+  
+  // Failed-over away from a recovered endpoint: go back once it is healthy
+  // again only if it is clearly faster (hysteresis against flapping)
+  const RttEstimator& current = endpoints[activeEndpoint].connectRtt;
+  const RttEstimator& candidate = endpoints[best].connectRtt;
+  if (isEndpointHealthy(activeEndpoint) &&
+      (candidate.samples == 0 || current.samples == 0 ||
+       candidate.srttMs * 100 >= current.srttMs * ENDPOINT_SWITCH_PERCENT)) {
+    return;
   }
-  // Add MAC address header
-  http.addHeader("X-Device-Mac", macAddress);
   
-  int httpCode = http.GET();
+  LOG("BackendClient: Switching to faster endpoint %s:%u (%lu ms vs %lu ms)",
+      endpoints[best].host.c_str(), endpoints[best].port,
+      (unsigned long)candidate.srttMs, (unsigned long)current.srttMs);
+  useEndpoint(best, true);
+}
+
+void BackendClient::probeStandbyEndpoint() {
+  if (getQueueDepth() > 0 || breakerState != BREAKER_CLOSED) return;
+  
+  // Round robin over standby endpoints that are not known to be down
+  uint8_t index = nextProbeEndpoint % endpointCount;
+  if (index == activeEndpoint) index = (index + 1) % endpointCount;
+  nextProbeEndpoint = index + 1;
+  if (!isEndpointHealthy(index)) return;
   
-  if (httpCode == 200) {
-    response = http.getString();
-    http.end();
-    return true;
+  // Fresh connection on the standby measures its setup time; the active
+  // connection is reopened by the next request
+  uint8_t previous = activeEndpoint;
+  useEndpoint(index, false);
+  
+  RttEstimator probe;
+  memset(&probe, 0, sizeof(probe));
+  String response;
+  requestsSent++;
+  int httpCode = performRequest(probe, PROBE_TIMEOUT_MS, "/health", "", response);
+  transport().stop();
+  
+  BackendEndpoint& ep = endpoints[index];
+  if (httpCode >= 200 && httpCode < 300) {
+    requestsSucceeded++;
+    ep.consecutiveFailures = 0;
+    LOG("BackendClient: Standby %s:%u healthy, connect %lu ms",
+        ep.host.c_str(), ep.port, (unsigned long)ep.connectRtt.srttMs);
+  } else {
+    requestsFailed++;
+    metrics.inc(MET_BACKEND_FAILURES);
+    ep.failures++;
+    if (ep.consecutiveFailures < 255) ep.consecutiveFailures++;
+    ep.downUntil = scheduleAfter(ENDPOINT_DOWN_MS);
+    LOG("BackendClient: Standby %s:%u failed (code %d)", ep.host.c_str(), ep.port, httpCode);
   }
   
-  LOG("BackendClient: GET failed - code %d", httpCode);
-  http.end();
-  return false;
+  useEndpoint(previous, false);
+}
+
+void BackendClient::recordSuccess() {
+  requestsSucceeded++;
+  consecutiveFailures = 0;
+  breakerTrips = 0;
+}
+
+void BackendClient::recordFailure() {
+  if (consecutiveFailures < 255) consecutiveFailures++;
+  
+  if (breakerState == BREAKER_CLOSED && consecutiveFailures >= BREAKER_THRESHOLD) {
+    openBreaker();
+  }
+}
+
+void BackendClient::openBreaker() {
+  // Cooldown doubles on each trip without a success in between
+  uint8_t shift = breakerTrips < 5 ? breakerTrips : 5;
+  uint32_t cooldown = BREAKER_COOLDOWN_MS << shift;
+  if (cooldown > BREAKER_COOLDOWN_MAX_MS) cooldown = BREAKER_COOLDOWN_MAX_MS;
+  if (breakerTrips < 255) breakerTrips++;
+  
+  breakerState = BREAKER_OPEN;
+  breakerOpenUntil = scheduleAfter(cooldown);
+  LOG("BackendClient: Breaker open for ~%lu ms after %u failures",
+      (unsigned long)cooldown, consecutiveFailures);
+}
+
+const char* BackendClient::getBreakerStateString() const {
+  switch (breakerState) {
+    case BREAKER_OPEN:      return "OPEN";
+    case BREAKER_HALF_OPEN: return "HALF_OPEN";
+    default:                return "CLOSED";
+  }
+}
+
+WiFiClient& BackendClient::transport() {
+  if (useHttps) return secureClient;
+  return plainClient;
 }
 
-bool BackendClient::httpPost(const String& endpoint, const String& body) {
-  if (WiFi.status() != WL_CONNECTED) {
+bool BackendClient::ensureConnected(uint16_t timeoutMs) {
+  WiFiClient& client = transport();
+  if (client.connected()) {
+    reuseCount++;
+    return true;
+  }
+  
+  client.stop();
+  connectCount++;
+  
+  // Handshake is paid once per connection; it has its own estimate and budget
+  RttEstimator& connectRtt = endpoints[activeEndpoint].connectRtt;
+  uint16_t connectTimeout = retransmitTimeout(connectRtt, useHttps ? TLS_HANDSHAKE_TIMEOUT_MS : timeoutMs);
+  unsigned long start = millis();
+  // connect() is not virtual on ESP32: call it on the concrete client
+  int ok;
+#if defined(ESP32)
+  if (useHttps) {
+    ok = secureClient.connect(backendHost.c_str(), backendPort, connectTimeout);
+  } else {
+    ok = plainClient.connect(backendHost.c_str(), backendPort, connectTimeout);
+  }
+#elif defined(ESP8266)
+  client.setTimeout(connectTimeout);
+  if (useHttps) {
+    ok = secureClient.connect(backendHost.c_str(), backendPort);
+  } else {
+    ok = plainClient.connect(backendHost.c_str(), backendPort);
+  }
+#endif
+  uint32_t elapsed = millis() - start;
+  
+  if (!ok) {
+    // Refused connections fail fast; only a connect that ran out of time backs off
+    if (elapsed >= connectTimeout) backoffRtt(connectRtt);
+    LOG("BackendClient: Connect to %s:%u failed after %lu ms (timeout %u ms)",
+        backendHost.c_str(), backendPort, (unsigned long)elapsed, connectTimeout);
+#if defined(ESP8266)
+    // BearSSL checks the fingerprint inside connect() and fails it there
+    if (useHttps && strlen(BACKEND_TLS_FINGERPRINT) > 0 &&
+        secureClient.getLastSSLError() == BR_ERR_X509_NOT_TRUSTED) {
+      LOG("BackendClient: Certificate fingerprint mismatch - connection refused");
+      pinFailures++;
+      metrics.inc(MET_TLS_PIN_FAILURES);
+    }
+#endif
     return false;
   }
+  sampleRtt(connectRtt, elapsed);
+  
+  if (!useHttps) {
+    return true;
+  }
   
-  WiFiClient client;
-  HTTPClient http;
+  handshakeCount++;
+  handshakeTotalMs += elapsed;
+  lastHandshakeMs = elapsed;
+  
+#if defined(ESP32)
+  // ESP32 core has no session API: keep-alive reuse is what avoids handshakes
+  if (strlen(BACKEND_TLS_CA_CERT) == 0 && strlen(BACKEND_TLS_FINGERPRINT) > 0 &&
+      !secureClient.verify(BACKEND_TLS_FINGERPRINT, nullptr)) {
+    LOG("BackendClient: Certificate fingerprint mismatch - connection refused");
+    pinFailures++;
+    metrics.inc(MET_TLS_PIN_FAILURES);
+    client.stop();
+    return false;
+  }
+#endif
+  
+  LOG("BackendClient: TLS handshake %lu ms (#%lu)", (unsigned long)elapsed, (unsigned long)handshakeCount);
+  return true;
+}
+
+int BackendClient::performRequest(RttEstimator& est, uint16_t timeoutMs, const String& endpoint,
+                                  const String& body, String& response, Stream* sink) {
+  endpoints[activeEndpoint].requests++;
+  if (!ensureConnected(timeoutMs)) {
+    return HTTPC_ERROR_CONNECTION_REFUSED;
+  }
   
   String protocol = useHttps ? "https://" : "http://";
   String url = protocol + backendHost + ":" + String(backendPort) + endpoint;
   
-  if (!http.begin(client, url)) {
-    return false;
+  http.setTimeout(retransmitTimeout(est, timeoutMs));
+  if (!http.begin(transport(), url)) {
+    LOG("BackendClient: HTTP begin failed");
+    return -1;
   }
   
   // Add Authorization header
@@ -100,73 +760,305 @@ bool BackendClient::httpPost(const String& endpoint, const String& body) {
   }
   // Add MAC address header
   http.addHeader("X-Device-Mac", macAddress);
-  http.addHeader("Content-Type", "application/json");
+  const char* collect[] = {"Retry-After"};
+  http.collectHeaders(collect, 1);
   
-  int httpCode = http.POST(body);
+  // Connection setup is measured separately: this is request + server time
+  unsigned long start = millis();
+  int httpCode;
+  if (body.length() > 0) {
+    http.addHeader("Content-Type", "application/json");
+    httpCode = http.POST(body);
+  } else {
+    httpCode = http.GET();
+  }
+  
+  if (httpCode >= 200 && httpCode < 300) {
+    backoffLevel = 0;
+    if (sink != nullptr) {
+      // Decodes chunked bodies; a short write from the sink aborts the transfer
+      int written = http.writeToStream(sink);
+      if (written < 0) httpCode = written;
+    } else {
+      response = http.getString();
+    }
+  } else if (httpCode == 503 || httpCode == 429) {
+    enterBackoff(http.header("Retry-After"));
+  }
+  
+  metrics.observe(MET_BACKEND_REQUEST_SECONDS, (millis() - start) * 1000UL);
+  
+  // Any HTTP answer is a valid round trip, error statuses included
+  if (httpCode > 0) {
+    sampleRtt(est, millis() - start);
+  } else if (httpCode == HTTPC_ERROR_READ_TIMEOUT) {
+    backoffRtt(est);
+  }
+  
+  // end() keeps the connection open for the next request (setReuse)
   http.end();
+  if (httpCode < 0) {
+    // Drop a broken or timed out connection so the next request starts clean
+    transport().stop();
+  }
+  return httpCode;
+}
+
+uint16_t BackendClient::retransmitTimeout(const RttEstimator& est, uint16_t fallbackMs) {
+  uint32_t rto = fallbackMs;
+  if (est.samples > 0) {
+    uint32_t variance = est.rttvarMs * 4;
+    rto = est.srttMs + (variance > RTO_GRANULARITY_MS ? variance : RTO_GRANULARITY_MS);
+  }
+  rto <<= est.backoff;
   
-  return (httpCode == 200 || httpCode == 201);
+  if (rto < RTO_MIN_MS) rto = RTO_MIN_MS;
+  if (rto > RTO_MAX_MS) rto = RTO_MAX_MS;
+  return (uint16_t)rto;
 }
 
-bool BackendClient::checkFeedSchedule(uint32_t& durationMs) {
-  if (!isConfigured() || macAddress.length() == 0) {
-    return false;
+void BackendClient::sampleRtt(RttEstimator& est, uint32_t sampleMs) {
+  if (est.samples == 0) {
+    est.srttMs = sampleMs;
+    est.rttvarMs = sampleMs / 2;
+  } else {
+    // rttvar = 3/4 rttvar + 1/4 |srtt - r|, srtt = 7/8 srtt + 1/8 r
+    uint32_t delta = sampleMs > est.srttMs ? sampleMs - est.srttMs : est.srttMs - sampleMs;
+    est.rttvarMs = (est.rttvarMs * 3 + delta) / 4;
+    est.srttMs = (est.srttMs * 7 + sampleMs) / 8;
+  }
+  est.samples++;
+  est.backoff = 0;
+}
+
+void BackendClient::backoffRtt(RttEstimator& est) {
+  est.timeouts++;
+  if (est.backoff < RTO_MAX_BACKOFF) est.backoff++;
+}
+
+uint16_t BackendClient::getConnectTimeoutMs() const {
+  return retransmitTimeout(endpoints[activeEndpoint].connectRtt,
+                           useHttps ? TLS_HANDSHAKE_TIMEOUT_MS : POLICIES[REQ_HEARTBEAT].timeoutMs);
+}
+
+int BackendClient::fetchProvisioning(uint16_t timeoutMs, const String& endpoint) {
+  if (provisioning == nullptr) {
+    return HTTP_CODE_NOT_MODIFIED;
   }
   
-  // Throttle requests
-  uint32_t now = millis();
-  if (now - lastFeedCheck < FEED_CHECK_INTERVAL) {
-    return false;
+  String unused;
+  provisioning->beginUpdate();
+  int httpCode = performRequest(rtt[REQ_PROVISION], timeoutMs, endpoint, "", unused, provisioning);
+  
+  // Staged bundle is only published if it arrived complete and valid
+  if (httpCode < 200 || httpCode >= 300) {
+    provisioning->abortUpdate();
+    return httpCode;
+  }
+  if (!provisioning->commitUpdate()) {
+    // Body was received but not understood; a retry returns the same body
+    LOG("BackendClient: Provisioning bundle rejected");
+    return HTTP_CODE_UNPROCESSABLE_ENTITY;
   }
-  lastFeedCheck = now;
   
-  String endpoint = "/feed/check?mac=" + macAddress + "&tzOffsetMin=" + String(timezoneOffset);
-  String response;
+  scheduleSynced = true;
+  return httpCode;
+}
+
+bool BackendClient::parseJsonLong(const String& json, const char* key, long& value) {
+  String quoted = String("\"") + key + "\"";
+  int keyIdx = json.indexOf(quoted);
+  if (keyIdx < 0) return false;
   
-  LOG("BackendClient: Checking feed schedule...");
+  int colonIdx = json.indexOf(":", keyIdx + quoted.length());
+  if (colonIdx < 0) return false;
   
-  if (!httpGet(endpoint, response)) {
-    return false;
+  String rest = json.substring(colonIdx + 1, colonIdx + 16);
+  rest.trim();
+  if (rest.length() == 0 || rest.startsWith("null")) return false;
+  
+  value = rest.toInt();
+  return true;
+}
+
+bool BackendClient::parseJsonString(const String& json, const char* key, String& value) {
+  String quoted = String("\"") + key + "\"";
+  int keyIdx = json.indexOf(quoted);
+  if (keyIdx < 0) return false;
+  
+  int colonIdx = json.indexOf(":", keyIdx + quoted.length());
+  int quoteStart = json.indexOf("\"", colonIdx + 1);
+  int quoteEnd = json.indexOf("\"", quoteStart + 1);
+  if (colonIdx < 0 || quoteStart < 0 || quoteEnd < 0) return false;
+  
+  value = json.substring(quoteStart + 1, quoteEnd);
+  return true;
+}
+
+bool BackendClient::parseFeedTime(const String& str, FeedTime& out) {
+  int colonPos = str.indexOf(':');
+  if (colonPos <= 0) return false;
+  
+  int hour = str.substring(0, colonPos).toInt();
+  int minute = str.substring(colonPos + 1, colonPos + 3).toInt();
+  if (hour < 0 || hour > 23 || minute < 0 || minute > 59) return false;
+  
+  out.hour = (uint8_t)hour;
+  out.minute = (uint8_t)minute;
+  return true;
+}
+
+void BackendClient::updateHeartbeatInterval(long nextFeedInSec, long suggestedSec, bool attended) {
+  uint32_t interval = (suggestedSec > 0) ? (uint32_t)suggestedSec * 1000 : HEARTBEAT_INTERVAL_MS;
+  
+  if (nextFeedInSec >= 0) {
+    if ((uint32_t)nextFeedInSec <= FEED_DUE_WINDOW_S) {
+      // Feed is due: tighten so the feed starts within a few seconds
+      interval = HEARTBEAT_FAST_MS;
+    } else {
+      // Wake up right when the due window opens, not later
+      uint32_t untilWindowMs = ((uint32_t)nextFeedInSec - FEED_DUE_WINDOW_S) * 1000;
+      if (suggestedSec <= 0) interval = HEARTBEAT_MAX_MS;
+      if (untilWindowMs < interval) interval = untilWindowMs;
+    }
   }
   
-  // Parse JSON response
-  // Expected: {"shouldFeed": true, "durationMs": 5000}
+  // Provisioned telemetry rate bounds the interval, except inside a due window
+  // or while a user has the device open (a "feed now" may be coming)
+  bool feedDue = nextFeedInSec >= 0 && (uint32_t)nextFeedInSec <= FEED_DUE_WINDOW_S;
+  if (!feedDue && !attended && interval < minHeartbeatMs) interval = minHeartbeatMs;
+  
+  if (interval < HEARTBEAT_FAST_MS) interval = HEARTBEAT_FAST_MS;
+  if (interval > HEARTBEAT_MAX_MS) interval = HEARTBEAT_MAX_MS;
+  
+  if (interval != heartbeatIntervalMs) {
+    LOG("BackendClient: Heartbeat interval %lu -> %lu ms (next feed in %ld s)",
+        (unsigned long)heartbeatIntervalMs, (unsigned long)interval, nextFeedInSec);
+    heartbeatIntervalMs = interval;
+  }
+}
+
+String BackendClient::buildHeartbeatBody(uint8_t& included) {
+  String body;
+  body.reserve(192);
+  body = "{\"uptimeS\":" + String(millis() / 1000);
+  body += ",\"rssi\":" + String(WiFi.RSSI());
+  body += ",\"heap\":" + String(ESP.getFreeHeap());
+  body += ",\"lastFeedAt\":" + String(lastFeedEpoch);
+  body += ",\"scheduleVersion\":\"" + scheduleVersion + "\"";
+  if (provisioning != nullptr) {
+    body += ",\"configVersion\":" + String(provisioning->getVersion());
+  }
+  body += ",\"localSchedule\":" + String(localScheduleActive ? "true" : "false");
+  // Backend takes minutes east of UTC (+180 for UTC+3, as /feed/check);
+  // TimeManager keeps the JS-style sign (-180), so it is flipped here
+  body += ",\"tzOffsetMin\":" + String(-timezoneOffset);
+  body += ",\"pollMs\":" + String(heartbeatIntervalMs);
+  body += ",\"queued\":" + String(getQueueDepth());
+  body += ",\"rttMs\":" + String(rtt[REQ_HEARTBEAT].srttMs);
+  body += ",\"rttVarMs\":" + String(rtt[REQ_HEARTBEAT].rttvarMs);
+  body += ",\"timeoutMs\":" + String(getTimeoutMs(REQ_HEARTBEAT));
+  body += ",\"endpoint\":\"" + backendHost + ":" + String(backendPort) + "\"";
+  body += ",\"failovers\":" + String(failoverCount);
+  
+  body += ",\"events\":[";
+  for (uint8_t i = 0; i < eventCount; i++) {
+    if (i > 0) body += ",";
+    body += events[i];
+  }
+  body += "]}";
+  
+  included = eventCount;
+  return body;
+}
+
+void BackendClient::dropEvents(uint8_t count) {
+  // Oldest first; keep any buffered while the request was out
+  if (count > eventCount) count = eventCount;
+  for (uint8_t i = count; i < eventCount; i++) {
+    events[i - count] = events[i];
+  }
+  for (uint8_t i = eventCount - count; i < eventCount; i++) {
+    events[i] = "";
+  }
+  eventCount -= count;
+}
+
+void BackendClient::handleHeartbeatResponse(const String& response, uint8_t eventsSent) {
+  // Events made it to the backend
+  dropEvents(eventsSent);
+  
+  // Rate hints: {"nextFeedInSec": 3600, "pollIntervalSec": 900, "attended": 1, ...}
+  long nextFeedInSec = -1;
+  long suggestedSec = 0;
+  long attended = 0;
+  parseJsonLong(response, "nextFeedInSec", nextFeedInSec);
+  parseJsonLong(response, "pollIntervalSec", suggestedSec);
+  parseJsonLong(response, "attended", attended);
+  updateHeartbeatInterval(nextFeedInSec, suggestedSec, attended != 0);
+  nextHeartbeatAt = scheduleAfter(heartbeatIntervalMs);
+  
+  // Server clock, used to set or correct device time
+  long epoch = 0;
+  if (parseJsonLong(response, "epoch", epoch) && epoch > 0) {
+    lastServerEpoch = (uint32_t)epoch;
+    clockPending = true;
+  }
+  
+  // Fetch the provisioning bundle only when its version changed; it carries
+  // the schedule, so the schedule-only sync is skipped
+  long configVersion = 0;
+  bool bundled = provisioning != nullptr && parseJsonLong(response, "configVersion", configVersion);
+  if (bundled && (uint32_t)configVersion != provisioning->getVersion() && !isQueued(REQ_PROVISION)) {
+    LOG("BackendClient: Config version %lu -> %lu",
+        (unsigned long)provisioning->getVersion(), (unsigned long)configVersion);
+    enqueue(REQ_PROVISION, "/provision/" + macAddress + "?version=" + String(provisioning->getVersion()));
+  }
+  
+  // Fetch the full schedule only when its version changed
+  String version;
+  if (!bundled && parseJsonString(response, "scheduleVersion", version) &&
+      (version != scheduleVersion || !scheduleSynced) && !isQueued(REQ_SCHEDULE_SYNC)) {
+    LOG("BackendClient: Schedule version %s -> %s", 
+        scheduleVersion.length() > 0 ? scheduleVersion.c_str() : "-", version.c_str());
+    enqueue(REQ_SCHEDULE_SYNC, "/api/schedule/" + macAddress);
+  }
+  
+  // Feed command: schedule decision (only while the schedule is not local)
+  // or a queued user command. Expected: {"shouldFeed": true, "durationMs": 5000, "feedId": "..."}
   int shouldFeedIdx = response.indexOf("\"shouldFeed\"");
   if (shouldFeedIdx < 0) {
-    return false;
+    return;
   }
   
   int trueIdx = response.indexOf("true", shouldFeedIdx);
   if (trueIdx < 0 || trueIdx > shouldFeedIdx + 20) {
-    return false;
+    return;
   }
   
-  // Extract duration if present
-  int durationIdx = response.indexOf("\"durationMs\"");
-  if (durationIdx > 0) {
-    int colonIdx = response.indexOf(":", durationIdx);
-    if (colonIdx > 0) {
-      String durStr = response.substring(colonIdx + 1);
-      durStr.trim();
-      int commaIdx = durStr.indexOf(",");
-      int braceIdx = durStr.indexOf("}");
-      int endIdx = (commaIdx > 0 && commaIdx < braceIdx) ? commaIdx : braceIdx;
-      if (endIdx > 0) {
-        durStr = durStr.substring(0, endIdx);
-        durStr.trim();
-        durationMs = durStr.toInt();
-        
-        if (durationMs > 0 && durationMs < 60000) {
-          LOG("BackendClient: Feed approved - duration %lu ms", (unsigned long)durationMs);
-          return true;
-        }
-      }
-    }
+  // Extract duration if present, otherwise use default
+  long duration = 0;
+  if (parseJsonLong(response, "durationMs", duration) && duration > 0 && duration < 60000) {
+    pendingFeedDurationMs = (uint32_t)duration;
+    LOG("BackendClient: Feed approved - duration %lu ms", (unsigned long)pendingFeedDurationMs);
+  } else {
+    pendingFeedDurationMs = 0;
+    LOG("BackendClient: Feed approved - using default duration");
   }
   
-  // No duration specified, use default
-  durationMs = 0;
-  LOG("BackendClient: Feed approved - using default duration");
+  // Correlation ID ties the device stage timestamps to the backend command
+  pendingFeedId = "";
+  parseJsonString(response, "feedId", pendingFeedId);
+  feedReceivedAt = millis();
+  feedCommandPending = true;
+}
+
+bool BackendClient::takeFeedCommand(FeedCommand& cmd) {
+  if (!feedCommandPending) return false;
+  feedCommandPending = false;
+  cmd.durationMs = pendingFeedDurationMs;
+  cmd.id = pendingFeedId;
+  cmd.receivedAt = feedReceivedAt;
   return true;
 }
 
@@ -175,54 +1067,52 @@ void BackendClient::sendLog(const String& level, const String& message, const St
     return;
   }
   
-  // Throttle logs
-  uint32_t now = millis();
-  if (now - lastLogSent < LOG_THROTTLE_MS) {
-    return;
-  }
-  lastLogSent = now;
-  
-  String endpoint = "/logs/ingest?mac=" + macAddress;
-  
-  String body = "{\"level\":\"" + level + "\",\"message\":\"" + message + "\"";
+  // Level and message are escaped: one quote or control character would
+  // otherwise make every heartbeat carrying the event invalid JSON
+  char buf[EVENT_JSON_MAX];
+  JsonWriter json(buf, sizeof(buf));
+  json.beginObject();
+  json.key("level").value(level.c_str());
+  json.key("message").value(message.c_str());
   if (metaJson.length() > 0) {
-    body += ",\"meta\":" + metaJson;
+    json.key("meta").raw(metaJson.c_str());  // Built by the firmware, already JSON
   }
-  body += "}";
-  
-  httpPost(endpoint, body);
-}
-
-bool BackendClient::syncScheduleFromBackend() {
-  if (!isConfigured() || macAddress.length() == 0) {
-    LOG("BackendClient: Cannot sync - not configured or no MAC");
-    return false;
+  json.endObject();
+  if (json.overflowed()) {
+    LOG("BackendClient: Log event exceeds %u bytes - dropped", (unsigned)sizeof(buf));
+    eventsDropped++;
+    return;
   }
+  String event = json.c_str();
   
-  // Throttle sync requests
-  uint32_t now = millis();
-  if (now - lastScheduleSync < SCHEDULE_SYNC_INTERVAL && lastScheduleSync > 0) {
-    LOG("BackendClient: Sync throttled (last sync %lu ms ago)", now - lastScheduleSync);
-    return false;
+  // Buffer full (backend unreachable): drop oldest
+  if (eventCount >= MAX_EVENTS) {
+    for (uint8_t i = 1; i < MAX_EVENTS; i++) {
+      events[i - 1] = events[i];
+    }
+    eventCount = MAX_EVENTS - 1;
+    eventsDropped++;
   }
+  events[eventCount++] = event;
   
-  String endpoint = "/api/schedule/" + macAddress;
-  String response;
-  
-  LOG("BackendClient: Syncing schedule from backend...");
-  
-  if (!httpGet(endpoint, response)) {
-    LOG("BackendClient: Schedule sync failed - HTTP error");
-    return false;
+  // Bring next heartbeat forward so events are not held for a long interval
+  unsigned long flushAt = millis() + EVENT_FLUSH_MS;
+  if ((int32_t)(nextHeartbeatAt - flushAt) > 0) {
+    nextHeartbeatAt = flushAt;
   }
-  
+}
+
+bool BackendClient::takeServerEpoch(uint32_t& utcEpoch) {
+  if (!clockPending) return false;
+  clockPending = false;
+  utcEpoch = lastServerEpoch;
+  return true;
+}
+
+void BackendClient::handleScheduleResponse(const String& response) {
   // Parse JSON response
-  // Expected format: {"schedule": [{"feedTime": "08:30", "durationMs": 3000}, ...]}
-  LOG("BackendClient: Received schedule data: %s", response.c_str());
-  
-  // Simple JSON parsing (looking for feedTime entries)
-  String times = "";
-  int count = 0;
+  // Expected format: {"schedule": [{"feedTime": "08:30", "durationMs": 3000}, ...], "version": "1a2b3c4d"}
+  uint8_t count = 0;
   int pos = 0;
   
   while ((pos = response.indexOf("\"feedTime\"", pos)) >= 0) {
@@ -230,49 +1120,39 @@ bool BackendClient::syncScheduleFromBackend() {
     int quoteStart = response.indexOf("\"", colonPos);
     int quoteEnd = response.indexOf("\"", quoteStart + 1);
     
-    if (quoteStart > 0 && quoteEnd > quoteStart) {
-      String feedTime = response.substring(quoteStart + 1, quoteEnd);
-      if (times.length() > 0) times += ",";
-      times += feedTime;
+    if (quoteStart < 0 || quoteEnd <= quoteStart) break;
+    
+    String feedTime = response.substring(quoteStart + 1, quoteEnd);
+    if (parseFeedTime(feedTime, pendingTimes[count])) {
       count++;
-      LOG("BackendClient: Found feed time: %s", feedTime.c_str());
+    } else {
+      LOG("BackendClient: Ignoring invalid feed time: %s", feedTime.c_str());
     }
     
     pos = quoteEnd + 1;
     if (count >= MAX_FEED_TIMES) break;
   }
   
-  if (count == 0) {
-    LOG("BackendClient: No feed times found in response");
-    return false;
+  // An empty schedule is a valid result (all feeds removed on backend)
+  if (count == 0 && response.indexOf("\"schedule\"") < 0) {
+    LOG("BackendClient: Schedule missing in response");
+    return;
   }
   
-  // Save to NVS
-#if defined(ESP32)
-  Preferences prefs;
-  if (prefs.begin(NVS_NAMESPACE, false)) {
-    prefs.putString("feedTimes", times);
-    prefs.putUInt("feedCount", count);
-    prefs.end();
-    LOG("BackendClient: Saved %d feed times to NVS: %s", count, times.c_str());
-  } else {
-    LOG("BackendClient: Failed to open NVS for writing");
-    return false;
-  }
-#elif defined(ESP8266)
-  // For ESP8266, save to EEPROM (simplified)
-  EEPROM.begin(512);
-  int addr = 200;  // Use offset 200 to avoid WiFi credentials area
-  EEPROM.write(addr++, count);
-  for (unsigned int i = 0; i < times.length() && i < 100; i++) {
-    EEPROM.write(addr++, times[i]);
-  }
-  EEPROM.commit();
-  EEPROM.end();
-  LOG("BackendClient: Saved %d feed times to EEPROM", count);
-#endif
+  parseJsonString(response, "version", scheduleVersion);
+  pendingTimesCount = count;
+  schedulePending = true;
+  scheduleSynced = true;
+  LOG("BackendClient: Schedule sync successful - %u feed times", count);
+}
+
+bool BackendClient::takeSchedule(FeedTime* times, uint8_t& count) {
+  if (!schedulePending) return false;
+  schedulePending = false;
   
-  lastScheduleSync = now;
-  LOG("BackendClient: Schedule sync successful");
+  count = pendingTimesCount;
+  for (uint8_t i = 0; i < count; i++) {
+    times[i] = pendingTimes[i];
+  }
   return true;
 }
@@ -2,36 +2,403 @@
 #define BACKEND_CLIENT_H
 
 #include "Config.h"
+#include "ProvisionManager.h"
 #include <Arduino.h>
 
+#if defined(ESP32)
+  #include <WiFiClientSecure.h>
+  #include <HTTPClient.h>
+#elif defined(ESP8266)
+  #include <WiFiClientSecureBearSSL.h>
+  #include <ESP8266HTTPClient.h>
+#endif
+
+/**
+ * @brief Outbound request classes, in priority order (lower value = higher priority)
+ */
+enum BackendRequestType : uint8_t {
+  REQ_HEARTBEAT     = 0,  // Status + events up, feed decision + versions + clock down
+  REQ_PROVISION     = 1,  // Provisioning bundle, only after its version changed
+  REQ_SCHEDULE_SYNC = 2,  // Schedule only (backends without provisioning bundles)
+  REQ_TYPE_COUNT    = 3
+};
+
+/**
+ * @brief Circuit breaker states
+ */
+enum BreakerState : uint8_t {
+  BREAKER_CLOSED    = 0,  // Normal operation
+  BREAKER_OPEN      = 1,  // Backend considered down, no requests
+  BREAKER_HALF_OPEN = 2   // Cooldown elapsed, one cheap probe allowed
+};
+
+/**
+ * @brief Round-trip time estimator (RFC 6298 style, milliseconds)
+ */
+struct RttEstimator {
+  uint32_t srttMs;      // Smoothed round-trip time
+  uint32_t rttvarMs;    // Round-trip time variation
+  uint32_t samples;     // Successful measurements
+  uint32_t timeouts;    // Attempts that ran into the timeout
+  uint8_t backoff;      // Timeout doublings since the last success
+};
+
+/**
+ * @brief Feed command received with a heartbeat
+ */
+struct FeedCommand {
+  uint32_t durationMs;        // 0 = default
+  String id;                  // Correlation ID from backend (empty if none)
+  unsigned long receivedAt;   // millis() when the heartbeat answer was parsed
+};
+
+/**
+ * @brief Backend endpoint with its health and latency
+ */
+struct BackendEndpoint {
+  String host;
+  uint16_t port;
+  RttEstimator connectRtt;       // Connection setup time, used to rank endpoints
+  uint8_t consecutiveFailures;
+  unsigned long downUntil;       // Skipped until then (0 = healthy)
+  uint32_t requests;
+  uint32_t failures;
+};
+
 /**
  * @brief Backend API client for online mode
  * 
  * Handles communication with remote backend server:
- * - Feed schedule syncing (MAC-based)
- * - Event logging
+ * - One adaptive heartbeat carrying status and buffered events, answered
+ *   with feed command, schedule version and server clock
+ * - Provisioning bundle (settings, schedule, calibration, telemetry rate)
+ *   streamed into ProvisionManager on version change
+ * - Feed schedule syncing on version change (executed locally by OfflineScheduler)
  * - Device identification via MAC address
  * - Token-based authentication
+ * 
+ * All requests go through one outbound scheduler driven by tick():
+ * one request per tick, highest priority first, retried with exponential
+ * backoff and jitter, guarded by a circuit breaker.
+ * 
+ * One keep-alive connection is reused across requests. With HTTPS the
+ * server certificate is pinned and (ESP8266) TLS sessions are resumed,
+ * so a full handshake is only paid after the connection drops.
+ * 
+ * Connect and read timeouts follow measured round-trip times per request
+ * class (srtt + 4 * rttvar, doubled after each timeout), so a dead server
+ * is detected quickly on a good link without cutting off a slow one.
+ * 
+ * Several backend endpoints may be configured (compiled-in list, replaced
+ * by provisioning). Requests go to the fastest healthy endpoint; a request
+ * that fails on one endpoint is retried at once on the next, so failover
+ * costs one request timeout. Standby endpoints are probed occasionally to
+ * keep their latency current.
  */
 class BackendClient {
 private:
+  /**
+   * @brief Per request class policy
+   */
+  struct RequestPolicy {
+    uint16_t timeoutMs;    // Latency budget for one attempt (timeout until RTT is measured)
+    uint8_t maxAttempts;   // Attempts before the request is dropped
+    uint32_t maxAgeMs;     // Queued requests older than this are stale
+  };
+  
+  /**
+   * @brief Queued outbound request
+   */
+  struct PendingRequest {
+    bool used;
+    BackendRequestType type;
+    uint8_t attempts;
+    unsigned long enqueuedAt;
+    unsigned long notBefore;
+    String endpoint;
+    String body;           // Empty for GET
+  };
+  
+  static const uint8_t QUEUE_SIZE = 4;
+  static const uint8_t MAX_ENDPOINTS = 3;
+  static const uint8_t MAX_EVENTS = 8;
+  static const uint16_t EVENT_JSON_MAX = 512;   // One escaped log event
+  static const RequestPolicy POLICIES[REQ_TYPE_COUNT];
+  
   String macAddress;
-  String backendHost;
+  String backendHost;         // Active endpoint
   uint16_t backendPort;
   String authToken;
   bool useHttps;
   int timezoneOffset;
   
-  unsigned long lastFeedCheck;
-  unsigned long lastLogSent;
-  unsigned long lastScheduleSync;
+  PendingRequest queue[QUEUE_SIZE];
+  
+  // Persistent transport (keep-alive)
+  WiFiClient plainClient;
+#if defined(ESP32)
+  WiFiClientSecure secureClient;
+#elif defined(ESP8266)
+  BearSSL::WiFiClientSecure secureClient;
+  BearSSL::Session tlsSession;
+#endif
+  HTTPClient http;
+  
+  bool localScheduleActive;
+  unsigned long nextHeartbeatAt;
+  uint32_t heartbeatIntervalMs;
+  uint32_t minHeartbeatMs;    // Provisioned telemetry rate
+  uint32_t heartbeatCount;
+  bool scheduleSynced;
+  String scheduleVersion;     // Version of the schedule last taken from backend
+  uint32_t lastServerEpoch;
+  uint32_t lastFeedEpoch;
+  ProvisionManager* provisioning;
+  
+  // Events waiting for the next heartbeat (JSON objects)
+  String events[MAX_EVENTS];
+  uint8_t eventCount;
+  uint32_t eventsDropped;
+  
+  // Results waiting to be taken by the main loop
+  bool clockPending;
+  bool feedCommandPending;
+  uint32_t pendingFeedDurationMs;
+  String pendingFeedId;
+  unsigned long feedReceivedAt;
+  bool schedulePending;
+  FeedTime pendingTimes[MAX_FEED_TIMES];
+  uint8_t pendingTimesCount;
+  
+  // Fleet load spreading
+  uint32_t macHash;
+  unsigned long backoffUntil;
+  uint8_t backoffLevel;
+  
+  // Circuit breaker
+  BreakerState breakerState;
+  uint8_t consecutiveFailures;
+  uint8_t breakerTrips;
+  unsigned long breakerOpenUntil;
+  uint32_t requestsSent;
+  uint32_t requestsSucceeded;
+  uint32_t requestsFailed;
+  uint32_t requestsDropped;
+  uint32_t budgetOverruns;
+  
+  // Connection statistics
+  uint32_t connectCount;
+  uint32_t reuseCount;
+  uint32_t handshakeCount;
+  uint32_t handshakeTotalMs;
+  uint32_t lastHandshakeMs;
+  uint32_t pinFailures;
+  
+  // Round-trip time per request class and health probe (active endpoint)
+  RttEstimator rtt[REQ_TYPE_COUNT];
+  RttEstimator probeRtt;
+  
+  // Endpoint list and failover
+  BackendEndpoint endpoints[MAX_ENDPOINTS];
+  uint8_t endpointCount;
+  uint8_t activeEndpoint;
+  uint8_t nextProbeEndpoint;
+  unsigned long nextEndpointProbeAt;
+  uint32_t failoverCount;
+  
+  static const uint32_t HEARTBEAT_INTERVAL_MS = 60000;  // Default when backend gives no hint
+  static const uint32_t HEARTBEAT_FAST_MS = 5000;     // Rate around due feed times
+  static const uint32_t HEARTBEAT_MAX_MS = 900000;    // Never sleep longer than 15 min
+  static const uint32_t FEED_DUE_WINDOW_S = 90;       // "Around due time" window
+  static const uint32_t EVENT_FLUSH_MS = 30000;       // Buffered events wait at most this long
+  static const uint32_t STARTUP_SPREAD_MS = 60000;    // Per-MAC first request offset window
+  static const uint32_t JITTER_PERCENT = 10;          // Random jitter added to periodic timers
+  static const uint32_t BACKOFF_BASE_MS = 30000;      // 503/429 without Retry-After
+  static const uint32_t BACKOFF_MAX_MS = 1800000;     // Cap backoff at 30 min
+  static const uint32_t RETRY_BASE_MS = 2000;         // First retry delay after a failure
+  static const uint8_t BREAKER_THRESHOLD = 3;         // Consecutive failures before opening
+  static const uint32_t BREAKER_COOLDOWN_MS = 30000;  // First open period
+  static const uint32_t BREAKER_COOLDOWN_MAX_MS = 600000;  // Cap open period at 10 min
+  static const uint16_t PROBE_TIMEOUT_MS = 1500;      // Half-open probe budget
+  static const uint16_t TLS_HANDSHAKE_TIMEOUT_MS = 4000;  // Full handshake may exceed request budget
+  static const uint16_t RTO_MIN_MS = 500;             // Never time out faster than this
+  static const uint16_t RTO_MAX_MS = 10000;           // Slow links still get a bounded wait
+  static const uint16_t RTO_GRANULARITY_MS = 100;     // Floor for the variance term
+  static const uint8_t RTO_MAX_BACKOFF = 3;           // Timeout doublings
+  static const uint32_t ENDPOINT_DOWN_MS = 60000;     // Failed endpoint skipped at least this long
+  static const uint32_t ENDPOINT_DOWN_MAX_MS = 600000;  // Cap for repeated failures
+  static const uint32_t ENDPOINT_PROBE_MS = 900000;   // Standby endpoint latency probe period
+  static const uint8_t ENDPOINT_SWITCH_PERCENT = 75;  // Move only to a clearly faster endpoint
+  
+  /**
+   * @brief Perform one HTTP request
+   * @param est RTT estimator of the request class (timeout source, updated with the result)
+   * @param timeoutMs Latency budget, used as timeout until RTT samples exist
+   * @param endpoint Path and query
+   * @param body POST body, empty for GET
+   * @param response Output: response body on 2xx
+   * @param sink Optional: 2xx body is streamed here instead of into response
+   * @return HTTP status code, or negative transport error
+   */
+  int performRequest(RttEstimator& est, uint16_t timeoutMs, const String& endpoint,
+                     const String& body, String& response, Stream* sink = nullptr);
+  
+  /**
+   * @brief Transport used for backend requests (plain or TLS)
+   */
+  WiFiClient& transport();
+  
+  /**
+   * @brief Reuse open connection or connect (and handshake) a new one
+   * @return false on connect, handshake or pin verification failure
+   */
+  bool ensureConnected(uint16_t timeoutMs);
+  
+  /**
+   * @brief Timeout from RTT estimate: srtt + max(G, 4 * rttvar), doubled per backoff
+   * @param fallbackMs Timeout before the first sample
+   */
+  static uint16_t retransmitTimeout(const RttEstimator& est, uint16_t fallbackMs);
+  
+  /**
+   * @brief Add a round-trip sample (successful attempt)
+   */
+  static void sampleRtt(RttEstimator& est, uint32_t sampleMs);
+  
+  /**
+   * @brief Attempt timed out: back off the timeout (no sample, Karn's rule)
+   */
+  static void backoffRtt(RttEstimator& est);
+  
+  /**
+   * @brief Add request to outbound queue
+   * @return false if queue is full and nothing of lower priority could be evicted
+   */
+  bool enqueue(BackendRequestType type, const String& endpoint, const String& body = "");
+  
+  /**
+   * @brief Check if a request of given type is already queued
+   */
+  bool isQueued(BackendRequestType type) const;
+  
+  /**
+   * @brief Pick next request to dispatch (highest priority, oldest first)
+   * @return Queue index, or -1 if nothing is ready
+   */
+  int selectNext();
   
-  static const uint32_t FEED_CHECK_INTERVAL = 60000;  // Check every 60s
-  static const uint32_t LOG_THROTTLE_MS = 5000;       // Max 1 log per 5s
-  static const uint32_t SCHEDULE_SYNC_INTERVAL = 300000;  // Sync every 5 min
+  /**
+   * @brief Dispatch queued request and handle its outcome
+   */
+  void dispatch(int index);
+  
+  /**
+   * @brief Send cheap health probe while breaker is half-open
+   */
+  void probeBackend();
+  
+  /**
+   * @brief Best endpoint: fastest healthy one, list order among unmeasured
+   * @return Endpoint index (earliest to recover if none is healthy)
+   */
+  uint8_t pickEndpoint() const;
+  
+  /**
+   * @brief Point the transport at an endpoint
+   * @param resetStats Drop per-class RTT estimates (they belong to the old path)
+   */
+  void useEndpoint(uint8_t index, bool resetStats);
   
-  bool httpGet(const String& endpoint, String& response);
-  bool httpPost(const String& endpoint, const String& body);
+  /**
+   * @brief Mark active endpoint down and move to the next best one
+   * @return true if another healthy endpoint took over
+   */
+  bool failoverEndpoint();
+  
+  /**
+   * @brief Move to a clearly faster healthy endpoint, if any
+   */
+  void reevaluateEndpoint();
+  
+  /**
+   * @brief Measure one standby endpoint with a health probe
+   */
+  void probeStandbyEndpoint();
+  
+  void recordSuccess();
+  void recordFailure();
+  
+  /**
+   * @brief Stop sending requests for an exponentially growing cooldown
+   */
+  void openBreaker();
+  
+  /**
+   * @brief Build heartbeat body from current status and buffered events
+   * @param included Output: number of buffered events in the body
+   */
+  String buildHeartbeatBody(uint8_t& included);
+  
+  void handleHeartbeatResponse(const String& response, uint8_t eventsSent);
+  
+  /**
+   * @brief Remove the oldest buffered events (sent, or rejected by the backend)
+   */
+  void dropEvents(uint8_t count);
+  void handleScheduleResponse(const String& response);
+  
+  /**
+   * @brief Fetch provisioning bundle straight into ProvisionManager
+   * @return HTTP status code, or negative transport / parse error
+   */
+  int fetchProvisioning(uint16_t timeoutMs, const String& endpoint);
+  
+  /**
+   * @brief Read an integer JSON field (simple indexOf parser)
+   * @return false if the field is missing or null
+   */
+  static bool parseJsonLong(const String& json, const char* key, long& value);
+  static bool parseJsonString(const String& json, const char* key, String& value);
+  
+  /**
+   * @brief Parse "HH:MM" into a FeedTime
+   * @return false if the string is not a valid time of day
+   */
+  static bool parseFeedTime(const String& str, FeedTime& out);
+  
+  /**
+   * @brief Pick next heartbeat interval from backend hints
+   * @param nextFeedInSec Seconds until next scheduled feed (-1 if unknown)
+   * @param suggestedSec Server suggested interval (0 if none)
+   * @param attended User has the device open in the UI (telemetry floor not applied)
+   */
+  void updateHeartbeatInterval(long nextFeedInSec, long suggestedSec, bool attended);
+  
+  /**
+   * @brief Deterministic per-MAC offset in [0, periodMs)
+   */
+  uint32_t phaseOffset(uint32_t periodMs) const;
+  
+  /**
+   * @brief Next deadline for a periodic timer: now + interval + random jitter
+   */
+  static unsigned long scheduleAfter(uint32_t intervalMs);
+  
+  /**
+   * @brief Check if a millis() deadline has passed (rollover safe)
+   */
+  static bool isDue(unsigned long deadline) { return (int32_t)(millis() - deadline) >= 0; }
+  
+  /**
+   * @brief Handle server overload response (503/429) and honour Retry-After
+   * @param retryAfter Value of the Retry-After header (seconds), may be empty
+   */
+  void enterBackoff(const String& retryAfter);
+  
+  /**
+   * @brief Check if requests are suppressed by server backoff
+   */
+  bool inBackoff() const { return backoffUntil != 0 && !isDue(backoffUntil); }
   
 public:
   BackendClient();
@@ -45,38 +412,167 @@ public:
    */
   void begin(const String& host, uint16_t port, const String& token, bool https = false);
   
+  /**
+   * @brief Leave online mode: drop queued requests and undelivered results,
+   *        close the connection (counters and buffered events are kept)
+   * 
+   * tick() does nothing until begin() is called again.
+   */
+  void stop();
+  
+  /**
+   * @brief Run outbound scheduler (call in loop)
+   * Enqueues due periodic requests and dispatches at most one request.
+   */
+  void tick();
+  
   /**
    * @brief Set timezone offset in minutes
    */
   void setTimezoneOffset(int offsetMinutes);
   
+  /**
+   * @brief Attach provisioning bundle receiver
+   * 
+   * With a receiver attached, bundle version changes reported in the
+   * heartbeat are fetched as one bundle instead of a schedule-only sync.
+   */
+  void setProvisioning(ProvisionManager* manager) { provisioning = manager; }
+  
+  /**
+   * @brief Lower bound for the heartbeat interval outside feed due windows
+   * @param ms Provisioned telemetry interval (0 = no limit)
+   */
+  void setMinHeartbeatMs(uint32_t ms) { minHeartbeatMs = ms; }
+  
   /**
    * @brief Get device MAC address
    */
   String getMacAddress() const { return macAddress; }
   
   /**
-   * @brief Sync feed schedule from backend (MAC-based)
-   * Downloads schedule and saves to NVS
-   * @return true if sync successful
+   * @brief Tell backend whether the schedule runs locally
+   * 
+   * While false, the backend decides feeds on each heartbeat and shortens
+   * the interval around due times.
    */
-  bool syncScheduleFromBackend();
+  void setLocalScheduleActive(bool active) { localScheduleActive = active; }
   
   /**
-   * @brief Check if it's time to feed (from backend schedule)
-   * @param durationMs Output: feed duration in milliseconds
-   * @return true if should feed now
+   * @brief Report time of the last feed (UTC epoch) in the heartbeat
    */
-  bool checkFeedSchedule(uint32_t& durationMs);
+  void setLastFeedEpoch(uint32_t epoch) { lastFeedEpoch = epoch; }
   
   /**
-   * @brief Send log event to backend
+   * @brief Take feed command received from backend
+   * @param cmd Output: duration, correlation ID and receive time
+   * @return true if a feed command was pending
+   */
+  bool takeFeedCommand(FeedCommand& cmd);
+  
+  /**
+   * @brief Take schedule received from backend
+   * @param times Output: parsed feed times (MAX_FEED_TIMES capacity)
+   * @param count Output: number of parsed feed times
+   * @return true if a new sync result was pending
+   */
+  bool takeSchedule(FeedTime* times, uint8_t& count);
+  
+  /**
+   * @brief Check if at least one schedule sync succeeded since boot
+   */
+  bool hasSyncedSchedule() const { return scheduleSynced; }
+  
+  /**
+   * @brief Take server clock received with the last heartbeat
+   * @param utcEpoch Output: UTC epoch in seconds
+   * @return true if a new value was pending
+   */
+  bool takeServerEpoch(uint32_t& utcEpoch);
+  
+  /**
+   * @brief Current heartbeat interval in milliseconds
+   */
+  uint32_t getHeartbeatIntervalMs() const { return heartbeatIntervalMs; }
+  
+  /**
+   * @brief Number of heartbeats sent since boot
+   */
+  uint32_t getHeartbeatCount() const { return heartbeatCount; }
+  
+  /**
+   * @brief Buffer log event, sent with the next heartbeat
    * @param level Log level (info, warning, error)
    * @param message Log message
    * @param metaJson Optional JSON metadata
    */
   void sendLog(const String& level, const String& message, const String& metaJson = "");
   
+  /**
+   * @brief Number of requests waiting in the outbound queue
+   */
+  uint8_t getQueueDepth() const;
+  
+  /**
+   * @brief Events waiting for the next heartbeat / dropped on overflow
+   */
+  uint8_t getPendingEvents() const { return eventCount; }
+  uint32_t getEventsDropped() const { return eventsDropped; }
+  
+  /**
+   * @brief Circuit breaker state
+   */
+  BreakerState getBreakerState() const { return breakerState; }
+  const char* getBreakerStateString() const;
+  
+  /**
+   * @brief Request counters since boot
+   */
+  uint32_t getRequestsSent() const { return requestsSent; }
+  uint32_t getRequestsSucceeded() const { return requestsSucceeded; }
+  uint32_t getRequestsFailed() const { return requestsFailed; }
+  uint32_t getRequestsDropped() const { return requestsDropped; }
+  uint32_t getBudgetOverruns() const { return budgetOverruns; }
+  
+  /**
+   * @brief Connection statistics since boot
+   */
+  uint32_t getConnectCount() const { return connectCount; }
+  uint32_t getReuseCount() const { return reuseCount; }
+  uint32_t getHandshakeCount() const { return handshakeCount; }
+  uint32_t getLastHandshakeMs() const { return lastHandshakeMs; }
+  uint32_t getAvgHandshakeMs() const { return handshakeCount > 0 ? handshakeTotalMs / handshakeCount : 0; }
+  uint32_t getPinFailures() const { return pinFailures; }
+  bool isSecure() const { return useHttps; }
+  
+  /**
+   * @brief Round-trip statistics and current timeouts
+   */
+  const RttEstimator& getRtt(BackendRequestType type) const { return rtt[type]; }
+  const RttEstimator& getConnectRtt() const { return endpoints[activeEndpoint].connectRtt; }
+  uint16_t getTimeoutMs(BackendRequestType type) const { return retransmitTimeout(rtt[type], POLICIES[type].timeoutMs); }
+  uint16_t getConnectTimeoutMs() const;
+  
+  /**
+   * @brief Replace backend endpoint list
+   * @param list Comma separated "host:port" entries in preference order
+   * @return false if the list has no valid entry (current list is kept)
+   */
+  bool setEndpoints(const String& list);
+  
+  /**
+   * @brief Endpoint list, active endpoint and failovers since boot
+   */
+  uint8_t getEndpointCount() const { return endpointCount; }
+  const BackendEndpoint& getEndpoint(uint8_t index) const { return endpoints[index]; }
+  uint8_t getActiveEndpoint() const { return activeEndpoint; }
+  uint32_t getFailoverCount() const { return failoverCount; }
+  
+  /**
+   * @brief Check if an endpoint is currently usable (not in its down period)
+   */
+  bool isEndpointHealthy(uint8_t index) const;
+  
   /**
    * @brief Check if backend is configured
    */
@@ -10,15 +10,41 @@
 // ================== Debug Configuration ==================
 #define DEBUG_ENABLED 1
 
-#if DEBUG_ENABLED
-  #define LOG(fmt, ...) do { \
-    char __buf[160]; \
-    snprintf(__buf, sizeof(__buf), "[%lu] " fmt, millis(), ##__VA_ARGS__); \
-    Serial.println(__buf); \
-  } while(0)
-#else
-  #define LOG(fmt, ...) ((void)0)
+// LOG() / LOGE() / LOGW() / LOGD() queue a record into a ring that a
+// low-priority task formats and prints (Logger.h); LOG_ASYNC 0 formats
+// and prints in place
+#ifndef LOG_ASYNC
+  #define LOG_ASYNC         1
 #endif
+#ifndef LOG_BINARY
+  #define LOG_BINARY        0     // 1 = undecoded records on the UART, decode with tools/log_decode.py
+#endif
+#define LOG_RING_SLOTS      32    // Queued records; more are dropped and counted
+#define LOG_RECORD_ARGS     48    // Argument bytes per record, %s text included
+#define LOG_LINE_MAX        160   // Formatted line
+#define LOG_TASK_PRIORITY   1     // Drain task (ESP32, core 0), below the WiFi and TCP tasks
+#define LOG_TASK_STACK      3072
+#define LOG_DRAIN_IDLE_MS   10    // Drain task sleep while the ring is empty
+#define LOG_DEFAULT_LEVEL   LOG_LEVEL_INFO  // Runtime level at boot (LOGLEVEL serial command)
+
+// Compile-time ceiling per module (LogModule order): lines above it are
+// not in the image at all
+#define LOG_COMPILE_LEVELS { \
+  LOG_LEVEL_DEBUG,  /* MAIN    */ \
+  LOG_LEVEL_DEBUG,  /* MODE    */ \
+  LOG_LEVEL_DEBUG,  /* SERVO   */ \
+  LOG_LEVEL_DEBUG,  /* TIME    */ \
+  LOG_LEVEL_DEBUG,  /* SCHED   */ \
+  LOG_LEVEL_DEBUG,  /* WIFI    */ \
+  LOG_LEVEL_DEBUG,  /* WEB     */ \
+  LOG_LEVEL_DEBUG,  /* BACKEND */ \
+  LOG_LEVEL_DEBUG,  /* PROV    */ \
+  LOG_LEVEL_DEBUG,  /* OTA     */ \
+  LOG_LEVEL_DEBUG,  /* RADIO   */ \
+  LOG_LEVEL_DEBUG   /* TRACE   */ \
+}
+
+#include "Logger.h"
 
 // ================== Hardware Configuration ==================
 #define BAUDRATE 115200
@@ -57,18 +83,69 @@
 #define DNS_PORT            53
 #define CAPTIVE_PORTAL_URL  "http://feeder.local/"
 
+// Radio policy: setup AP and captive DNS only while needed, modem sleep when online
+#define RADIO_POLICY_TICK_MS      500
+#define RADIO_AP_FALLBACK_MS      30000   // Station down this long brings the AP back
+#define RADIO_AP_LINGER_MS        120000  // AP kept this long after it was last needed or used
+#define RADIO_AP_BUTTON_MS        600000  // AP window after a portal request (button / PORTAL)
+#define RADIO_PORTAL_BUTTON_PIN   -1      // Active-low button that opens the portal, -1 = none
+#define RADIO_BUTTON_DEBOUNCE_MS  50
+
+// Station connect (non-blocking, see WiFiManager::maintain())
+#define WIFI_FAST_CONNECT_MS    3000    // Attempt on the cached BSSID/channel before a full scan
+#define WIFI_CONNECT_TIMEOUT_MS 20000   // Full attempt (scan + association)
+#define WIFI_DHCP_TIMEOUT_MS    5000    // Associated but no IP this long counts as failed
+#define WIFI_BACKOFF_MIN_MS     1000    // Retry delay after the first failed full attempt, doubled up to max
+#define WIFI_BACKOFF_MAX_MS     60000
+#define WIFI_REUSE_LEASE        0       // 1 = fast reconnect reuses the last IP as static config (no DHCP)
+
+// Web Portal (async server, API handlers run from loop())
+#define WEB_MAX_PENDING       AP_MAX_CONNECTIONS  // Queued API requests across all clients
+#define WEB_MAX_PER_CLIENT    2      // In-flight API requests per client IP (429 beyond)
+#define WEB_WORKER_BUDGET_MS  20     // Max time per loop() spent running API handlers
+#define WEB_QUEUE_TIMEOUT_MS  5000   // Queued request answered 503 if not run by then
+#define WEB_RESPONSE_MAX      2048   // Response buffer per queue slot (no heap use per request)
+
+// Live status stream (Server-Sent Events, up to AP_MAX_CONNECTIONS subscribers)
+#define LIVE_EVENTS_PATH      "/api/events"
+#define LIVE_SAMPLE_MS        100    // Device state checked for changes this often
+#define LIVE_MAX_BACKLOG      2      // Unsent packets before a subscriber's updates are held back
+#define LIVE_RSSI_STEP_DB     5      // RSSI pushed in 5 dB steps
+
+// Loop profiler (STATUS, /api/metrics): per-module time from the CPU cycle counter
+#define PROFILE_ENABLED         1
+#define PROFILE_SUB_BUCKET_BITS 2      // 4 histogram buckets per power of two (values within 25%)
+#define PROFILE_MAX_US_BITS     24     // Histogram range up to 2^24 us (16.7 s), longer counted in the last bucket
+#define PROFILE_STALL_US        50000  // Loop iteration this long is a stall (logged, kept with its culprit)
+#define PROFILE_STALL_EVENTS    8      // Most recent stalls kept
+
 // Backend API Configuration (for online mode)
 #define BACKEND_HOST        "192.168.1.100"
 #define BACKEND_PORT        8082
 #define BACKEND_ENABLED     true
 #define BACKEND_USE_HTTPS   false
 #define BACKEND_AUTH_TOKEN  "your_device_token_here"  // Change this to your actual token
+#define BACKEND_FALLBACKS   ""  // Extra backends "host:port,host:port", after BACKEND_HOST
+#define BACKEND_TLS_FINGERPRINT ""  // Server cert fingerprint: SHA-256 (ESP32) / SHA-1 (ESP8266), hex
+#define BACKEND_TLS_CA_CERT     ""  // PEM CA certificate (ESP32, takes precedence over fingerprint)
 #define REACT_APP_URL       "http://192.168.1.100:5173"  // React frontend URL (Vite dev server)
+#define CLOCK_MAX_DRIFT_S   5    // Correct device clock from heartbeat beyond this drift
+#define FEED_TRACE_TIMEOUT_MS 120000UL  // Feed trace reported incomplete if the lid has not closed by then
+
+// OTA Firmware Updates (ESP32, online mode)
+#define OTA_ENABLED             true
+#define OTA_CHECK_INTERVAL_MS   21600000UL  // Check backend for new firmware every 6 h
+#define OTA_HEALTH_TIMEOUT_MS   600000UL    // New image must prove healthy within 10 min
+#define OTA_HEALTH_UPTIME_MS    60000UL     // New image healthy after 1 min of loop(), any mode
+// ECDSA P-256 public key (PEM) used to verify firmware signatures; empty disables OTA
+#define OTA_SIGNING_PUBLIC_KEY  ""
 
 // ================== Storage Configuration ==================
 #define NVS_NAMESPACE       "feeder"
 #define NVS_VERSION         2
 #define MAX_FEED_TIMES      8
+#define PROVISION_MAX_BYTES 4096  // Larger provisioning bundles are rejected
+#define PROVISION_BACKENDS_LEN 128  // Provisioned backend list ("host:port,...")
 
 // ================== Operation Modes ==================
 enum OperationMode {
@@ -121,6 +198,22 @@ struct ScheduleConfig {
   uint16_t lastRunMinute[MAX_FEED_TIMES];
 };
 
+/**
+ * @brief Provisioning bundle pulled from backend (applied and persisted as one unit)
+ */
+struct ProvisionConfig {
+  uint32_t version;           // Bundle version from backend, 0 = never provisioned
+  FeedTime times[MAX_FEED_TIMES];
+  uint8_t timesCount;
+  uint8_t excludeDaysBitmap;
+  uint16_t servoAngle;
+  uint32_t openHoldMs;
+  uint16_t servoClosedUs;     // Actuator calibration
+  uint16_t servoOpenUs;
+  uint32_t telemetryMs;       // Minimum heartbeat interval, 0 = no limit
+  char backends[PROVISION_BACKENDS_LEN];  // Backend endpoints, empty = compiled-in list
+};
+
 struct DeviceConfig {
   OperationMode mode;
   bool modeSelected;
@@ -0,0 +1,88 @@
+#define LOG_MODULE LOG_MOD_TRACE
+#include "FeedTracer.h"
+
+FeedTracer::FeedTracer()
+  : active(false)
+  , accepted(false)
+  , receivedAt(0)
+  , dequeuedAt(0)
+  , startedAt(0)
+  , openedAt(0)
+  , closedAt(0)
+  , receivedEpochMs(0) {
+}
+
+void FeedTracer::begin(const String& id, uint32_t receivedAtMs, uint64_t utcNowMs) {
+  uint32_t now = millis();
+  
+  // A newer command supersedes an unfinished trace
+  if (active) {
+    LOG("FeedTracer: Trace %s superseded", feedId.c_str());
+  }
+  
+  feedId = id;
+  active = true;
+  accepted = false;
+  receivedAt = receivedAtMs;
+  dequeuedAt = now;
+  startedAt = 0;
+  openedAt = 0;
+  closedAt = 0;
+  receivedEpochMs = utcNowMs > 0 ? utcNowMs - (now - receivedAtMs) : 0;
+}
+
+void FeedTracer::actuatorStarted(const ServoController& servo) {
+  if (!active) return;
+  
+  startedAt = millis();
+  accepted = servo.getState() == MOTOR_OPENING;
+}
+
+bool FeedTracer::tick(const ServoController& servo, String& metaJson) {
+  if (!active) return false;
+  
+  uint32_t now = millis();
+  if (accepted) {
+    // Stamps are taken by the servo state machine, not at loop granularity
+    if (openedAt == 0 && (int32_t)(servo.getOpenedAt() - startedAt) >= 0 && servo.getState() != MOTOR_OPENING) {
+      openedAt = servo.getOpenedAt();
+    }
+    if (openedAt != 0 && servo.isIdle() && (int32_t)(servo.getClosedAt() - openedAt) >= 0) {
+      closedAt = servo.getClosedAt();
+    } else if (now - startedAt < FEED_TRACE_TIMEOUT_MS) {
+      return false;
+    }
+  }
+  
+  active = false;
+  metaJson = buildMeta();
+  
+  LOG("FeedTracer: %s - dequeue %ld ms, start %ld ms, open %ld ms, closed %ld ms%s",
+      feedId.c_str(), (long)(dequeuedAt - receivedAt),
+      startedAt ? (long)(startedAt - receivedAt) : -1L,
+      openedAt ? (long)(openedAt - receivedAt) : -1L,
+      closedAt ? (long)(closedAt - receivedAt) : -1L,
+      accepted ? "" : " (servo busy)");
+  return true;
+}
+
+String FeedTracer::buildMeta() const {
+  String meta;
+  meta.reserve(192);
+  meta = "{\"feedId\":\"" + feedId + "\"";
+  if (receivedEpochMs > 0) {
+    // String has no 64-bit constructor on every core: seconds and milliseconds
+    meta += ",\"receivedAt\":" + String((unsigned long)(receivedEpochMs / 1000));
+    char ms[4];
+    snprintf(ms, sizeof(ms), "%03u", (unsigned int)(receivedEpochMs % 1000));
+    meta += ms;
+  }
+  meta += ",\"dequeueMs\":" + String((unsigned long)(dequeuedAt - receivedAt));
+  if (startedAt) meta += ",\"startMs\":" + String((unsigned long)(startedAt - receivedAt));
+  if (openedAt) meta += ",\"openMs\":" + String((unsigned long)(openedAt - receivedAt));
+  if (closedAt) meta += ",\"closeMs\":" + String((unsigned long)(closedAt - receivedAt));
+  meta += ",\"result\":\"";
+  meta += !accepted ? "busy" : (closedAt ? "ok" : "timeout");
+  meta += "\"}";
+  return meta;
+}
@@ -0,0 +1,70 @@
+#ifndef FEED_TRACER_H
+#define FEED_TRACER_H
+
+#include "Config.h"
+#include "ServoController.h"
+#include <Arduino.h>
+
+/**
+ * @brief Stage timestamps of one backend feed command
+ * 
+ * Follows a feed command from the heartbeat answer to the closed lid:
+ *   received  - heartbeat answer parsed (BackendClient)
+ *   dequeued  - command taken by the main loop
+ *   started   - ServoController::open() accepted
+ *   opened    - lid reached open position
+ *   closed    - lid back at closed position
+ * 
+ * Stages are taken from millis() (exact offsets); the received stage is
+ * also stamped with the synced UTC clock so traces line up with the
+ * backend's command timestamps. The finished trace is one JSON object,
+ * sent as a FEED_TRACE event with the correlation ID of the command.
+ */
+class FeedTracer {
+private:
+  String feedId;
+  bool active;
+  bool accepted;          // Servo took the command (false = busy)
+  uint32_t receivedAt;
+  uint32_t dequeuedAt;
+  uint32_t startedAt;
+  uint32_t openedAt;
+  uint32_t closedAt;
+  uint64_t receivedEpochMs;  // 0 = device clock not set
+  
+  /**
+   * @brief Build FEED_TRACE meta: stage offsets in ms relative to received
+   */
+  String buildMeta() const;
+  
+public:
+  FeedTracer();
+  
+  /**
+   * @brief Start a trace for a command taken by the main loop
+   * @param id Correlation ID from backend
+   * @param receivedAtMs millis() when the command arrived
+   * @param utcNowMs Synced UTC time now (0 if unknown)
+   */
+  void begin(const String& id, uint32_t receivedAtMs, uint64_t utcNowMs);
+  
+  /**
+   * @brief Record the actuator start (call right after ServoController::open())
+   * @param servo Servo controller, checked for accepting the command
+   */
+  void actuatorStarted(const ServoController& servo);
+  
+  /**
+   * @brief Follow the lid until it closed (call in loop)
+   * @param metaJson Output: finished trace
+   * @return true once, when the trace is finished
+   */
+  bool tick(const ServoController& servo, String& metaJson);
+  
+  /**
+   * @brief Check if a command is being traced
+   */
+  bool isActive() const { return active; }
+};
+
+#endif // FEED_TRACER_H
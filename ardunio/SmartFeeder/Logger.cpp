@@ -0,0 +1,435 @@
+#include "Config.h"
+
+#if LOG_ASYNC
+
+#include <stdarg.h>
+#include <stddef.h>
+
+Logger logger;
+
+uint8_t Logger::levels[LOG_MOD_COUNT] = {
+  LOG_DEFAULT_LEVEL, LOG_DEFAULT_LEVEL, LOG_DEFAULT_LEVEL, LOG_DEFAULT_LEVEL,
+  LOG_DEFAULT_LEVEL, LOG_DEFAULT_LEVEL, LOG_DEFAULT_LEVEL, LOG_DEFAULT_LEVEL,
+  LOG_DEFAULT_LEVEL, LOG_DEFAULT_LEVEL, LOG_DEFAULT_LEVEL, LOG_DEFAULT_LEVEL
+};
+static_assert(LOG_MOD_COUNT == 12, "Logger::levels needs one entry per module");
+
+static const char* const MODULE_NAMES[LOG_MOD_COUNT] = {
+  "MAIN", "MODE", "SERVO", "TIME", "SCHED", "WIFI",
+  "WEB", "BACKEND", "PROV", "OTA", "RADIO", "TRACE"
+};
+
+// Binary frame: sync, length, then ms, format address, module, level, args
+static const uint8_t FRAME_SYNC_0 = 0xA5;
+static const uint8_t FRAME_SYNC_1 = 0x5A;
+static const uint8_t FRAME_HEADER = 10;
+
+/**
+ * @brief One printf conversion: what it consumes and how to print it again
+ */
+struct LogSpec {
+  char text[16];     // "%-08lu", passed to snprintf when formatting
+  char conversion;   // d u x s f ... ('%' for a literal percent, 0 if malformed)
+  char length;       // 0, 'H' (hh), 'h', 'l', 'L' (ll), 'z', 'j', 't'
+  uint8_t stars;     // '*' width / precision, each an int argument
+};
+
+/**
+ * @brief Parse the conversion starting at p ('%'); returns the first char after it
+ */
+static const char* parseSpec(const char* p, LogSpec& spec) {
+  const char* start = p++;
+  spec.stars = 0;
+  spec.length = 0;
+  spec.conversion = 0;
+  
+  while (*p && strchr("-+ #0", *p)) p++;
+  if (*p == '*') { spec.stars++; p++; }
+  while (*p >= '0' && *p <= '9') p++;
+  if (*p == '.') {
+    p++;
+    if (*p == '*') { spec.stars++; p++; }
+    while (*p >= '0' && *p <= '9') p++;
+  }
+  
+  if (*p == 'h') {
+    spec.length = 'h';
+    if (*++p == 'h') { spec.length = 'H'; p++; }
+  } else if (*p == 'l') {
+    spec.length = 'l';
+    if (*++p == 'l') { spec.length = 'L'; p++; }
+  } else if (*p == 'z' || *p == 'j' || *p == 't' || *p == 'L') {
+    spec.length = *p == 'L' ? 'L' : *p;
+    p++;
+  }
+  
+  if (*p && strchr("diuoxXcspfFeEgGaA%", *p)) {
+    spec.conversion = *p++;
+  }
+  
+  size_t len = p - start;
+  if (len >= sizeof(spec.text)) {
+    spec.conversion = 0;
+    len = 0;
+  }
+  memcpy(spec.text, start, len);
+  spec.text[len] = '\0';
+  return p;
+}
+
+/**
+ * @brief Size of the value a conversion takes from the argument list (0 for %s / %%)
+ */
+static size_t argSize(const LogSpec& spec) {
+  switch (spec.conversion) {
+    case 'd': case 'i': case 'u': case 'o': case 'x': case 'X':
+      switch (spec.length) {
+        case 'l': return sizeof(long);
+        case 'L': return sizeof(long long);
+        case 'z': return sizeof(size_t);
+        case 'j': return sizeof(intmax_t);
+        case 't': return sizeof(ptrdiff_t);
+        default:  return sizeof(int);
+      }
+    case 'c':
+      return sizeof(int);
+    case 'p':
+      return sizeof(void*);
+    case 'f': case 'F': case 'e': case 'E': case 'g': case 'G': case 'a': case 'A':
+      return sizeof(double);
+    default:
+      return 0;
+  }
+}
+
+template <typename T>
+static int printArg(char* out, size_t size, const LogSpec& spec, const int* stars, T value) {
+  switch (spec.stars) {
+    case 0:  return snprintf(out, size, spec.text, value);
+    case 1:  return snprintf(out, size, spec.text, stars[0], value);
+    default: return snprintf(out, size, spec.text, stars[0], stars[1], value);
+  }
+}
+
+void Logger::begin() {
+#if defined(ESP32)
+  // Core 0 next to the WiFi and TCP tasks, below them; loop() runs on core 1
+  xTaskCreatePinnedToCore(drainTask, "log", LOG_TASK_STACK, this, LOG_TASK_PRIORITY, nullptr, 0);
+#endif
+}
+
+#if defined(ESP32)
+void Logger::drainTask(void* arg) {
+  Logger* self = (Logger*)arg;
+  for (;;) {
+    if (self->drain(LOG_RING_SLOTS) == 0) {
+      vTaskDelay(pdMS_TO_TICKS(LOG_DRAIN_IDLE_MS));
+    }
+  }
+}
+#endif
+
+bool Logger::claim(uint32_t& index) {
+#if defined(ESP32)
+  uint32_t h = head.load(std::memory_order_relaxed);
+  do {
+    if (h - tail.load(std::memory_order_acquire) >= LOG_RING_SLOTS) return false;
+  } while (!head.compare_exchange_weak(h, h + 1, std::memory_order_acq_rel, std::memory_order_relaxed));
+  index = h;
+#else
+  // Single task: only an interrupt could race, and none logs
+  if (head - tail >= LOG_RING_SLOTS) return false;
+  index = head;
+  head = index + 1;
+#endif
+  
+  uint8_t depth = (uint8_t)(index + 1 - tail);
+  if (depth > highWater) highWater = depth;
+  return true;
+}
+
+void Logger::write(uint8_t module, uint8_t level, const char* fmt, ...) {
+  uint32_t start = micros();
+  
+  uint32_t index;
+  bool claimed = claim(index);
+  if (!claimed && blocking) {
+    // Multi-line dumps (STATUS) wait for the drain instead of losing lines
+    unsigned long waitStart = millis();
+    while (!claimed && millis() - waitStart < 1000) {
+#if defined(ESP32)
+      delay(1);
+#else
+      drainOne(true);
+#endif
+      claimed = claim(index);
+    }
+    start = micros();
+  }
+  if (!claimed) {
+    dropped++;
+    return;
+  }
+  
+  Record& r = ring[index % LOG_RING_SLOTS];
+  r.module = module;
+  r.level = level;
+  r.ms = millis();
+  r.fmt = fmt;
+  
+  // Copy the raw arguments in format order; formatting happens in the drain
+  va_list ap;
+  va_start(ap, fmt);
+  size_t used = 0;
+  bool full = false;
+  for (const char* p = fmt; *p && !full; ) {
+    if (*p != '%') {
+      p++;
+      continue;
+    }
+    
+    LogSpec spec;
+    p = parseSpec(p, spec);
+    if (spec.conversion == 0 || spec.conversion == '%') continue;
+    
+    for (uint8_t s = 0; s < spec.stars; s++) {
+      int star = va_arg(ap, int);
+      if (used + sizeof(star) > LOG_RECORD_ARGS) { full = true; break; }
+      memcpy(r.args + used, &star, sizeof(star));
+      used += sizeof(star);
+    }
+    if (full) break;
+    
+    if (spec.conversion == 's') {
+      const char* str = va_arg(ap, const char*);
+      if (!str) str = "(null)";
+      size_t room = LOG_RECORD_ARGS - used;
+      if (room == 0) { full = true; break; }
+      size_t len = strlen(str);
+      if (len >= room) {
+        len = room - 1;
+        truncated++;
+      }
+      memcpy(r.args + used, str, len);
+      r.args[used + len] = '\0';
+      used += len + 1;
+      continue;
+    }
+    
+    size_t size = argSize(spec);
+    if (used + size > LOG_RECORD_ARGS) { full = true; break; }
+    
+    // Same promoted type the callee would read; stored as raw bytes
+    if (spec.conversion == 'p') {
+      void* v = va_arg(ap, void*);
+      memcpy(r.args + used, &v, size);
+    } else if (size == sizeof(double) && strchr("fFeEgGaA", spec.conversion)) {
+      double v = va_arg(ap, double);
+      memcpy(r.args + used, &v, size);
+    } else if (size == sizeof(long long)) {
+      long long v = va_arg(ap, long long);
+      memcpy(r.args + used, &v, size);
+    } else if (size == sizeof(long)) {
+      long v = va_arg(ap, long);
+      memcpy(r.args + used, &v, size);
+    } else {
+      int v = va_arg(ap, int);
+      memcpy(r.args + used, &v, size);
+    }
+    used += size;
+  }
+  va_end(ap);
+  if (full) truncated++;
+  r.argBytes = (uint8_t)used;
+  
+#if defined(ESP32)
+  r.state.store(SLOT_READY, std::memory_order_release);
+#else
+  r.state = SLOT_READY;
+#endif
+  
+  uint32_t us = micros() - start;
+  writeUsTotal += us;
+  timedWrites++;
+  if (us > maxWriteUs) maxWriteUs = us;
+}
+
+size_t Logger::format(const Record& r, char* out, size_t size) {
+  int n = snprintf(out, size, "[%lu] ", (unsigned long)r.ms);
+  size_t len = n > 0 ? (size_t)n : 0;
+  size_t used = 0;
+  
+  for (const char* p = r.fmt; *p && len + 1 < size; ) {
+    if (*p != '%') {
+      out[len++] = *p++;
+      continue;
+    }
+    
+    LogSpec spec;
+    p = parseSpec(p, spec);
+    if (spec.conversion == '%') {
+      out[len++] = '%';
+      continue;
+    }
+    if (spec.conversion == 0) continue;
+    
+    int stars[2] = { 0, 0 };
+    for (uint8_t s = 0; s < spec.stars && s < 2; s++) {
+      if (used + sizeof(int) > r.argBytes) break;
+      memcpy(&stars[s], r.args + used, sizeof(int));
+      used += sizeof(int);
+    }
+    
+    // Arguments cut off at write time: mark the gap and stop
+    size_t need = spec.conversion == 's' ? 1 : argSize(spec);
+    if (used + need > r.argBytes) {
+      n = snprintf(out + len, size - len, "...");
+      len += n > 0 ? (size_t)n : 0;
+      break;
+    }
+    
+    if (spec.conversion == 's') {
+      const char* str = (const char*)(r.args + used);
+      used += strlen(str) + 1;
+      n = printArg(out + len, size - len, spec, stars, str);
+    } else if (spec.conversion == 'p') {
+      void* v;
+      memcpy(&v, r.args + used, sizeof(v));
+      n = printArg(out + len, size - len, spec, stars, v);
+    } else if (need == sizeof(double) && strchr("fFeEgGaA", spec.conversion)) {
+      double v;
+      memcpy(&v, r.args + used, sizeof(v));
+      n = printArg(out + len, size - len, spec, stars, v);
+    } else if (need == sizeof(long long)) {
+      long long v;
+      memcpy(&v, r.args + used, sizeof(v));
+      n = printArg(out + len, size - len, spec, stars, v);
+    } else if (need == sizeof(long)) {
+      long v;
+      memcpy(&v, r.args + used, sizeof(v));
+      n = printArg(out + len, size - len, spec, stars, v);
+    } else {
+      int v;
+      memcpy(&v, r.args + used, sizeof(v));
+      n = printArg(out + len, size - len, spec, stars, v);
+    }
+    if (spec.conversion != 's') used += need;
+    
+    if (n > 0) len += (size_t)n;
+    if (len >= size) len = size - 1;
+  }
+  
+  out[len] = '\0';
+  return len;
+}
+
+void Logger::sendBinary(const Record& r) {
+  uint8_t header[3 + FRAME_HEADER];
+  uint32_t fmtAddr = (uint32_t)(uintptr_t)r.fmt;
+  header[0] = FRAME_SYNC_0;
+  header[1] = FRAME_SYNC_1;
+  header[2] = FRAME_HEADER + r.argBytes;
+  memcpy(header + 3, &r.ms, 4);
+  memcpy(header + 7, &fmtAddr, 4);
+  header[11] = r.module;
+  header[12] = r.level;
+  Serial.write(header, sizeof(header));
+  Serial.write(r.args, r.argBytes);
+}
+
+bool Logger::drainOne(bool block) {
+  static char line[LOG_LINE_MAX];
+  
+  // Report messages lost to a full ring where they are missing
+  uint32_t lost = dropped;
+  if (lost != droppedReported) {
+    snprintf(line, sizeof(line), "[%lu] Logger: %lu messages dropped (ring full)",
+             millis(), (unsigned long)(lost - droppedReported));
+    if (!block && Serial.availableForWrite() < (int)strlen(line) + 2) return false;
+    Serial.println(line);
+    droppedReported = lost;
+  }
+  
+  uint32_t t = tail;
+  if (t == head) return false;
+  Record& r = ring[t % LOG_RING_SLOTS];
+  
+  // Claimed but still being written by its producer
+#if defined(ESP32)
+  if (r.state.load(std::memory_order_acquire) != SLOT_READY) return false;
+#else
+  if (r.state != SLOT_READY) return false;
+#endif
+  
+#if LOG_BINARY
+  if (!block && Serial.availableForWrite() < 3 + FRAME_HEADER + r.argBytes) return false;
+  sendBinary(r);
+#else
+  size_t len = format(r, line, sizeof(line));
+  if (!block && Serial.availableForWrite() < (int)len + 2) return false;
+  Serial.println(line);
+#endif
+  
+#if defined(ESP32)
+  r.state.store(SLOT_FREE, std::memory_order_relaxed);
+  tail.store(t + 1, std::memory_order_release);
+#else
+  r.state = SLOT_FREE;
+  tail = t + 1;
+#endif
+  return true;
+}
+
+uint16_t Logger::drain(uint16_t maxRecords) {
+  uint16_t count = 0;
+#if defined(ESP32)
+  // Drain task: waiting for the UART only holds up this task
+  while (count < maxRecords && drainOne(true)) count++;
+#else
+  while (count < maxRecords && drainOne(false)) count++;
+#endif
+  return count;
+}
+
+void Logger::flush() {
+#if defined(ESP32)
+  // Single consumer: let the drain task empty the ring
+  unsigned long start = millis();
+  while (tail != head && millis() - start < 1000) {
+    delay(1);
+  }
+#else
+  while (drainOne(true)) {}
+#endif
+}
+
+void Logger::setLevel(uint8_t module, uint8_t level) {
+  if (level > LOG_LEVEL_DEBUG) level = LOG_LEVEL_DEBUG;
+  if (module >= LOG_MOD_COUNT) {
+    for (uint8_t i = 0; i < LOG_MOD_COUNT; i++) levels[i] = level;
+    return;
+  }
+  levels[module] = level;
+}
+
+const char* Logger::moduleName(uint8_t module) {
+  return module < LOG_MOD_COUNT ? MODULE_NAMES[module] : "ALL";
+}
+
+int Logger::findModule(const char* name) {
+  if (strcasecmp(name, "ALL") == 0) return LOG_MOD_COUNT;
+  for (uint8_t i = 0; i < LOG_MOD_COUNT; i++) {
+    if (strcasecmp(name, MODULE_NAMES[i]) == 0) return i;
+  }
+  return -1;
+}
+
+uint32_t Logger::getWritten() const {
+  return head;
+}
+
+uint32_t Logger::getDropped() const {
+  return dropped;
+}
+
+#endif // LOG_ASYNC
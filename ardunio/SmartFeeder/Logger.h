@@ -0,0 +1,212 @@
+#ifndef LOGGER_H
+#define LOGGER_H
+
+// Included from Config.h (after the LOG_* settings), not on its own
+
+#include <Arduino.h>
+#if LOG_ASYNC && defined(ESP32)
+  #include <atomic>
+#endif
+
+enum LogLevel : uint8_t {
+  LOG_LEVEL_NONE  = 0,
+  LOG_LEVEL_ERROR = 1,
+  LOG_LEVEL_WARN  = 2,
+  LOG_LEVEL_INFO  = 3,   // LOG()
+  LOG_LEVEL_DEBUG = 4
+};
+
+/**
+ * @brief Source of a log line, set per translation unit with
+ *        #define LOG_MODULE before its first #include
+ */
+enum LogModule : uint8_t {
+  LOG_MOD_MAIN,
+  LOG_MOD_MODE,
+  LOG_MOD_SERVO,
+  LOG_MOD_TIME,
+  LOG_MOD_SCHED,
+  LOG_MOD_WIFI,
+  LOG_MOD_WEB,
+  LOG_MOD_BACKEND,
+  LOG_MOD_PROV,
+  LOG_MOD_OTA,
+  LOG_MOD_RADIO,
+  LOG_MOD_TRACE,
+  LOG_MOD_COUNT
+};
+
+#ifndef LOG_MODULE
+  #define LOG_MODULE LOG_MOD_MAIN
+#endif
+
+// Compile-time ceiling per module: the optimizer drops calls above it
+static const uint8_t LOG_MODULE_MAX_LEVEL[LOG_MOD_COUNT] = LOG_COMPILE_LEVELS;
+
+#if !DEBUG_ENABLED
+  #define LOG_AT(level, fmt, ...) ((void)0)
+#elif LOG_ASYNC
+  #define LOG_AT(level, fmt, ...) do { \
+    if ((level) <= LOG_MODULE_MAX_LEVEL[LOG_MODULE] && (level) <= Logger::levels[LOG_MODULE]) { \
+      logger.write(LOG_MODULE, (level), fmt, ##__VA_ARGS__); \
+    } \
+  } while(0)
+#else
+  // Formatted and printed in place (host builds, debugging the logger itself)
+  #define LOG_AT(level, fmt, ...) do { \
+    if ((level) <= LOG_MODULE_MAX_LEVEL[LOG_MODULE]) { \
+      char __buf[LOG_LINE_MAX]; \
+      snprintf(__buf, sizeof(__buf), "[%lu] " fmt, millis(), ##__VA_ARGS__); \
+      Serial.println(__buf); \
+    } \
+  } while(0)
+#endif
+
+#define LOGE(fmt, ...) LOG_AT(LOG_LEVEL_ERROR, fmt, ##__VA_ARGS__)
+#define LOGW(fmt, ...) LOG_AT(LOG_LEVEL_WARN, fmt, ##__VA_ARGS__)
+#define LOG(fmt, ...)  LOG_AT(LOG_LEVEL_INFO, fmt, ##__VA_ARGS__)
+#define LOGD(fmt, ...) LOG_AT(LOG_LEVEL_DEBUG, fmt, ##__VA_ARGS__)
+
+#if LOG_ASYNC
+
+/**
+ * @brief Ring-buffered log with deferred formatting
+ *
+ * write() only copies the format pointer, timestamp and raw arguments
+ * (%s contents included) into a ring slot - no printf, no Serial. The
+ * slots are formatted and printed by a low-priority task (ESP32) or from
+ * loop() while the UART has room (ESP8266). When the ring is full the
+ * message is dropped and counted; the drain reports the gap.
+ *
+ * With LOG_BINARY the drain sends the records undecoded (format string
+ * address + arguments); tools/log_decode.py formats them on the host
+ * using the firmware ELF.
+ *
+ * Slots are claimed with a compare-and-swap on the head index, so the
+ * loop task and the async TCP task can log concurrently without a lock.
+ */
+class Logger {
+public:
+  static uint8_t levels[LOG_MOD_COUNT];  // Runtime level per module
+  
+  // No constructor: the global instance is zero-initialized before any
+  // other global's constructor can log
+  
+  /**
+   * @brief Start the drain task (ESP32); records written before are kept
+   */
+  void begin();
+  
+  /**
+   * @brief Queue one record (a few µs, never blocks)
+   */
+  void write(uint8_t module, uint8_t level, const char* fmt, ...) __attribute__((format(printf, 4, 5)));
+  
+  /**
+   * @brief Output queued records (ESP8266: call in loop, stops when the UART is full)
+   * @return Number of records written
+   */
+  uint16_t drain(uint16_t maxRecords);
+  
+  /**
+   * @brief Output everything queued, blocking on the UART (before a restart)
+   */
+  void flush();
+  
+  /**
+   * @brief Wait for room instead of dropping when the ring is full (up to 1 s
+   *        per line); for diagnostic dumps longer than the ring
+   */
+  void setBlocking(bool on) { blocking = on; }
+  
+  /**
+   * @brief Runtime level of a module, or of all modules with LOG_MOD_COUNT
+   */
+  void setLevel(uint8_t module, uint8_t level);
+  
+  static const char* moduleName(uint8_t module);
+  
+  /**
+   * @brief Module by name (case-insensitive), LOG_MOD_COUNT for "ALL", -1 if unknown
+   */
+  static int findModule(const char* name);
+  
+  uint32_t getWritten() const;
+  uint32_t getDropped() const;
+  uint32_t getTruncated() const { return truncated; }
+  uint8_t getHighWater() const { return highWater; }
+  uint32_t getAvgWriteUs() const { return timedWrites > 0 ? (uint32_t)(writeUsTotal / timedWrites) : 0; }
+  uint32_t getMaxWriteUs() const { return maxWriteUs; }
+  
+private:
+  enum SlotState : uint8_t {
+    SLOT_FREE,
+    SLOT_READY
+  };
+  
+  /**
+   * @brief One queued message; args holds the raw arguments in format order
+   */
+  struct Record {
+#if defined(ESP32)
+    std::atomic<uint8_t> state;
+#else
+    volatile uint8_t state;
+#endif
+    uint8_t module;
+    uint8_t level;
+    uint8_t argBytes;
+    uint32_t ms;
+    const char* fmt;
+    uint8_t args[LOG_RECORD_ARGS];
+  };
+  
+  Record ring[LOG_RING_SLOTS];
+#if defined(ESP32)
+  std::atomic<uint32_t> head;     // Next slot to claim (producers)
+  std::atomic<uint32_t> tail;     // Next slot to output (drain)
+  std::atomic<uint32_t> dropped;
+#else
+  volatile uint32_t head;
+  volatile uint32_t tail;
+  volatile uint32_t dropped;
+#endif
+  volatile bool blocking;
+  uint32_t droppedReported;
+  uint32_t truncated;
+  uint8_t highWater;
+  
+  // Cost of write() itself (updated without a lock: approximate)
+  uint64_t writeUsTotal;
+  uint32_t timedWrites;
+  uint32_t maxWriteUs;
+  
+  /**
+   * @brief Reserve the slot at head, false if the ring is full
+   */
+  bool claim(uint32_t& index);
+  
+  /**
+   * @brief Output the record at tail
+   * @param block Wait for the UART (false: give up if it has no room)
+   * @return false if there was nothing ready or no room
+   */
+  bool drainOne(bool block);
+  
+  /**
+   * @brief Format a record as "[ms] text", like the inline LOG did
+   */
+  size_t format(const Record& r, char* out, size_t size);
+  
+  void sendBinary(const Record& r);
+  
+#if defined(ESP32)
+  static void drainTask(void* arg);
+#endif
+};
+
+extern Logger logger;
+
+#endif // LOG_ASYNC
+
+#endif // LOGGER_H
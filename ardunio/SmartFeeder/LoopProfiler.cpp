@@ -0,0 +1,192 @@
+#define LOG_MODULE LOG_MOD_MAIN
+#include "LoopProfiler.h"
+#include "Metrics.h"
+
+#if defined(ESP32)
+  #include <esp_timer.h>
+#endif
+
+static_assert(PROF_SECTION_COUNT <= 16, "LoopProfiler::ranMask has one bit per section");
+
+static const char* const SECTION_NAMES[PROF_SECTION_COUNT] = {
+  "main", "web", "mode", "wifi", "radio", "servo",
+  "backend", "ota", "sched", "log", "core"
+};
+
+// ================== LatencyHistogram ==================
+
+uint8_t LatencyHistogram::bucketOf(uint32_t us) {
+  if (us < SUB_BUCKETS) return (uint8_t)us;
+  if (us >> PROFILE_MAX_US_BITS) return BUCKETS - 1;
+  
+  // Power of two selects the group, the next bits the bucket within it
+  uint8_t msb = 31 - __builtin_clz(us);
+  uint8_t shift = msb - PROFILE_SUB_BUCKET_BITS;
+  return (uint8_t)((shift + 1) * SUB_BUCKETS + ((us >> shift) & (SUB_BUCKETS - 1)));
+}
+
+uint32_t LatencyHistogram::bucketUpperUs(uint8_t bucket) {
+  if (bucket < SUB_BUCKETS) return bucket;
+  uint8_t shift = bucket / SUB_BUCKETS - 1;
+  uint32_t lower = (uint32_t)(SUB_BUCKETS + bucket % SUB_BUCKETS) << shift;
+  return lower + ((uint32_t)1 << shift) - 1;
+}
+
+void LatencyHistogram::record(uint32_t us) {
+  uint8_t bucket = bucketOf(us);
+  if (buckets[bucket] == UINT32_MAX) halve();
+  buckets[bucket]++;
+  count++;
+  totalUs += us;
+  if (us > maxUs) maxUs = us;
+}
+
+void LatencyHistogram::reset() {
+  memset(buckets, 0, sizeof(buckets));
+  count = 0;
+  totalUs = 0;
+  maxUs = 0;
+}
+
+void LatencyHistogram::halve() {
+  // Keeps the shape (percentiles) and the average, count becomes a weight
+  count = 0;
+  for (uint8_t b = 0; b < BUCKETS; b++) {
+    buckets[b] >>= 1;
+    count += buckets[b];
+  }
+  totalUs >>= 1;
+}
+
+uint32_t LatencyHistogram::percentile(uint16_t perMille) const {
+  if (count == 0) return 0;
+  
+  // Rank of the sample at that percentile, rounded up
+  uint32_t rank = (uint32_t)(((uint64_t)count * perMille + 999) / 1000);
+  if (rank == 0) rank = 1;
+  
+  uint32_t seen = 0;
+  for (uint8_t b = 0; b < BUCKETS; b++) {
+    seen += buckets[b];
+    if (seen >= rank) {
+      uint32_t upper = bucketUpperUs(b);
+      return upper < maxUs ? upper : maxUs;
+    }
+  }
+  return maxUs;
+}
+
+// ================== LoopProfiler ==================
+
+// Whole iterations are timed on a 64-bit microsecond clock: one blocked
+// iteration (connect timeout, flash erase) can outlast the cycle counter wrap
+static inline uint64_t loopClockUs() {
+#if defined(ESP32)
+  return (uint64_t)esp_timer_get_time();
+#else
+  return micros64();
+#endif
+}
+
+LoopProfiler::LoopProfiler()
+  : loopStart(0)
+  , lapStart(0)
+  , ranMask(0)
+  , running(false)
+  , cyclesPerUs(1)
+  , resetAt(0) {
+  reset();
+}
+
+void LoopProfiler::begin() {
+  cyclesPerUs = ESP.getCpuFreqMHz();
+  if (cyclesPerUs == 0) cyclesPerUs = 1;
+  reset();
+}
+
+void LoopProfiler::reset() {
+  loopTime.reset();
+  for (uint8_t i = 0; i < PROF_SECTION_COUNT; i++) {
+    sections[i].reset();
+    sectionTotalUs[i] = 0;
+  }
+  loopTotalUs = 0;
+  memset(stalls, 0, sizeof(stalls));
+  memset(&worstStall, 0, sizeof(worstStall));
+  stallNext = 0;
+  stallCount = 0;
+  resetAt = millis();
+  
+  // The iteration in progress is not recorded
+  memset(iterationCycles, 0, sizeof(iterationCycles));
+  ranMask = 0;
+  running = false;
+}
+
+void LoopProfiler::beginLoop() {
+#if PROFILE_ENABLED
+  uint32_t now = ESP.getCycleCount();
+  uint64_t nowUs = loopClockUs();
+  
+  if (running) {
+    iterationCycles[PROF_CORE] += now - lapStart;
+    ranMask |= (uint16_t)1 << PROF_CORE;
+    
+    uint64_t elapsedUs = nowUs - loopStart;
+    uint32_t loopUs = elapsedUs > UINT32_MAX ? UINT32_MAX : (uint32_t)elapsedUs;
+    loopTime.record(loopUs);
+    loopTotalUs += loopUs;
+    metrics.observe(MET_LOOP_SECONDS, loopUs);
+    
+    uint8_t culprit = PROF_CORE;
+    uint32_t culpritUs = 0;
+    for (uint8_t i = 0; i < PROF_SECTION_COUNT; i++) {
+      if (!(ranMask & ((uint16_t)1 << i))) continue;
+      uint32_t us = iterationCycles[i] / cyclesPerUs;
+      sections[i].record(us);
+      sectionTotalUs[i] += us;
+      if (us > culpritUs) {
+        culpritUs = us;
+        culprit = i;
+      }
+    }
+    
+    if (loopUs >= PROFILE_STALL_US) {
+      StallEvent& e = stalls[stallNext];
+      e.atMs = millis();
+      e.loopUs = loopUs;
+      e.culpritUs = culpritUs;
+      e.culprit = culprit;
+      stallNext = (stallNext + 1) % PROFILE_STALL_EVENTS;
+      stallCount++;
+      metrics.inc(MET_LOOP_STALLS);
+      if (loopUs > worstStall.loopUs) worstStall = e;
+      LOGW("Loop stall: %lu ms, %s %lu ms", (unsigned long)(loopUs / 1000),
+           SECTION_NAMES[culprit], (unsigned long)(culpritUs / 1000));
+    }
+  }
+  
+  memset(iterationCycles, 0, sizeof(iterationCycles));
+  ranMask = 0;
+  running = true;
+  loopStart = nowUs;
+  lapStart = now;
+#endif
+}
+
+uint16_t LoopProfiler::getSharePerMille(uint8_t section) const {
+  if (loopTotalUs == 0) return 0;
+  return (uint16_t)(sectionTotalUs[section] * 1000 / loopTotalUs);
+}
+
+uint8_t LoopProfiler::getStallEventCount() const {
+  return stallCount < PROFILE_STALL_EVENTS ? (uint8_t)stallCount : PROFILE_STALL_EVENTS;
+}
+
+const StallEvent& LoopProfiler::getStallEvent(uint8_t index) const {
+  return stalls[(stallNext + PROFILE_STALL_EVENTS - 1 - index) % PROFILE_STALL_EVENTS];
+}
+
+const char* LoopProfiler::sectionName(uint8_t section) {
+  return section < PROF_SECTION_COUNT ? SECTION_NAMES[section] : "?";
+}
@@ -0,0 +1,174 @@
+#ifndef LOOP_PROFILER_H
+#define LOOP_PROFILER_H
+
+#include "Config.h"
+#include <Arduino.h>
+
+/**
+ * @brief Code run by loop(), timed separately
+ */
+enum ProfileSection : uint8_t {
+  PROF_MAIN,      // Serial commands, state machine, backend command glue
+  PROF_WEB,       // WebPortal::handleClient()
+  PROF_MODE,      // ModeManager::applyTransition()
+  PROF_WIFI,      // WiFiManager::maintain()
+  PROF_RADIO,     // RadioPolicy::tick()
+  PROF_SERVO,     // ServoController::tick()
+  PROF_BACKEND,   // BackendClient::tick() and applying what it pulled
+  PROF_OTA,       // OtaUpdater::tick() / confirmBoot()
+  PROF_SCHED,     // OfflineScheduler::tick()
+  PROF_LOG,       // Logger::drain() (ESP8266)
+  PROF_CORE,      // Between loop() calls: Arduino core, yield(), WiFi stack (ESP8266)
+  PROF_SECTION_COUNT
+};
+
+/**
+ * @brief Log-linear (HDR-style) histogram of durations in microseconds
+ *
+ * Each power of two is split into 2^PROFILE_SUB_BUCKET_BITS buckets, so a
+ * recorded value is known to within 1/2^bits of itself from 1 us up to
+ * 2^PROFILE_MAX_US_BITS us, with a fixed bucket array and no division.
+ * A bucket about to overflow halves all of them (a fast loop fills one in
+ * about a day), so long windows stay valid as a distribution.
+ */
+class LatencyHistogram {
+public:
+  static const uint8_t SUB_BUCKETS = 1 << PROFILE_SUB_BUCKET_BITS;
+  static const uint8_t BUCKETS = (PROFILE_MAX_US_BITS - PROFILE_SUB_BUCKET_BITS + 1) * SUB_BUCKETS;
+  
+  void record(uint32_t us);
+  void reset();
+  
+  /**
+   * @brief Value at a percentile (per mille, 999 = p99.9), as the upper
+   *        bound of its bucket; 0 if empty
+   */
+  uint32_t percentile(uint16_t perMille) const;
+  
+  uint32_t getCount() const { return count; }
+  uint64_t getTotalUs() const { return totalUs; }
+  uint32_t getMaxUs() const { return maxUs; }
+  uint32_t getAvgUs() const { return count > 0 ? (uint32_t)(totalUs / count) : 0; }
+  uint32_t getBucketCount(uint8_t bucket) const { return buckets[bucket]; }
+  
+  static uint8_t bucketOf(uint32_t us);
+  
+  /**
+   * @brief Largest value that falls into a bucket
+   */
+  static uint32_t bucketUpperUs(uint8_t bucket);
+  
+private:
+  uint32_t buckets[BUCKETS];
+  uint32_t count;
+  uint64_t totalUs;
+  uint32_t maxUs;
+  
+  void halve();
+};
+
+/**
+ * @brief Loop iteration that took PROFILE_STALL_US or longer
+ */
+struct StallEvent {
+  uint32_t atMs;        // millis() when the iteration ended
+  uint32_t loopUs;      // Whole iteration
+  uint32_t culpritUs;   // Longest section within it
+  uint8_t culprit;      // ProfileSection
+};
+
+/**
+ * @brief Loop latency and per-section CPU time from the CPU cycle counter
+ *
+ * loop() calls beginLoop() first and lap(section) after each module it
+ * runs: a lap charges the cycles since the previous lap to that section
+ * (one cycle counter read, no division). beginLoop() closes the previous
+ * iteration: the time since the last lap goes to PROF_CORE, each section
+ * that ran and the iteration as a whole are recorded into their
+ * histograms, and an iteration of PROFILE_STALL_US or more is kept as a
+ * stall event naming its longest section.
+ *
+ * Sections only lapped inside a condition (backend in online mode) are
+ * recorded for the iterations they ran in. The 32-bit cycle counter wraps
+ * after 2^32 / f_cpu (17.9 s at 240 MHz), so it only times the sections;
+ * the whole iteration uses the 64-bit microsecond clock and stays right
+ * however long one blocks.
+ */
+class LoopProfiler {
+public:
+  LoopProfiler();
+  
+  /**
+   * @brief Read the CPU clock used to convert cycles (call in setup)
+   */
+  void begin();
+  
+  /**
+   * @brief Close the previous iteration and start timing this one (top of loop)
+   */
+  void beginLoop();
+  
+  /**
+   * @brief Charge the time since the previous lap to a section
+   */
+  void lap(ProfileSection section) {
+#if PROFILE_ENABLED
+    uint32_t now = ESP.getCycleCount();
+    iterationCycles[section] += now - lapStart;
+    ranMask |= (uint16_t)1 << section;
+    lapStart = now;
+#endif
+  }
+  
+  /**
+   * @brief Clear histograms and stall events (e.g. before measuring a fix)
+   */
+  void reset();
+  
+  const LatencyHistogram& getLoop() const { return loopTime; }
+  const LatencyHistogram& getSection(uint8_t section) const { return sections[section]; }
+  
+  /**
+   * @brief Share of the measured loop time spent in a section, in 0.1 %
+   */
+  uint16_t getSharePerMille(uint8_t section) const;
+  
+  uint32_t getStallCount() const { return stallCount; }
+  
+  /**
+   * @brief Stall events, most recent first (index < getStallEventCount())
+   */
+  uint8_t getStallEventCount() const;
+  const StallEvent& getStallEvent(uint8_t index) const;
+  const StallEvent& getWorstStall() const { return worstStall; }
+  
+  uint32_t getCpuMhz() const { return cyclesPerUs; }
+  uint32_t getSinceResetMs() const { return millis() - resetAt; }
+  
+  static const char* sectionName(uint8_t section);
+  
+private:
+  LatencyHistogram loopTime;
+  LatencyHistogram sections[PROF_SECTION_COUNT];
+  
+  // Current iteration
+  uint64_t loopStart;       // Microseconds (64-bit clock)
+  uint32_t lapStart;
+  uint32_t iterationCycles[PROF_SECTION_COUNT];
+  uint16_t ranMask;
+  bool running;
+  
+  // Time totals for the shares (never halved, unlike the histograms)
+  uint64_t loopTotalUs;
+  uint64_t sectionTotalUs[PROF_SECTION_COUNT];
+  
+  StallEvent stalls[PROFILE_STALL_EVENTS];
+  uint8_t stallNext;
+  uint32_t stallCount;
+  StallEvent worstStall;
+  
+  uint32_t cyclesPerUs;
+  uint32_t resetAt;
+};
+
+#endif // LOOP_PROFILER_H
@@ -0,0 +1,206 @@
+#include "Metrics.h"
+
+#include <stdarg.h>
+
+Metrics metrics;
+
+#define METRICS_STR(x) #x
+#define METRICS_XSTR(x) METRICS_STR(x)
+
+/**
+ * @brief Registration of one metric; entries of one family are adjacent
+ *        and share name, help and type
+ */
+struct MetricInfo {
+  const char* name;
+  const char* labels;   // Without braces, "" for none
+  const char* help;
+};
+
+static const MetricInfo COUNTER_INFO[] = {
+  { "feeder_feeds_delivered_total", "source=\"schedule\"", "Feeds given (lid opened), by trigger" },
+  { "feeder_feeds_delivered_total", "source=\"backend\"", nullptr },
+  { "feeder_feeds_delivered_total", "source=\"manual\"", nullptr },
+  { "feeder_feeds_missed_total", "source=\"schedule\"", "Feeds not given because the lid was still moving" },
+  { "feeder_feeds_missed_total", "source=\"backend\"", nullptr },
+  { "feeder_feeds_missed_total", "source=\"manual\"", nullptr },
+  { "feeder_backend_failures_total", "", "Backend requests that failed (timeout, connect or HTTP error)" },
+  { "feeder_tls_pin_failures_total", "", "TLS connections refused for a certificate pin mismatch" },
+  { "feeder_nvs_writes_total", "module=\"mode\"", "NVS write sessions, by module" },
+  { "feeder_nvs_writes_total", "module=\"time\"", nullptr },
+  { "feeder_nvs_writes_total", "module=\"sched\"", nullptr },
+  { "feeder_nvs_writes_total", "module=\"wifi\"", nullptr },
+  { "feeder_nvs_writes_total", "module=\"prov\"", nullptr },
+  { "feeder_nvs_writes_total", "module=\"ota\"", nullptr },
+  { "feeder_wifi_connects_total", "kind=\"fast\"", "Station connects and reconnects, by attempt (cached BSSID or full scan)" },
+  { "feeder_wifi_connects_total", "kind=\"full\"", nullptr },
+  { "feeder_wifi_connect_failures_total", "", "Full station connect attempts that failed" },
+  { "feeder_wifi_link_lost_total", "", "Station link losses" },
+  { "feeder_loop_stalls_total", "", "loop() iterations of " METRICS_XSTR(PROFILE_STALL_US) " us or longer" }
+};
+static_assert(sizeof(COUNTER_INFO) / sizeof(COUNTER_INFO[0]) == MET_COUNTER_COUNT,
+              "COUNTER_INFO needs one entry per MetricCounter");
+
+#if defined(ESP32)
+  #define METRICS_PLATFORM "esp32"
+#else
+  #define METRICS_PLATFORM "esp8266"
+#endif
+
+static const MetricInfo GAUGE_INFO[] = {
+  { "feeder_build_info", "version=\"" FIRMWARE_VERSION "\",platform=\"" METRICS_PLATFORM "\"", "Firmware build (always 1)" },
+  { "feeder_uptime_seconds", "", "Time since boot" },
+  { "feeder_heap_free_bytes", "", "Free heap" },
+  { "feeder_heap_min_free_bytes", "", "Lowest free heap since boot" },
+  { "feeder_heap_largest_block_bytes", "", "Largest allocatable heap block" },
+  { "feeder_wifi_connected", "", "Station link up (1) or down (0)" },
+  { "feeder_wifi_rssi_dbm", "", "Station signal strength, 0 while down" }
+};
+static_assert(sizeof(GAUGE_INFO) / sizeof(GAUGE_INFO[0]) == MET_GAUGE_COUNT,
+              "GAUGE_INFO needs one entry per MetricGauge");
+
+/**
+ * @brief Histogram registration: upper bounds in us, ascending
+ */
+struct HistogramInfo {
+  const char* name;
+  const char* help;
+  uint8_t boundCount;
+  uint32_t boundsUs[MetricValues::MAX_BOUNDS];
+};
+
+static const HistogramInfo HISTOGRAM_INFO[] = {
+  { "feeder_loop_duration_seconds", "loop() iteration time", 12,
+    { 100, 250, 500, 1000, 2500, 5000, 10000, 25000, 50000, 100000, 250000, 1000000 } },
+  { "feeder_backend_request_duration_seconds", "Backend request time once connected, errors and timeouts included", 9,
+    { 25000, 50000, 100000, 250000, 500000, 1000000, 2500000, 5000000, 10000000 } }
+};
+static_assert(sizeof(HISTOGRAM_INFO) / sizeof(HISTOGRAM_INFO[0]) == MET_HISTOGRAM_COUNT,
+              "HISTOGRAM_INFO needs one entry per MetricHistogram");
+
+void Metrics::observe(MetricHistogram histogram, uint32_t us) {
+  const HistogramInfo& info = HISTOGRAM_INFO[histogram];
+  MetricValues::Histogram& h = values.histograms[histogram];
+  
+  uint8_t b = 0;
+  while (b < info.boundCount && us > info.boundsUs[b]) b++;
+  h.buckets[b]++;
+  h.count++;
+  h.sumUs += us;
+}
+
+// ================== Text output ==================
+
+/**
+ * @brief Window of the text being produced: lines are formatted one at a
+ *        time and only the part inside [offset, offset + maxLen) is copied
+ */
+struct TextWindow {
+  char* out;
+  size_t maxLen;
+  size_t offset;
+  size_t pos;       // Position in the whole text
+  size_t written;
+  
+  void line(const char* fmt, ...) __attribute__((format(printf, 2, 3)));
+};
+
+void TextWindow::line(const char* fmt, ...) {
+  char buf[192];
+  va_list ap;
+  va_start(ap, fmt);
+  int n = vsnprintf(buf, sizeof(buf) - 1, fmt, ap);
+  va_end(ap);
+  if (n < 0) return;
+  size_t len = (size_t)n < sizeof(buf) - 1 ? (size_t)n : sizeof(buf) - 2;
+  buf[len++] = '\n';
+  
+  // Overlap of [pos, pos + len) with [offset + written, offset + maxLen)
+  size_t from = offset + written;
+  if (pos + len > from && written < maxLen) {
+    size_t skip = from > pos ? from - pos : 0;
+    size_t count = len - skip;
+    if (count > maxLen - written) count = maxLen - written;
+    memcpy(out + written, buf + skip, count);
+    written += count;
+  }
+  pos += len;
+}
+
+/**
+ * @brief Seconds with up to 6 decimals, trailing zeros dropped ("0.025", "10")
+ */
+static void formatSeconds(uint64_t us, char* buf, size_t size) {
+  unsigned long sec = (unsigned long)(us / 1000000);
+  unsigned long frac = (unsigned long)(us % 1000000);
+  if (frac == 0) {
+    snprintf(buf, size, "%lu", sec);
+    return;
+  }
+  int digits = 6;
+  while (frac % 10 == 0) {
+    frac /= 10;
+    digits--;
+  }
+  snprintf(buf, size, "%lu.%0*lu", sec, digits, frac);
+}
+
+static void writeHeader(TextWindow& w, const MetricInfo& info, const char* type) {
+  if (!info.help) return;  // Next entry of the same family
+  w.line("# HELP %s %s", info.name, info.help);
+  w.line("# TYPE %s %s", info.name, type);
+}
+
+static void writeSample(TextWindow& w, const MetricInfo& info, uint32_t value, bool isSigned) {
+  const char* open = info.labels[0] ? "{" : "";
+  const char* close = info.labels[0] ? "}" : "";
+  if (isSigned) {
+    w.line("%s%s%s%s %ld", info.name, open, info.labels, close, (long)(int32_t)value);
+  } else {
+    w.line("%s%s%s%s %lu", info.name, open, info.labels, close, (unsigned long)value);
+  }
+}
+
+static void writeAll(const MetricValues& v, TextWindow& w) {
+  for (uint8_t i = 0; i < MET_COUNTER_COUNT; i++) {
+    writeHeader(w, COUNTER_INFO[i], "counter");
+    writeSample(w, COUNTER_INFO[i], v.counters[i], false);
+  }
+  
+  for (uint8_t i = 0; i < MET_GAUGE_COUNT; i++) {
+    writeHeader(w, GAUGE_INFO[i], "gauge");
+    writeSample(w, GAUGE_INFO[i], (uint32_t)v.gauges[i], true);
+  }
+  
+  char le[24];
+  for (uint8_t i = 0; i < MET_HISTOGRAM_COUNT; i++) {
+    const HistogramInfo& info = HISTOGRAM_INFO[i];
+    const MetricValues::Histogram& h = v.histograms[i];
+    w.line("# HELP %s %s", info.name, info.help);
+    w.line("# TYPE %s histogram", info.name);
+    
+    // Buckets are cumulative in the exposition format
+    unsigned long cumulative = 0;
+    for (uint8_t b = 0; b < info.boundCount; b++) {
+      cumulative += h.buckets[b];
+      formatSeconds(info.boundsUs[b], le, sizeof(le));
+      w.line("%s_bucket{le=\"%s\"} %lu", info.name, le, cumulative);
+    }
+    w.line("%s_bucket{le=\"+Inf\"} %lu", info.name, (unsigned long)h.count);
+    formatSeconds(h.sumUs, le, sizeof(le));
+    w.line("%s_sum %s", info.name, le);
+    w.line("%s_count %lu", info.name, (unsigned long)h.count);
+  }
+}
+
+size_t Metrics::render(const MetricValues& v, char* out, size_t maxLen, size_t offset) {
+  TextWindow w = { out, maxLen, offset, 0, 0 };
+  writeAll(v, w);
+  return w.written;
+}
+
+size_t Metrics::textLength(const MetricValues& v) {
+  TextWindow w = { nullptr, 0, 0, 0, 0 };
+  writeAll(v, w);
+  return w.pos;
+}
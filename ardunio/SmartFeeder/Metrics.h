@@ -0,0 +1,120 @@
+#ifndef METRICS_H
+#define METRICS_H
+
+#include "Config.h"
+#include <Arduino.h>
+
+/**
+ * @brief Counters (monotonic, *_total); names and labels in Metrics.cpp
+ */
+enum MetricCounter : uint8_t {
+  MET_FEEDS_SCHEDULE,         // feeder_feeds_delivered_total{source="schedule"}
+  MET_FEEDS_BACKEND,          // feeder_feeds_delivered_total{source="backend"}
+  MET_FEEDS_MANUAL,           // feeder_feeds_delivered_total{source="manual"}
+  MET_FEEDS_MISSED_SCHEDULE,  // feeder_feeds_missed_total{source="schedule"}
+  MET_FEEDS_MISSED_BACKEND,   // feeder_feeds_missed_total{source="backend"}
+  MET_FEEDS_MISSED_MANUAL,    // feeder_feeds_missed_total{source="manual"}
+  MET_BACKEND_FAILURES,
+  MET_TLS_PIN_FAILURES,
+  MET_NVS_WRITES_MODE,
+  MET_NVS_WRITES_TIME,
+  MET_NVS_WRITES_SCHED,
+  MET_NVS_WRITES_WIFI,
+  MET_NVS_WRITES_PROV,
+  MET_NVS_WRITES_OTA,
+  MET_WIFI_CONNECTS_FAST,
+  MET_WIFI_CONNECTS_FULL,
+  MET_WIFI_CONNECT_FAILURES,
+  MET_WIFI_LINK_LOST,
+  MET_LOOP_STALLS,
+  MET_COUNTER_COUNT
+};
+
+/**
+ * @brief Gauges (current value, set when it changes or at scrape time)
+ */
+enum MetricGauge : uint8_t {
+  MET_BUILD_INFO,
+  MET_UPTIME_SECONDS,
+  MET_HEAP_FREE_BYTES,
+  MET_HEAP_MIN_FREE_BYTES,
+  MET_HEAP_LARGEST_BLOCK_BYTES,
+  MET_WIFI_CONNECTED,
+  MET_WIFI_RSSI_DBM,
+  MET_GAUGE_COUNT
+};
+
+/**
+ * @brief Histograms of durations (observed in us, exported in seconds)
+ */
+enum MetricHistogram : uint8_t {
+  MET_LOOP_SECONDS,
+  MET_BACKEND_REQUEST_SECONDS,
+  MET_HISTOGRAM_COUNT
+};
+
+/**
+ * @brief All metric values: plain data, copied as one block for a scrape
+ */
+struct MetricValues {
+  static const uint8_t MAX_BOUNDS = 12;
+  
+  uint32_t counters[MET_COUNTER_COUNT];
+  int32_t gauges[MET_GAUGE_COUNT];
+  struct Histogram {
+    uint32_t buckets[MAX_BOUNDS + 1];  // Per bound (not cumulative), last = above all bounds
+    uint32_t count;
+    uint64_t sumUs;
+  } histograms[MET_HISTOGRAM_COUNT];
+};
+
+/**
+ * @brief Static metric registry with Prometheus text output
+ *
+ * Every metric is known at compile time: the enums above index fixed
+ * arrays, Metrics.cpp holds the name / labels / help of each entry
+ * (static_assert keeps them in step). Updates are an array store, no
+ * lookup and no allocation; they are made from the loop task only.
+ *
+ * For a scrape the loop task copies the values (a few hundred bytes) into
+ * the response slot; render() then produces the text from that copy while
+ * the TCP task sends it, so the output is consistent and never held in
+ * memory as a whole.
+ */
+class Metrics {
+public:
+  // No constructor: zero-initialized before any global could count
+  
+  void inc(MetricCounter counter, uint32_t n = 1) { values.counters[counter] += n; }
+  void set(MetricGauge gauge, int32_t value) { values.gauges[gauge] = value; }
+  
+  /**
+   * @brief Keep the lowest value seen (0 = nothing seen yet)
+   */
+  void lower(MetricGauge gauge, int32_t value) {
+    if (values.gauges[gauge] == 0 || value < values.gauges[gauge]) values.gauges[gauge] = value;
+  }
+  
+  void observe(MetricHistogram histogram, uint32_t us);
+  
+  const MetricValues& getValues() const { return values; }
+  
+  /**
+   * @brief Part of the text for a copy of the values
+   * @param offset Position in the whole text of out[0]
+   * @return Bytes written to out (0 at the end)
+   */
+  static size_t render(const MetricValues& v, char* out, size_t maxLen, size_t offset);
+  
+  /**
+   * @brief Length of the whole text for a copy of the values
+   */
+  static size_t textLength(const MetricValues& v);
+  
+private:
+  MetricValues values;
+};
+
+extern Metrics metrics;
+
+#endif // METRICS_H
@@ -1,14 +1,25 @@
+#define LOG_MODULE LOG_MOD_MODE
 #include "ModeManager.h"
+#include "Metrics.h"
 
 #if defined(ESP32)
   #include <Preferences.h>
 #endif
 
+ModeManager::ModeManager()
+  : currentMode(MODE_NOT_SELECTED)
+  , isSelected(false)
+  , moduleCount(0)
+  , activeMode(MODE_NOT_SELECTED)
+  , transitionCount(0)
+  , lastTransitionMs(0) {
+}
+
 bool ModeManager::begin() {
 #if defined(ESP32)
   Preferences prefs;
   if (!prefs.begin(NVS_NAMESPACE, true)) {
-    LOG("ModeManager: Failed to open NVS");
+    LOGE("ModeManager: Failed to open NVS");
     return false;
   }
   
@@ -38,9 +49,10 @@ bool ModeManager::setMode(OperationMode mode) {
 #if defined(ESP32)
   Preferences prefs;
   if (!prefs.begin(NVS_NAMESPACE, false)) {
-    LOG("ModeManager: Failed to save mode to NVS");
+    LOGE("ModeManager: Failed to save mode to NVS");
     return false;
   }
+  metrics.inc(MET_NVS_WRITES_MODE);
   
   prefs.putBool("modeSelected", isSelected);
   prefs.putUChar("mode", (uint8_t)currentMode);
@@ -55,6 +67,7 @@ void ModeManager::reset() {
 #if defined(ESP32)
   Preferences prefs;
   if (prefs.begin(NVS_NAMESPACE, false)) {
+    metrics.inc(MET_NVS_WRITES_MODE);
     prefs.remove("modeSelected");
     prefs.remove("mode");
     prefs.end();
@@ -66,8 +79,49 @@ void ModeManager::reset() {
   LOG("ModeManager: Mode reset");
 }
 
+bool ModeManager::addModule(const char* name, ModeHook start, ModeHook stop) {
+  if (moduleCount >= MAX_MODULES) {
+    LOG("ModeManager: Too many modules, %s not registered", name);
+    return false;
+  }
+  
+  modules[moduleCount].name = name;
+  modules[moduleCount].start = start;
+  modules[moduleCount].stop = stop;
+  moduleCount++;
+  return true;
+}
+
+bool ModeManager::applyTransition() {
+  if (activeMode == currentMode) return false;
+  
+  unsigned long start = millis();
+  OperationMode from = activeMode;
+  LOG("ModeManager: Transition %s -> %s", modeString(from), modeString(currentMode));
+  
+  // Dependents stop before what they depend on
+  for (int i = moduleCount - 1; i >= 0; i--) {
+    if (modules[i].stop) modules[i].stop(from);
+  }
+  
+  activeMode = currentMode;
+  for (uint8_t i = 0; i < moduleCount; i++) {
+    if (modules[i].start) modules[i].start(activeMode);
+  }
+  
+  lastTransitionMs = millis() - start;
+  transitionCount++;
+  LOG("ModeManager: Now running %s (%u modules, %lu ms)",
+      modeString(activeMode), moduleCount, (unsigned long)lastTransitionMs);
+  return true;
+}
+
 const char* ModeManager::getModeString() const {
-  switch (currentMode) {
+  return modeString(currentMode);
+}
+
+const char* ModeManager::modeString(OperationMode mode) {
+  switch (mode) {
     case MODE_OFFLINE: return "OFFLINE";
     case MODE_ONLINE:  return "ONLINE";
     default:           return "NOT_SELECTED";
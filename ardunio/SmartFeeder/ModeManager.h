@@ -3,19 +3,49 @@
 
 #include "Config.h"
 
+/**
+ * @brief Start / stop hook of a module's mode-specific part
+ * @param mode Mode being entered (start) or left (stop); hooks ignore modes
+ *             they have nothing to do for
+ */
+typedef void (*ModeHook)(OperationMode mode);
+
 /**
  * @brief Manages operation mode selection and persistence
  * 
  * Handles user mode selection (offline/online) and stores it in NVS.
  * Provides thread-safe access to current mode.
+ * 
+ * Mode changes take effect without a reboot: setMode() / reset() only
+ * record the new mode, applyTransition() (from loop()) then stops the
+ * registered modules' parts for the old mode in reverse order and starts
+ * them for the new one in registration (dependency) order. Modules that
+ * are not registered, such as the scheduler, keep running untouched.
  */
 class ModeManager {
 private:
+  struct ModeModule {
+    const char* name;
+    ModeHook start;
+    ModeHook stop;
+  };
+  
+  static const uint8_t MAX_MODULES = 4;
+  
   OperationMode currentMode;
   bool isSelected;
   
+  // Transition protocol
+  ModeModule modules[MAX_MODULES];
+  uint8_t moduleCount;
+  OperationMode activeMode;   // Mode the registered modules currently run for
+  uint32_t transitionCount;
+  uint32_t lastTransitionMs;
+  
+  static const char* modeString(OperationMode mode);
+  
 public:
-  ModeManager() : currentMode(MODE_NOT_SELECTED), isSelected(false) {}
+  ModeManager();
   
   /**
    * @brief Initialize mode manager and load saved mode from NVS
@@ -51,6 +81,29 @@ public:
    * @brief Get mode as string for logging
    */
   const char* getModeString() const;
+  
+  /**
+   * @brief Register a module's mode-specific part
+   * 
+   * Register in dependency order (a module after the ones it needs);
+   * stopping runs in reverse order.
+   * @return false if MAX_MODULES are registered already
+   */
+  bool addModule(const char* name, ModeHook start, ModeHook stop);
+  
+  /**
+   * @brief Whether the modules still run for another mode than the selected one
+   */
+  bool isTransitionPending() const { return activeMode != currentMode; }
+  
+  /**
+   * @brief Stop the modules for the active mode and start them for the selected one
+   * @return true if a transition ran
+   */
+  bool applyTransition();
+  
+  uint32_t getTransitionCount() const { return transitionCount; }
+  uint32_t getLastTransitionMs() const { return lastTransitionMs; }
 };
 
 #endif // MODE_MANAGER_H
@@ -1,4 +1,6 @@
+#define LOG_MODULE LOG_MOD_SCHED
 #include "OfflineScheduler.h"
+#include "Metrics.h"
 
 #if defined(ESP32)
   #include <Preferences.h>
@@ -7,6 +9,8 @@
 OfflineScheduler::OfflineScheduler(TimeManager* tm, ServoController* sc)
   : timeManager(tm)
   , servoController(sc)
+  , configVersion(0)
+  , provisionVersion(0)
   , lastTickMs(0)
   , lastLoggedMinute(65535) {
   
@@ -49,28 +53,29 @@ void OfflineScheduler::tick() {
     bool excluded = isDayExcluded(dow);
     
     const char* days[] = {"Sun", "Mon", "Tue", "Wed", "Thu", "Fri", "Sat"};
-    LOG("*** CLOCK: %s %02u:%02u %s ***", 
+    // Minute heartbeat: debug level (LOGLEVEL SCHED 4 to see it)
+    LOGD("*** CLOCK: %s %02u:%02u %s ***",
         days[dow], hh, mm, excluded ? "[EXCLUDED]" : "");
     
     // Log scheduled times
     if (config.timesCount > 0) {
-      LOG("Scheduled feeds: %u times", config.timesCount);
+      LOGD("Scheduled feeds: %u times", config.timesCount);
       for (uint8_t i = 0; i < config.timesCount; i++) {
-        LOG("  - %02u:%02u", config.times[i].hour, config.times[i].minute);
+        LOGD("  - %02u:%02u", config.times[i].hour, config.times[i].minute);
       }
     }
     
     // Auto-save every 10 minutes
     if (mm % AUTO_SAVE_INTERVAL == 0) {
       timeManager->save();
-      LOG("Auto-saved time to NVS");
+      LOGD("Auto-saved time to NVS");
     }
   }
   
   // Check if we should feed
   if (!isDayExcluded(dow)) {
     if (shouldFeedNow(dow, mod)) {
-      triggerManualFeed();
+      metrics.inc(triggerManualFeed() ? MET_FEEDS_SCHEDULE : MET_FEEDS_MISSED_SCHEDULE);
     }
   }
 }
@@ -94,7 +99,7 @@ bool OfflineScheduler::shouldFeedNow(uint8_t dow, uint16_t minuteOfDay) {
       config.lastRunDay[i] = dow;
       config.lastRunMinute[i] = minuteOfDay;
       
-      LOG("OfflineScheduler: Feed time matched - %02u:%02u", 
+      LOG("OfflineScheduler: Feed time matched - %02u:%02u",
           config.times[i].hour, config.times[i].minute);
       
       return true;
@@ -111,9 +116,23 @@ void OfflineScheduler::resetLastRunGuards() {
   }
 }
 
+bool OfflineScheduler::hasFeedTimes(const FeedTime* times, uint8_t count) const {
+  if (count != config.timesCount) return false;
+  for (uint8_t i = 0; i < count; i++) {
+    if (!(config.times[i] == times[i])) return false;
+  }
+  return true;
+}
+
 void OfflineScheduler::setFeedTimes(const FeedTime* times, uint8_t count) {
   if (count > MAX_FEED_TIMES) count = MAX_FEED_TIMES;
   
+  // Unchanged schedule (e.g. periodic backend re-sync): keep last run guards
+  // so a feed is not repeated within the same minute, and skip the NVS write
+  if (hasFeedTimes(times, count)) {
+    return;
+  }
+  
   config.timesCount = count;
   for (uint8_t i = 0; i < count; i++) {
     config.times[i] = times[i];
@@ -125,6 +144,64 @@ void OfflineScheduler::setFeedTimes(const FeedTime* times, uint8_t count) {
   LOG("OfflineScheduler: Feed times updated - %u times", count);
 }
 
+bool OfflineScheduler::applyProvisioned(const ProvisionConfig& cfg) {
+  // Versions are content hashes from the backend, not a counter: any other
+  // version is a different bundle, only the same one is skipped
+  if (cfg.version == provisionVersion) {
+    LOG("OfflineScheduler: Bundle v%lu already taken - keeping config v%lu",
+        (unsigned long)cfg.version, (unsigned long)configVersion);
+    return false;
+  }
+  
+  uint8_t count = cfg.timesCount > MAX_FEED_TIMES ? MAX_FEED_TIMES : cfg.timesCount;
+  
+  // Keep last run guards if the schedule itself did not change
+  if (!hasFeedTimes(cfg.times, count)) {
+    config.timesCount = count;
+    for (uint8_t i = 0; i < count; i++) {
+      config.times[i] = cfg.times[i];
+    }
+    resetLastRunGuards();
+  }
+  
+  config.excludeDaysBitmap = cfg.excludeDaysBitmap;
+  config.servoAngle = cfg.servoAngle > 180 ? 180 : cfg.servoAngle;
+  config.openHoldMs = cfg.openHoldMs;
+  servoController->setHoldDuration(cfg.openHoldMs);
+  provisionVersion = cfg.version;
+  saveConfig();
+  
+  LOG("OfflineScheduler: Provisioned from bundle v%lu - %u times, angle=%u°, hold=%lu ms, excluded=0x%02X",
+      (unsigned long)cfg.version, config.timesCount, config.servoAngle,
+      (unsigned long)config.openHoldMs, config.excludeDaysBitmap);
+  return true;
+}
+
+uint32_t OfflineScheduler::applyConfig(const ScheduleConfig& next) {
+  uint8_t count = next.timesCount > MAX_FEED_TIMES ? MAX_FEED_TIMES : next.timesCount;
+  
+  // Keep last run guards if the schedule itself did not change
+  if (!hasFeedTimes(next.times, count)) {
+    config.timesCount = count;
+    for (uint8_t i = 0; i < count; i++) {
+      config.times[i] = next.times[i];
+    }
+    resetLastRunGuards();
+  }
+  
+  config.excludeDaysBitmap = next.excludeDaysBitmap;
+  config.servoAngle = next.servoAngle > 180 ? 180 : next.servoAngle;
+  config.openHoldMs = next.openHoldMs;
+  servoController->setHoldDuration(config.openHoldMs);
+  
+  saveConfig();
+  
+  LOG("OfflineScheduler: Config v%lu applied - %u times, angle=%u°, hold=%lu ms, excluded=0x%02X",
+      (unsigned long)configVersion, config.timesCount, config.servoAngle,
+      (unsigned long)config.openHoldMs, config.excludeDaysBitmap);
+  return configVersion;
+}
+
 void OfflineScheduler::setExcludedDays(uint8_t bitmap) {
   config.excludeDaysBitmap = bitmap;
   saveConfig();
@@ -145,38 +222,96 @@ void OfflineScheduler::setOpenHoldDuration(uint32_t ms) {
   LOG("OfflineScheduler: Hold duration = %lu ms", (unsigned long)ms);
 }
 
-void OfflineScheduler::triggerManualFeed() {
+bool OfflineScheduler::triggerManualFeed() {
   if (!servoController->isIdle()) {
     LOG("OfflineScheduler: Cannot feed - motor busy");
-    return;
+    return false;
   }
   
   LOG(">>> FEED TRIGGERED <<<");
   servoController->open(config.servoAngle);
+  return true;
 }
 
-void OfflineScheduler::saveConfig() {
 #if defined(ESP32)
-  Preferences prefs;
-  if (!prefs.begin(NVS_NAMESPACE, false)) {
-    LOG("OfflineScheduler: Failed to save config");
-    return;
-  }
+/**
+ * @brief Persisted part of the config and its version, stored as one blob
+ *        (last run guards are runtime state and not saved)
+ */
+struct StoredSchedule {
+  uint32_t version;
+  uint32_t provisionVersion;  // Bundle the config was last taken from
+  FeedTime times[MAX_FEED_TIMES];
+  uint8_t timesCount;
+  uint8_t excludeDaysBitmap;
+  uint16_t servoAngle;
+  uint32_t openHoldMs;
+};
+
+// Per-field keys written by earlier firmware, read once and then removed
+static bool loadLegacyConfig(Preferences& prefs, StoredSchedule& out) {
+  if (!prefs.isKey("timesCount")) return false;
   
-  prefs.putUChar("timesCount", config.timesCount);
+  out.timesCount = prefs.getUChar("timesCount", 0);
   for (uint8_t i = 0; i < MAX_FEED_TIMES; i++) {
     char key[8];
     snprintf(key, sizeof(key), "t%u_h", i);
-    prefs.putUChar(key, config.times[i].hour);
+    out.times[i].hour = prefs.getUChar(key, 0);
     snprintf(key, sizeof(key), "t%u_m", i);
-    prefs.putUChar(key, config.times[i].minute);
+    out.times[i].minute = prefs.getUChar(key, 0);
   }
+  out.excludeDaysBitmap = prefs.getUChar("excludeBmp", 0);
+  out.servoAngle = prefs.getUShort("angle", SERVO_DEFAULT_ANGLE);
+  out.openHoldMs = prefs.getUInt("holdMs", OPEN_HOLD_MS);
+  out.version = prefs.getUInt("cfgVersion", 0);
+  return true;
+}
+
+static void removeLegacyConfig(Preferences& prefs) {
+  prefs.remove("timesCount");
+  for (uint8_t i = 0; i < MAX_FEED_TIMES; i++) {
+    char key[8];
+    snprintf(key, sizeof(key), "t%u_h", i);
+    prefs.remove(key);
+    snprintf(key, sizeof(key), "t%u_m", i);
+    prefs.remove(key);
+  }
+  prefs.remove("excludeBmp");
+  prefs.remove("angle");
+  prefs.remove("holdMs");
+  prefs.remove("cfgVersion");
+}
+#endif
+
+void OfflineScheduler::saveConfig() {
+  configVersion++;
   
-  prefs.putUChar("excludeBmp", config.excludeDaysBitmap);
-  prefs.putUShort("angle", config.servoAngle);
-  prefs.putUInt("holdMs", config.openHoldMs);
+#if defined(ESP32)
+  Preferences prefs;
+  if (!prefs.begin(NVS_NAMESPACE, false)) {
+    LOGE("OfflineScheduler: Failed to save config");
+    return;
+  }
+  metrics.inc(MET_NVS_WRITES_SCHED);
   
+  // Config and version as one blob: one NVS write, one commit, so a power
+  // loss leaves either the old or the new config, never a mix
+  StoredSchedule stored;
+  memset(&stored, 0, sizeof(stored));
+  stored.version = configVersion;
+  stored.provisionVersion = provisionVersion;
+  memcpy(stored.times, config.times, sizeof(stored.times));
+  stored.timesCount = config.timesCount;
+  stored.excludeDaysBitmap = config.excludeDaysBitmap;
+  stored.servoAngle = config.servoAngle;
+  stored.openHoldMs = config.openHoldMs;
+  size_t written = prefs.putBytes("sched", &stored, sizeof(stored));
   prefs.end();
+  
+  if (written != sizeof(stored)) {
+    LOGE("OfflineScheduler: Config v%lu not saved", (unsigned long)configVersion);
+    return;
+  }
   LOG("OfflineScheduler: Config saved to NVS");
 #endif
 }
@@ -184,35 +319,50 @@ void OfflineScheduler::saveConfig() {
 bool OfflineScheduler::loadConfig() {
 #if defined(ESP32)
   Preferences prefs;
-  if (!prefs.begin(NVS_NAMESPACE, true)) {
-    LOG("OfflineScheduler: Failed to load config");
+  if (!prefs.begin(NVS_NAMESPACE, false)) {
+    LOGE("OfflineScheduler: Failed to load config");
     return false;
   }
   
-  config.timesCount = prefs.getUChar("timesCount", 0);
-  if (config.timesCount > MAX_FEED_TIMES) {
-    config.timesCount = MAX_FEED_TIMES;
+  StoredSchedule stored;
+  memset(&stored, 0, sizeof(stored));
+  stored.servoAngle = SERVO_DEFAULT_ANGLE;
+  stored.openHoldMs = OPEN_HOLD_MS;
+  
+  bool migrate = false;
+  if (prefs.getBytesLength("sched") == sizeof(stored)) {
+    prefs.getBytes("sched", &stored, sizeof(stored));
+  } else {
+    migrate = loadLegacyConfig(prefs, stored);
   }
   
-  for (uint8_t i = 0; i < MAX_FEED_TIMES; i++) {
-    char key[8];
-    snprintf(key, sizeof(key), "t%u_h", i);
-    config.times[i].hour = prefs.getUChar(key, 0);
-    snprintf(key, sizeof(key), "t%u_m", i);
-    config.times[i].minute = prefs.getUChar(key, 0);
+  if (stored.timesCount > MAX_FEED_TIMES) {
+    stored.timesCount = MAX_FEED_TIMES;
   }
+  memcpy(config.times, stored.times, sizeof(config.times));
+  config.timesCount = stored.timesCount;
+  config.excludeDaysBitmap = stored.excludeDaysBitmap;
+  config.servoAngle = stored.servoAngle;
+  config.openHoldMs = stored.openHoldMs;
+  configVersion = stored.version;
+  provisionVersion = stored.provisionVersion;
   
-  config.excludeDaysBitmap = prefs.getUChar("excludeBmp", 0);
-  config.servoAngle = prefs.getUShort("angle", SERVO_DEFAULT_ANGLE);
-  config.openHoldMs = prefs.getUInt("holdMs", OPEN_HOLD_MS);
+  if (migrate) {
+    metrics.inc(MET_NVS_WRITES_SCHED);
+    if (prefs.putBytes("sched", &stored, sizeof(stored)) == sizeof(stored)) {
+      removeLegacyConfig(prefs);
+      LOG("OfflineScheduler: Config migrated to a single NVS record");
+    }
+  }
   
   prefs.end();
   
   resetLastRunGuards();
   servoController->setHoldDuration(config.openHoldMs);
   
-  LOG("OfflineScheduler: Config loaded - %u times, angle=%u°, hold=%lu ms",
-      config.timesCount, config.servoAngle, (unsigned long)config.openHoldMs);
+  LOG("OfflineScheduler: Config v%lu loaded - %u times, angle=%u°, hold=%lu ms",
+      (unsigned long)configVersion, config.timesCount, config.servoAngle,
+      (unsigned long)config.openHoldMs);
   
   return true;
 #else
@@ -225,14 +375,16 @@ void OfflineScheduler::clearSchedule() {
 #if defined(ESP32)
   Preferences prefs;
   if (!prefs.begin(NVS_NAMESPACE, false)) {
-    LOG("OfflineScheduler: Failed to open NVS for clearing");
+    LOGE("OfflineScheduler: Failed to open NVS for clearing");
     return;
   }
+  metrics.inc(MET_NVS_WRITES_SCHED);
   
   prefs.clear();
   prefs.end();
   
   config.timesCount = 0;
+  provisionVersion = 0;
   config.excludeDaysBitmap = 0;
   config.servoAngle = SERVO_DEFAULT_ANGLE;
   config.openHoldMs = OPEN_HOLD_MS;
@@ -10,12 +10,15 @@
  * 
  * Manages feed schedule without internet connection.
  * Uses local time from TimeManager and triggers ServoController.
+ * In online mode the schedule synced from backend is executed here as well.
  */
 class OfflineScheduler {
 private:
   TimeManager* timeManager;
   ServoController* servoController;
   ScheduleConfig config;
+  uint32_t configVersion;   // Bumped on every save, persisted with the config
+  uint32_t provisionVersion;  // Bundle last taken; local edits win until a different one arrives
   
   uint32_t lastTickMs;
   uint16_t lastLoggedMinute;
@@ -55,6 +58,11 @@ public:
    */
   void setFeedTimes(const FeedTime* times, uint8_t count);
   
+  /**
+   * @brief Check if given feed times match the current schedule
+   */
+  bool hasFeedTimes(const FeedTime* times, uint8_t count) const;
+  
   /**
    * @brief Set excluded days bitmap
    * @param bitmap Bit 0=Sun, 1=Mon, ..., 6=Sat
@@ -71,11 +79,35 @@ public:
    */
   void setOpenHoldDuration(uint32_t ms);
   
+  /**
+   * @brief Apply schedule and settings from a provisioning bundle
+   * 
+   * Only a bundle other than the last one taken replaces the config (and is
+   * saved with it); the scheduler's own NVS record is authoritative after
+   * that, so portal edits survive the same bundle being re-applied at boot.
+   * Bundle versions are hashes, so "different" is compared, not "newer".
+   * @return true if the bundle's schedule and settings were taken
+   */
+  bool applyProvisioned(const ProvisionConfig& cfg);
+  
+  /**
+   * @brief Replace schedule and settings together, persisted with one NVS commit
+   * 
+   * Values must already be validated; lastRun fields of next are ignored.
+   * @return New config version
+   */
+  uint32_t applyConfig(const ScheduleConfig& next);
+  
   /**
    * @brief Get current config
    */
   const ScheduleConfig& getConfig() const { return config; }
   
+  /**
+   * @brief Config version (increments with every saved change)
+   */
+  uint32_t getConfigVersion() const { return configVersion; }
+  
   /**
    * @brief Save config to NVS
    */
@@ -88,8 +120,9 @@ public:
   
   /**
    * @brief Trigger manual feed (for testing)
+   * @return false if the motor was busy and nothing was fed
    */
-  void triggerManualFeed();
+  bool triggerManualFeed();
   
   /**
    * @brief Clear schedule from NVS
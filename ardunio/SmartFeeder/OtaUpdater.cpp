@@ -0,0 +1,906 @@
+#define LOG_MODULE LOG_MOD_OTA
+#include "OtaUpdater.h"
+#include "Metrics.h"
+
+#if defined(ESP32)
+  #include <WiFi.h>
+  #include <HTTPClient.h>
+  #include <WiFiClientSecure.h>
+  #include <Update.h>
+  #include <Preferences.h>
+  #include <esp_ota_ops.h>
+  #include <esp_partition.h>
+  #include <esp32/rom/miniz.h>
+  #include <mbedtls/sha256.h>
+  #include <mbedtls/pk.h>
+  #include <mbedtls/base64.h>
+#endif
+
+#if defined(ESP32)
+
+#ifdef CONFIG_APP_ROLLBACK_ENABLE
+// Keep a new image in PENDING_VERIFY until confirmBoot() decides (see esp32-hal-misc.c)
+extern "C" bool verifyRollbackLater() { return true; }
+#endif
+
+// ================== Streaming pipeline ==================
+// HTTP body -> [gzip inflate] -> [delta apply] -> partition writer (+SHA-256)
+
+class OtaSink {
+public:
+  virtual ~OtaSink() {}
+  virtual bool write(const uint8_t* data, size_t len) = 0;
+};
+
+/**
+ * @brief Writes image bytes to the inactive partition and hashes them
+ *
+ * The partition is opened (Update.begin) with the first image byte, so a
+ * delta whose header does not match the manifest never touches flash.
+ */
+class OtaImageWriter : public OtaSink {
+private:
+  mbedtls_sha256_context sha;
+  uint32_t limit;
+  
+public:
+  uint32_t written;
+  bool begun;
+  const char* error;
+  
+  explicit OtaImageWriter(uint32_t imageSize) : limit(imageSize), written(0), begun(false), error(nullptr) {
+    mbedtls_sha256_init(&sha);
+    mbedtls_sha256_starts(&sha, 0);
+  }
+  
+  ~OtaImageWriter() {
+    if (begun) Update.abort();  // No-op after Update.end()
+    mbedtls_sha256_free(&sha);
+  }
+  
+  bool write(const uint8_t* data, size_t len) override {
+    if (written + len > limit) {
+      error = "image larger than manifest size";
+      return false;
+    }
+    if (!begun) {
+      if (!Update.begin(limit)) {
+        error = Update.errorString();
+        return false;
+      }
+      begun = true;
+    }
+    if (Update.write((uint8_t*)data, len) != len) {
+      error = Update.errorString();
+      return false;
+    }
+    mbedtls_sha256_update(&sha, data, len);
+    written += len;
+    return true;
+  }
+  
+  void finish(uint8_t* hash) { mbedtls_sha256_finish(&sha, hash); }
+};
+
+/**
+ * @brief Applies a delta patch against the running partition
+ *
+ * Format: "SFD1" | u32 targetSize | ops... | 'E'
+ *   'C' u32 srcOffset u32 length   copy bytes from running image
+ *   'D' u32 length <bytes>         literal bytes
+ * All integers little endian.
+ */
+class OtaDeltaApplier : public OtaSink {
+private:
+  enum Stage : uint8_t { DELTA_HEADER, DELTA_OP, DELTA_COPY_ARGS, DELTA_DATA_ARGS, DELTA_DATA };
+  
+  OtaSink* out;
+  const esp_partition_t* base;
+  uint32_t baseSize;
+  uint32_t expectedSize;
+  Stage stage;
+  uint8_t buf[8];
+  uint8_t have;
+  uint8_t need;
+  uint32_t dataLeft;
+  
+  static uint32_t le32(const uint8_t* p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+  }
+  
+  bool copyFromBase(uint32_t offset, uint32_t length) {
+    if (offset > baseSize || length > baseSize - offset) return false;
+    
+    uint8_t chunk[512];
+    while (length > 0) {
+      uint32_t n = length < sizeof(chunk) ? length : sizeof(chunk);
+      if (esp_partition_read(base, offset, chunk, n) != ESP_OK) return false;
+      if (!out->write(chunk, n)) return false;
+      offset += n;
+      length -= n;
+    }
+    return true;
+  }
+  
+  bool step() {
+    switch (stage) {
+      case DELTA_HEADER:
+        if (memcmp(buf, "SFD1", 4) != 0) return false;
+        targetSize = le32(buf + 4);
+        if (targetSize != expectedSize) {
+          sizeMismatch = true;  // Before the first image byte, so before Update.begin
+          return false;
+        }
+        stage = DELTA_OP;
+        need = 1;
+        break;
+      case DELTA_OP:
+        if (buf[0] == 'C') {
+          stage = DELTA_COPY_ARGS;
+          need = 8;
+        } else if (buf[0] == 'D') {
+          stage = DELTA_DATA_ARGS;
+          need = 4;
+        } else if (buf[0] == 'E') {
+          done = true;
+        } else {
+          return false;
+        }
+        break;
+      case DELTA_COPY_ARGS:
+        if (!copyFromBase(le32(buf), le32(buf + 4))) return false;
+        stage = DELTA_OP;
+        need = 1;
+        break;
+      case DELTA_DATA_ARGS:
+        dataLeft = le32(buf);
+        stage = dataLeft > 0 ? DELTA_DATA : DELTA_OP;
+        need = 1;
+        break;
+      default:
+        return false;
+    }
+    have = 0;
+    return true;
+  }
+  
+public:
+  uint32_t targetSize;
+  bool sizeMismatch;
+  bool done;
+  
+  OtaDeltaApplier(OtaSink* sink, const esp_partition_t* running, uint32_t runningSize, uint32_t imageSize)
+    : out(sink), base(running), baseSize(runningSize), expectedSize(imageSize), stage(DELTA_HEADER)
+    , have(0), need(8), dataLeft(0), targetSize(0), sizeMismatch(false), done(false) {
+  }
+  
+  bool write(const uint8_t* data, size_t len) override {
+    while (len > 0) {
+      if (done) return false;  // Data after end marker
+      
+      if (stage == DELTA_DATA) {
+        size_t n = len < dataLeft ? len : dataLeft;
+        if (!out->write(data, n)) return false;
+        data += n;
+        len -= n;
+        dataLeft -= n;
+        if (dataLeft == 0) stage = DELTA_OP;
+        continue;
+      }
+      
+      buf[have++] = *data++;
+      len--;
+      if (have == need && !step()) return false;
+    }
+    return true;
+  }
+};
+
+/**
+ * @brief Streaming gzip decoder on top of the ROM miniz inflater
+ *
+ * Uses the 32 KB output buffer as the LZ dictionary, so memory use does
+ * not depend on image size. The gzip trailer is ignored (SHA-256 of the
+ * written image is checked instead).
+ */
+class OtaInflater : public OtaSink {
+private:
+  enum Stage : uint8_t { GZ_FIXED, GZ_EXTRA_LEN, GZ_EXTRA, GZ_NAME, GZ_COMMENT, GZ_HCRC, GZ_BODY };
+  
+  OtaSink* out;
+  tinfl_decompressor* decomp;
+  uint8_t* dict;
+  size_t dictOfs;
+  Stage stage;
+  uint8_t flags;
+  uint16_t pos;
+  uint16_t extraLen;
+  
+  void nextHeaderStage() {
+    pos = 0;
+    if (flags & 0x04) { flags &= ~0x04; stage = GZ_EXTRA_LEN; extraLen = 0; }
+    else if (flags & 0x08) { flags &= ~0x08; stage = GZ_NAME; }
+    else if (flags & 0x10) { flags &= ~0x10; stage = GZ_COMMENT; }
+    else if (flags & 0x02) { flags &= ~0x02; stage = GZ_HCRC; }
+    else stage = GZ_BODY;
+  }
+  
+  bool header(uint8_t b) {
+    switch (stage) {
+      case GZ_FIXED:
+        if ((pos == 0 && b != 0x1f) || (pos == 1 && b != 0x8b) || (pos == 2 && b != 8)) return false;
+        if (pos == 3) flags = b;
+        if (++pos == 10) nextHeaderStage();
+        break;
+      case GZ_EXTRA_LEN:
+        extraLen |= (uint16_t)b << (8 * pos);
+        if (++pos == 2) {
+          pos = 0;
+          stage = GZ_EXTRA;
+          if (extraLen == 0) nextHeaderStage();
+        }
+        break;
+      case GZ_EXTRA:
+        if (++pos == extraLen) nextHeaderStage();
+        break;
+      case GZ_NAME:
+      case GZ_COMMENT:
+        if (b == 0) nextHeaderStage();
+        break;
+      case GZ_HCRC:
+        if (++pos == 2) nextHeaderStage();
+        break;
+      default:
+        break;
+    }
+    return true;
+  }
+  
+public:
+  bool done;
+  
+  explicit OtaInflater(OtaSink* sink)
+    : out(sink), decomp(nullptr), dict(nullptr), dictOfs(0), stage(GZ_FIXED)
+    , flags(0), pos(0), extraLen(0), done(false) {
+  }
+  
+  ~OtaInflater() {
+    free(decomp);
+    free(dict);
+  }
+  
+  bool init() {
+    decomp = (tinfl_decompressor*)malloc(sizeof(tinfl_decompressor));
+    dict = (uint8_t*)malloc(TINFL_LZ_DICT_SIZE);
+    if (!decomp || !dict) return false;
+    tinfl_init(decomp);
+    return true;
+  }
+  
+  bool write(const uint8_t* data, size_t len) override {
+    while (len > 0 && stage != GZ_BODY) {
+      if (!header(*data)) return false;
+      data++;
+      len--;
+    }
+    if (stage != GZ_BODY || done) {
+      return true;  // Header incomplete, or trailer after end of stream
+    }
+    
+    for (;;) {
+      size_t inBytes = len;
+      size_t outBytes = TINFL_LZ_DICT_SIZE - dictOfs;
+      tinfl_status status = tinfl_decompress(decomp, data, &inBytes, dict, dict + dictOfs,
+                                             &outBytes, TINFL_FLAG_HAS_MORE_INPUT);
+      data += inBytes;
+      len -= inBytes;
+      
+      if (outBytes > 0) {
+        if (!out->write(dict + dictOfs, outBytes)) return false;
+        dictOfs = (dictOfs + outBytes) & (TINFL_LZ_DICT_SIZE - 1);
+      }
+      
+      if (status < TINFL_STATUS_DONE) return false;
+      if (status == TINFL_STATUS_DONE) {
+        done = true;
+        return true;
+      }
+      if (status == TINFL_STATUS_NEEDS_MORE_INPUT && len == 0) {
+        return true;
+      }
+    }
+  }
+};
+
+static void toHex(const uint8_t* data, size_t len, char* out) {
+  static const char digits[] = "0123456789abcdef";
+  for (size_t i = 0; i < len; i++) {
+    out[i * 2] = digits[data[i] >> 4];
+    out[i * 2 + 1] = digits[data[i] & 0x0f];
+  }
+  out[len * 2] = '\0';
+}
+
+/**
+ * @brief Download in progress: pipeline and connection, kept across loop passes
+ */
+struct OtaDownload {
+  OtaImageWriter writer;
+  OtaDeltaApplier applier;
+  OtaInflater inflater;
+  OtaSink* head;
+  bool gzip;
+  bool delta;
+  uint32_t imageSize;
+  String sha256Hex;
+  String signatureB64;
+  String runningLabel;
+  
+  WiFiClient plainClient;
+  WiFiClientSecure secureClient;
+  HTTPClient http;
+  WiFiClient* stream;
+  int remaining;            // -1 if the length is unknown
+  unsigned long lastData;
+  
+  OtaDownload(bool gz, bool dl, uint32_t size, const esp_partition_t* running)
+    : writer(size)
+    , applier(&writer, running, running ? running->size : 0, size)
+    , inflater(dl ? (OtaSink*)&applier : (OtaSink*)&writer)
+    , head(nullptr)
+    , gzip(gz)
+    , delta(dl)
+    , imageSize(size)
+    , runningLabel(running ? running->label : "")
+    , stream(nullptr)
+    , remaining(-1)
+    , lastData(0) {
+    OtaSink* imageSink = delta ? (OtaSink*)&applier : (OtaSink*)&writer;
+    head = gzip ? (OtaSink*)&inflater : imageSink;
+  }
+};
+
+// ================== OtaUpdater ==================
+
+OtaUpdater::OtaUpdater()
+  : backend(nullptr)
+  , state(OTA_IDLE)
+  , nextCheckAt(0)
+  , verifyDeadline(0)
+  , forceFull(false)
+  , download(nullptr)
+  , downloadStart(0)
+  , lastDownloadBytes(0)
+  , lastImageBytes(0)
+  , lastDurationMs(0)
+  , lastWasDelta(false) {
+}
+
+void OtaUpdater::begin(const BackendClient* backendClient, const String& token) {
+  backend = backendClient;
+  authToken = token;
+  
+  nextCheckAt = millis() + OTA_STARTUP_DELAY_MS + (uint32_t)random(OTA_STARTUP_SPREAD_MS);
+  
+  const esp_partition_t* running = esp_ota_get_running_partition();
+  LOG("OTA: Running from partition %s", running ? running->label : "?");
+  
+  // Pending flag is written right before rebooting into a new image
+  Preferences prefs;
+  if (!prefs.begin(NVS_NAMESPACE, false)) {
+    return;
+  }
+  
+  if (prefs.getBool("otaPending", false)) {
+    previousPartition = prefs.getString("otaPrev", "");
+    uint8_t boots = prefs.getUChar("otaBoots", 0) + 1;
+    prefs.putUChar("otaBoots", boots);
+    metrics.inc(MET_NVS_WRITES_OTA);
+    prefs.end();
+    
+    state = OTA_PENDING_VERIFY;
+    verifyDeadline = millis() + OTA_HEALTH_TIMEOUT_MS;
+    LOG("OTA: New image on probation (boot %u, previous %s)", boots, previousPartition.c_str());
+    
+    // Image that keeps resetting before it can confirm itself
+    if (boots > OTA_MAX_UNCONFIRMED_BOOTS) {
+      rollback("boot loop");
+    }
+    return;
+  }
+  prefs.end();
+}
+
+void OtaUpdater::tick(bool allowed) {
+  // A download runs in bounded steps, feeds keep their timing meanwhile
+  if (state == OTA_DOWNLOADING) {
+    continueDownload();
+    return;
+  }
+  
+  // Verified image: restart into it between feeds
+  if (state == OTA_PENDING_REBOOT) {
+    if (!allowed) return;
+    LOG("OTA: Rebooting into new firmware");
+    delay(500);
+#if LOG_ASYNC
+    logger.flush();
+#endif
+    ESP.restart();
+    return;
+  }
+  
+  if (state == OTA_PENDING_VERIFY || !allowed || !backend || backend->getEndpointCount() == 0) {
+    return;
+  }
+  if ((int32_t)(millis() - nextCheckAt) < 0) {
+    return;
+  }
+  
+  nextCheckAt = millis() + OTA_CHECK_INTERVAL_MS + (uint32_t)random(OTA_CHECK_INTERVAL_MS / 10);
+  
+  if (strlen(OTA_SIGNING_PUBLIC_KEY) == 0) {
+    LOG("OTA: No signing key configured - updates disabled");
+    return;
+  }
+  if (WiFi.status() != WL_CONNECTED) {
+    return;
+  }
+  
+  checkAndUpdate();
+}
+
+void OtaUpdater::cancel() {
+  if (state != OTA_DOWNLOADING) return;
+  abortDownload("cancelled");
+}
+
+void OtaUpdater::confirmBoot(bool healthy) {
+  if (state != OTA_PENDING_VERIFY) {
+    return;
+  }
+  
+  if (healthy) {
+#ifdef CONFIG_APP_ROLLBACK_ENABLE
+    esp_ota_mark_app_valid_cancel_rollback();
+#endif
+    Preferences prefs;
+    if (prefs.begin(NVS_NAMESPACE, false)) {
+      metrics.inc(MET_NVS_WRITES_OTA);
+      prefs.remove("otaPending");
+      prefs.remove("otaPrev");
+      prefs.remove("otaBoots");
+      prefs.end();
+    }
+    state = OTA_IDLE;
+    LOG("OTA: Firmware %s confirmed healthy", FIRMWARE_VERSION);
+    return;
+  }
+  
+  if ((int32_t)(millis() - verifyDeadline) >= 0) {
+    rollback("health check timeout");
+  }
+}
+
+void OtaUpdater::rollback(const char* reason) {
+  LOG("OTA: Rolling back - %s", reason);
+  
+  Preferences prefs;
+  if (prefs.begin(NVS_NAMESPACE, false)) {
+    metrics.inc(MET_NVS_WRITES_OTA);
+    prefs.remove("otaPending");
+    prefs.remove("otaBoots");
+    prefs.end();
+  }
+  
+#ifdef CONFIG_APP_ROLLBACK_ENABLE
+  esp_ota_img_states_t imgState;
+  if (esp_ota_get_state_partition(esp_ota_get_running_partition(), &imgState) == ESP_OK &&
+      imgState == ESP_OTA_IMG_PENDING_VERIFY) {
+    esp_ota_mark_app_invalid_rollback_and_reboot();  // Does not return on success
+  }
+#endif
+  
+  const esp_partition_t* previous = esp_partition_find_first(
+      ESP_PARTITION_TYPE_APP, ESP_PARTITION_SUBTYPE_ANY, previousPartition.c_str());
+  if (previous == nullptr || esp_ota_set_boot_partition(previous) != ESP_OK) {
+    LOG("OTA: Previous partition '%s' not bootable - keeping current image", previousPartition.c_str());
+    state = OTA_FAILED;
+    lastError = "rollback failed";
+    return;
+  }
+  
+  delay(500);
+#if LOG_ASYNC
+  logger.flush();
+#endif
+  ESP.restart();
+}
+
+bool OtaUpdater::checkAndUpdate() {
+  String query = "/ota/manifest?mac=" + backend->getMacAddress() + "&version=" + FIRMWARE_VERSION;
+  if (forceFull) {
+    query += "&full=1";
+  }
+  
+  WiFiClient plainClient;
+  WiFiClientSecure secureClient;
+  HTTPClient http;
+  String url = resolveUrl(query);
+  if (!beginRequest(http, plainClient, secureClient, url)) {
+    fail("manifest request failed");
+    return false;
+  }
+  
+  int httpCode = http.GET();
+  if (httpCode == 204) {
+    http.end();
+    LOG("OTA: Firmware %s is up to date", FIRMWARE_VERSION);
+    return false;
+  }
+  if (httpCode != 200) {
+    http.end();
+    LOG("OTA: Manifest request failed: %d", httpCode);
+    return false;
+  }
+  String manifest = http.getString();
+  http.end();
+  
+  // {"version":"4.0.1","url":"/ota/files/..","encoding":"gzip","delta":true,"size":N,
+  //  "sha256":"..","signature":"..","baseSize":N,"baseSha256":"..","downloadSize":N}
+  String version, imageUrl, encoding, sha256Hex, signature, baseSha256Hex;
+  long size = 0, baseSize = 0, downloadSize = 0;
+  if (!parseJsonString(manifest, "version", version) ||
+      !parseJsonString(manifest, "url", imageUrl) ||
+      !parseJsonString(manifest, "sha256", sha256Hex) ||
+      !parseJsonString(manifest, "signature", signature) ||
+      !parseJsonLong(manifest, "size", size) || size <= 0) {
+    fail("invalid manifest");
+    return false;
+  }
+  parseJsonString(manifest, "encoding", encoding);
+  parseJsonLong(manifest, "downloadSize", downloadSize);
+  bool delta = parseJsonBool(manifest, "delta");
+  if (delta) {
+    parseJsonString(manifest, "baseSha256", baseSha256Hex);
+    parseJsonLong(manifest, "baseSize", baseSize);
+  }
+  
+  if (version == FIRMWARE_VERSION) {
+    return false;
+  }
+  
+  LOG("OTA: Update %s -> %s (%s%s, %ld bytes to download, image %ld bytes)",
+      FIRMWARE_VERSION, version.c_str(), delta ? "delta+" : "",
+      encoding.length() > 0 ? encoding.c_str() : "identity", downloadSize, size);
+  
+  return startDownload(resolveUrl(imageUrl), encoding == "gzip", delta, (uint32_t)size,
+                       sha256Hex, signature, (uint32_t)baseSize, baseSha256Hex);
+}
+
+bool OtaUpdater::startDownload(const String& url, bool gzip, bool delta, uint32_t imageSize,
+                               const String& sha256Hex, const String& signatureB64,
+                               uint32_t baseSize, const String& baseSha256Hex) {
+  const esp_partition_t* running = esp_ota_get_running_partition();
+  
+  const esp_partition_t* target = esp_ota_get_next_update_partition(nullptr);
+  if (target == nullptr || imageSize > target->size) {
+    fail("image larger than OTA partition");
+    return false;
+  }
+  
+  if (delta && !runningImageMatches(baseSize, baseSha256Hex)) {
+    // Running build is not the delta base (e.g. locally flashed): ask for full image next time
+    forceFull = true;
+    nextCheckAt = millis() + 60000;
+    fail("delta base mismatch");
+    return false;
+  }
+  
+  download = new OtaDownload(gzip, delta, imageSize, running);
+  download->sha256Hex = sha256Hex;
+  download->signatureB64 = signatureB64;
+  
+  if (gzip && !download->inflater.init()) {
+    abortDownload("out of memory for inflater");
+    return false;
+  }
+  
+  HTTPClient& http = download->http;
+  http.useHTTP10(true);  // No chunked encoding, body is read raw from the stream
+  if (!beginRequest(http, download->plainClient, download->secureClient, url)) {
+    abortDownload("image request failed");
+    return false;
+  }
+  
+  int httpCode = http.GET();
+  if (httpCode != 200) {
+    LOG("OTA: Image download failed: %d", httpCode);
+    abortDownload("image download failed");
+    return false;
+  }
+  
+  state = OTA_DOWNLOADING;
+  downloadStart = millis();
+  lastWasDelta = delta;
+  lastDownloadBytes = 0;
+  lastImageBytes = 0;
+  
+  download->remaining = http.getSize();
+  download->stream = http.getStreamPtr();
+  download->lastData = millis();
+  return true;
+}
+
+void OtaUpdater::continueDownload() {
+  OtaDownload& d = *download;
+  uint8_t buf[1024];
+  uint32_t stepBytes = 0;
+  
+  // At most OTA_STEP_BYTES per loop pass (inflated and written at once)
+  while (d.remaining != 0 && stepBytes < OTA_STEP_BYTES) {
+    int avail = d.stream->available();
+    if (avail <= 0) {
+      if (d.stream->connected() && millis() - d.lastData <= OTA_STREAM_TIMEOUT_MS) {
+        return;  // Nothing buffered yet, next loop pass
+      }
+      break;
+    }
+    
+    int want = avail < (int)sizeof(buf) ? avail : (int)sizeof(buf);
+    int n = d.stream->read(buf, want);
+    if (n <= 0) return;
+    d.lastData = millis();
+    lastDownloadBytes += n;
+    stepBytes += n;
+    if (d.remaining > 0) d.remaining -= n;
+    
+    if (!d.head->write(buf, n)) {
+      abortDownload(d.applier.sizeMismatch ? "delta target size mismatch"
+                    : d.writer.error ? d.writer.error : "corrupt image stream");
+      return;
+    }
+  }
+  
+  if (d.remaining == 0 || !d.stream->connected() || millis() - d.lastData > OTA_STREAM_TIMEOUT_MS) {
+    finishDownload();
+  }
+}
+
+void OtaUpdater::finishDownload() {
+  OtaDownload& d = *download;
+  d.http.end();
+  
+  lastImageBytes = d.writer.written;
+  lastDurationMs = millis() - downloadStart;
+  
+  if (d.remaining > 0 || d.writer.written != d.imageSize ||
+      (d.gzip && !d.inflater.done) || (d.delta && !d.applier.done)) {
+    abortDownload("incomplete image");
+    return;
+  }
+  
+  uint8_t hash[32];
+  char hashHex[65];
+  d.writer.finish(hash);
+  toHex(hash, sizeof(hash), hashHex);
+  if (!d.sha256Hex.equalsIgnoreCase(hashHex)) {
+    abortDownload("SHA-256 mismatch");
+    return;
+  }
+  if (!verifySignature(hash, d.signatureB64)) {
+    abortDownload("invalid signature");
+    return;
+  }
+  
+  // Sets the new partition as boot partition
+  if (!Update.end()) {
+    abortDownload(Update.errorString());
+    return;
+  }
+  
+  LOG("OTA: Image verified - %lu bytes downloaded for %lu byte image in %lu ms",
+      (unsigned long)lastDownloadBytes, (unsigned long)lastImageBytes, (unsigned long)lastDurationMs);
+  
+  Preferences prefs;
+  if (prefs.begin(NVS_NAMESPACE, false)) {
+    metrics.inc(MET_NVS_WRITES_OTA);
+    prefs.putBool("otaPending", true);
+    prefs.putString("otaPrev", d.runningLabel);
+    prefs.putUChar("otaBoots", 0);
+    prefs.end();
+  }
+  
+  delete download;
+  download = nullptr;
+  forceFull = false;
+  state = OTA_PENDING_REBOOT;  // tick() restarts once no feed is running
+}
+
+void OtaUpdater::abortDownload(const char* reason) {
+  // Copy first: the reason may point into the download (Update error string)
+  String why = reason;
+  if (download) {
+    download->http.end();
+    delete download;  // Aborts the partition write if one was started
+    download = nullptr;
+  }
+  fail(why.c_str());
+}
+
+bool OtaUpdater::runningImageMatches(uint32_t baseSize, const String& sha256Hex) {
+  const esp_partition_t* running = esp_ota_get_running_partition();
+  if (running == nullptr || baseSize == 0 || baseSize > running->size || sha256Hex.length() != 64) {
+    return false;
+  }
+  
+  mbedtls_sha256_context sha;
+  mbedtls_sha256_init(&sha);
+  mbedtls_sha256_starts(&sha, 0);
+  
+  uint8_t chunk[1024];
+  bool ok = true;
+  for (uint32_t offset = 0; offset < baseSize; offset += sizeof(chunk)) {
+    uint32_t n = baseSize - offset < sizeof(chunk) ? baseSize - offset : sizeof(chunk);
+    if (esp_partition_read(running, offset, chunk, n) != ESP_OK) {
+      ok = false;
+      break;
+    }
+    mbedtls_sha256_update(&sha, chunk, n);
+  }
+  
+  uint8_t hash[32];
+  char hashHex[65];
+  mbedtls_sha256_finish(&sha, hash);
+  mbedtls_sha256_free(&sha);
+  toHex(hash, sizeof(hash), hashHex);
+  
+  return ok && sha256Hex.equalsIgnoreCase(hashHex);
+}
+
+bool OtaUpdater::verifySignature(const uint8_t* hash, const String& signatureB64) {
+  uint8_t sig[MBEDTLS_PK_SIGNATURE_MAX_SIZE];
+  size_t sigLen = 0;
+  if (mbedtls_base64_decode(sig, sizeof(sig), &sigLen,
+                            (const unsigned char*)signatureB64.c_str(), signatureB64.length()) != 0) {
+    return false;
+  }
+  
+  mbedtls_pk_context pk;
+  mbedtls_pk_init(&pk);
+  int rc = mbedtls_pk_parse_public_key(&pk, (const unsigned char*)OTA_SIGNING_PUBLIC_KEY,
+                                       strlen(OTA_SIGNING_PUBLIC_KEY) + 1);
+  if (rc == 0) {
+    rc = mbedtls_pk_verify(&pk, MBEDTLS_MD_SHA256, hash, 32, sig, sigLen);
+  }
+  mbedtls_pk_free(&pk);
+  
+  return rc == 0;
+}
+
+String OtaUpdater::resolveUrl(const String& url) const {
+  // Relative URLs point at the backend endpoint in use (after failover),
+  // absolute ones at a local file server
+  if (url.startsWith("http://") || url.startsWith("https://")) {
+    return url;
+  }
+  const BackendEndpoint& ep = backend->getEndpoint(backend->getActiveEndpoint());
+  String protocol = backend->isSecure() ? "https://" : "http://";
+  return protocol + ep.host + ":" + String(ep.port) + url;
+}
+
+bool OtaUpdater::beginRequest(HTTPClient& http, WiFiClient& plainClient,
+                              WiFiClientSecure& secureClient, const String& url) {
+  http.setTimeout(OTA_HTTP_TIMEOUT_MS);
+  
+  bool ok;
+  if (url.startsWith("https://")) {
+    // Image integrity comes from the signature, not from the transport
+    secureClient.setInsecure();
+    ok = http.begin(secureClient, url);
+  } else {
+    ok = http.begin(plainClient, url);
+  }
+  if (!ok) {
+    return false;
+  }
+  
+  if (authToken.length() > 0) {
+    for (uint8_t i = 0; i < backend->getEndpointCount(); i++) {
+      if (url.indexOf(backend->getEndpoint(i).host) >= 0) {
+        http.addHeader("Authorization", "Bearer " + authToken);
+        break;
+      }
+    }
+  }
+  http.addHeader("X-Device-Mac", backend->getMacAddress());
+  return true;
+}
+
+void OtaUpdater::fail(const char* reason) {
+  state = OTA_FAILED;
+  lastError = reason;
+  LOG("OTA: Update failed - %s", reason);
+}
+
+#else // ESP8266: no A/B partitions, OTA not supported
+
+OtaUpdater::OtaUpdater()
+  : backend(nullptr)
+  , state(OTA_IDLE)
+  , nextCheckAt(0)
+  , verifyDeadline(0)
+  , forceFull(false)
+  , lastDownloadBytes(0)
+  , lastImageBytes(0)
+  , lastDurationMs(0)
+  , lastWasDelta(false) {
+}
+
+void OtaUpdater::begin(const BackendClient* backendClient, const String& token) {
+  LOG("OTA: Not supported on this platform");
+}
+
+void OtaUpdater::tick(bool allowed) {
+}
+
+void OtaUpdater::cancel() {
+}
+
+void OtaUpdater::confirmBoot(bool healthy) {
+}
+
+#endif
+
+const char* OtaUpdater::getStateString() const {
+  switch (state) {
+    case OTA_DOWNLOADING:    return "DOWNLOADING";
+    case OTA_PENDING_REBOOT: return "PENDING_REBOOT";
+    case OTA_PENDING_VERIFY: return "PENDING_VERIFY";
+    case OTA_FAILED:         return "FAILED";
+    default:                 return "IDLE";
+  }
+}
+
+bool OtaUpdater::parseJsonString(const String& json, const char* key, String& value) {
+  String quoted = String("\"") + key + "\"";
+  int keyIdx = json.indexOf(quoted);
+  if (keyIdx < 0) return false;
+  
+  int colonIdx = json.indexOf(":", keyIdx + quoted.length());
+  int quoteStart = json.indexOf("\"", colonIdx + 1);
+  int quoteEnd = json.indexOf("\"", quoteStart + 1);
+  if (colonIdx < 0 || quoteStart < 0 || quoteEnd < 0) return false;
+  
+  value = json.substring(quoteStart + 1, quoteEnd);
+  return true;
+}
+
+bool OtaUpdater::parseJsonLong(const String& json, const char* key, long& value) {
+  String quoted = String("\"") + key + "\"";
+  int keyIdx = json.indexOf(quoted);
+  if (keyIdx < 0) return false;
+  
+  int colonIdx = json.indexOf(":", keyIdx + quoted.length());
+  if (colonIdx < 0) return false;
+  
+  String rest = json.substring(colonIdx + 1, colonIdx + 16);
+  rest.trim();
+  if (rest.length() == 0 || rest.startsWith("null")) return false;
+  
+  value = rest.toInt();
+  return true;
+}
+
+bool OtaUpdater::parseJsonBool(const String& json, const char* key) {
+  String quoted = String("\"") + key + "\"";
+  int keyIdx = json.indexOf(quoted);
+  if (keyIdx < 0) return false;
+  
+  int colonIdx = json.indexOf(":", keyIdx + quoted.length());
+  if (colonIdx < 0) return false;
+  
+  String rest = json.substring(colonIdx + 1, colonIdx + 8);
+  rest.trim();
+  return rest.startsWith("true");
+}
@@ -0,0 +1,167 @@
+#ifndef OTA_UPDATER_H
+#define OTA_UPDATER_H
+
+#include "Config.h"
+#include "BackendClient.h"
+
+#if defined(ESP32)
+  #include <WiFiClientSecure.h>
+  #include <HTTPClient.h>
+#endif
+
+struct OtaDownload;
+
+/**
+ * @brief OTA updater states
+ */
+enum OtaState : uint8_t {
+  OTA_IDLE = 0,
+  OTA_DOWNLOADING = 1,
+  OTA_PENDING_REBOOT = 2,   // New image written and verified, restarting
+  OTA_PENDING_VERIFY = 3,   // Running a new image, waiting for health check
+  OTA_FAILED = 4            // Last attempt failed (retried on next check)
+};
+
+/**
+ * @brief Over-the-air firmware updater (ESP32)
+ * 
+ * Polls the backend for a manifest and streams the image straight into
+ * the inactive OTA partition (A/B), without buffering it in RAM. The
+ * download advances OTA_STEP_BYTES per loop pass, so feeds and the web
+ * portal keep running while it is in progress:
+ * - gzip compressed full images (inflated with ROM miniz)
+ * - gzip compressed delta patches against the running build
+ * - SHA-256 and ECDSA signature check before the image is activated
+ * - Rollback if the new image does not pass the post-boot health check
+ */
+class OtaUpdater {
+private:
+  const BackendClient* backend;  // Active endpoint (after failover), MAC, HTTPS
+  String authToken;
+  String previousPartition;  // Partition to return to if the new image fails
+  
+  OtaState state;
+  unsigned long nextCheckAt;
+  unsigned long verifyDeadline;
+  bool forceFull;
+  
+#if defined(ESP32)
+  OtaDownload* download;  // Only while OTA_DOWNLOADING
+#endif
+  unsigned long downloadStart;
+  
+  // Statistics of the last update attempt
+  uint32_t lastDownloadBytes;
+  uint32_t lastImageBytes;
+  uint32_t lastDurationMs;
+  bool lastWasDelta;
+  String lastError;
+  
+  static const uint32_t OTA_STARTUP_DELAY_MS = 300000;   // First check 5 min after boot
+  static const uint32_t OTA_STARTUP_SPREAD_MS = 600000;  // + random spread for the fleet
+  static const uint16_t OTA_HTTP_TIMEOUT_MS = 10000;
+  static const uint32_t OTA_STREAM_TIMEOUT_MS = 15000;   // No data for this long aborts
+  static const uint32_t OTA_STEP_BYTES = 4096;           // Download bytes per loop pass
+  static const uint8_t OTA_MAX_UNCONFIRMED_BOOTS = 3;    // Boot loop guard (no bootloader rollback)
+  
+  /**
+   * @brief Request manifest and start the download if an update is offered
+   * @return true if a download was started
+   */
+  bool checkAndUpdate();
+  
+  /**
+   * @brief Check sizes and the delta base, open the image request
+   */
+  bool startDownload(const String& url, bool gzip, bool delta, uint32_t imageSize,
+                     const String& sha256Hex, const String& signatureB64,
+                     uint32_t baseSize, const String& baseSha256Hex);
+  
+  /**
+   * @brief Feed up to OTA_STEP_BYTES of the image into the partition
+   */
+  void continueDownload();
+  
+  /**
+   * @brief Verify the written image and make it the boot partition
+   */
+  void finishDownload();
+  
+  void abortDownload(const char* reason);
+  
+  /**
+   * @brief Check SHA-256 of the first baseSize bytes of the running partition
+   */
+  bool runningImageMatches(uint32_t baseSize, const String& sha256Hex);
+  
+  /**
+   * @brief Verify ECDSA signature (DER, base64) over image SHA-256
+   */
+  bool verifySignature(const uint8_t* hash, const String& signatureB64);
+  
+  /**
+   * @brief Boot previous partition (does not return on success)
+   */
+  void rollback(const char* reason);
+  
+  void fail(const char* reason);
+  
+#if defined(ESP32)
+  String resolveUrl(const String& url) const;
+  bool beginRequest(HTTPClient& http, WiFiClient& plainClient,
+                    WiFiClientSecure& secureClient, const String& url);
+#endif
+  
+  static bool parseJsonString(const String& json, const char* key, String& value);
+  static bool parseJsonLong(const String& json, const char* key, long& value);
+  static bool parseJsonBool(const String& json, const char* key);
+  
+public:
+  OtaUpdater();
+  
+  /**
+   * @brief Initialize updater and detect a pending post-update boot
+   * @param backendClient Source of the endpoint in use, MAC and transport
+   * 
+   * Rolls back immediately if an unconfirmed image keeps rebooting.
+   */
+  void begin(const BackendClient* backendClient, const String& token);
+  
+  /**
+   * @brief Check for updates periodically, advance a running download (call in loop)
+   * @param allowed false while feeding or while backend is unreachable
+   *        (no new check and no restart then; a download keeps going)
+   */
+  void tick(bool allowed);
+  
+  /**
+   * @brief Abort a download in progress (leaving online mode)
+   */
+  void cancel();
+  
+  /**
+   * @brief Post-boot health check of a freshly installed image
+   * @param healthy true once the new firmware has proven it works
+   * 
+   * Marks the image valid when healthy, rolls back to the previous
+   * partition if the health deadline passes first.
+   */
+  void confirmBoot(bool healthy);
+  
+  /**
+   * @brief Request an update check on the next tick
+   */
+  void requestCheck() { nextCheckAt = millis(); }
+  
+  OtaState getState() const { return state; }
+  const char* getStateString() const;
+  bool isPendingVerify() const { return state == OTA_PENDING_VERIFY; }
+  
+  uint32_t getLastDownloadBytes() const { return lastDownloadBytes; }
+  uint32_t getLastImageBytes() const { return lastImageBytes; }
+  uint32_t getLastDurationMs() const { return lastDurationMs; }
+  bool wasLastDelta() const { return lastWasDelta; }
+  const String& getLastError() const { return lastError; }
+};
+
+#endif // OTA_UPDATER_H
@@ -0,0 +1,376 @@
+#define LOG_MODULE LOG_MOD_PROV
+#include "ProvisionManager.h"
+#include "Metrics.h"
+
+#if defined(ESP32)
+  #include <Preferences.h>
+#endif
+
+ProvisionManager::ProvisionManager()
+  : updatePending(false)
+  , receiving(false)
+  , depth(0)
+  , inString(false)
+  , inLiteral(false)
+  , escaped(false)
+  , expectKey(false)
+  , rootClosed(false)
+  , parseError(false)
+  , tokenLen(0)
+  , bytesReceived(0)
+  , fieldsParsed(0) {
+  
+  setDefaults(active);
+  setDefaults(staged);
+}
+
+void ProvisionManager::setDefaults(ProvisionConfig& cfg) {
+  memset(&cfg, 0, sizeof(cfg));
+  cfg.servoAngle = SERVO_DEFAULT_ANGLE;
+  cfg.openHoldMs = OPEN_HOLD_MS;
+  cfg.servoClosedUs = SERVO_CLOSED_US;
+  cfg.servoOpenUs = SERVO_OPEN_US;
+}
+
+bool ProvisionManager::begin() {
+  LOG("ProvisionManager: Initializing");
+  if (!loadBundle() || active.version == 0) {
+    return false;
+  }
+  
+  // Re-apply the last accepted bundle at boot, before the backend is reachable:
+  // calibration, telemetry rate and backends live only here; the schedule part
+  // is skipped by OfflineScheduler if it is the bundle it already took
+  updatePending = true;
+  return true;
+}
+
+void ProvisionManager::reset() {
+  setDefaults(active);
+  setDefaults(staged);
+  updatePending = false;
+  receiving = false;
+}
+
+void ProvisionManager::beginUpdate() {
+  // Fields missing from the bundle keep their current value
+  staged = active;
+  staged.version = 0;
+  receiving = true;
+  
+  depth = 0;
+  inString = false;
+  inLiteral = false;
+  escaped = false;
+  expectKey = false;
+  rootClosed = false;
+  parseError = false;
+  tokenLen = 0;
+  bytesReceived = 0;
+  fieldsParsed = 0;
+}
+
+bool ProvisionManager::commitUpdate() {
+  if (!receiving) return false;
+  receiving = false;
+  
+  // Flush a trailing literal (body ended right after a number)
+  if (inLiteral) parseChar(' ');
+  
+  if (parseError) {
+    return false;
+  }
+  if (!rootClosed) {
+    LOG("ProvisionManager: Bundle incomplete after %u bytes - discarded", (unsigned int)bytesReceived);
+    return false;
+  }
+  if (staged.version == 0) {
+    LOG("ProvisionManager: Bundle without version - discarded");
+    return false;
+  }
+  
+  uint32_t previous = active.version;
+  active = staged;
+  if (!saveBundle()) {
+    LOG("ProvisionManager: Bundle v%lu applied but not persisted", (unsigned long)active.version);
+  }
+  updatePending = true;
+  
+  LOG("ProvisionManager: Bundle v%lu -> v%lu (%u fields, %u bytes, %u feed times)",
+      (unsigned long)previous, (unsigned long)active.version, fieldsParsed,
+      (unsigned int)bytesReceived, active.timesCount);
+  return true;
+}
+
+bool ProvisionManager::takeUpdate(ProvisionConfig& out) {
+  if (!updatePending) return false;
+  updatePending = false;
+  out = active;
+  return true;
+}
+
+size_t ProvisionManager::write(uint8_t c) {
+  return write(&c, 1);
+}
+
+size_t ProvisionManager::write(const uint8_t* buffer, size_t size) {
+  if (!receiving || parseError) {
+    return 0;  // Short write aborts the HTTP transfer
+  }
+  
+  bytesReceived += size;
+  if (bytesReceived > PROVISION_MAX_BYTES) {
+    fail("bundle too large");
+    return 0;
+  }
+  
+  for (size_t i = 0; i < size && !parseError; i++) {
+    parseChar((char)buffer[i]);
+  }
+  return parseError ? 0 : size;
+}
+
+void ProvisionManager::fail(const char* reason) {
+  if (!parseError) {
+    LOG("ProvisionManager: Parse error at byte %u - %s", (unsigned int)bytesReceived, reason);
+  }
+  parseError = true;
+}
+
+void ProvisionManager::parseChar(char c) {
+  if (inString) {
+    if (escaped) {
+      escaped = false;
+    } else if (c == '\\') {
+      escaped = true;
+      return;
+    } else if (c == '"') {
+      inString = false;
+      token[tokenLen] = '\0';
+      if (expectKey && depth > 0 && !frames[depth - 1].isArray) {
+        // Long keys are cut (and then match no field)
+        uint8_t n = tokenLen < KEY_LEN - 1 ? tokenLen : KEY_LEN - 1;
+        memcpy(frames[depth - 1].key, token, n);
+        frames[depth - 1].key[n] = '\0';
+        expectKey = false;
+      } else {
+        onValue(token, true);
+      }
+      return;
+    }
+    // Values longer than any field we read are truncated, not rejected
+    if (tokenLen < TOKEN_LEN - 1) token[tokenLen++] = c;
+    return;
+  }
+  
+  if (inLiteral) {
+    if (isalnum((unsigned char)c) || c == '.' || c == '-' || c == '+') {
+      if (tokenLen < TOKEN_LEN - 1) token[tokenLen++] = c;
+      return;
+    }
+    inLiteral = false;
+    token[tokenLen] = '\0';
+    onValue(token, false);
+    // Fall through: c is the structural character that ended the literal
+  }
+  
+  if (rootClosed) {
+    if (!isspace((unsigned char)c)) fail("data after root object");
+    return;
+  }
+  
+  switch (c) {
+    case '{':
+    case '[':
+      if (depth >= MAX_DEPTH) {
+        fail("nesting too deep");
+        return;
+      }
+      frames[depth].isArray = (c == '[');
+      frames[depth].key[0] = '\0';
+      depth++;
+      expectKey = (c == '{');
+  
+      // A schedule / backend array replaces the whole list, even when empty
+      if (c == '[' && depth == 2 && strcmp(frames[0].key, "schedule") == 0) {
+        staged.timesCount = 0;
+      } else if (c == '[' && depth == 2 && strcmp(frames[0].key, "backends") == 0) {
+        staged.backends[0] = '\0';
+      }
+      break;
+  
+    case '}':
+    case ']':
+      if (depth == 0 || frames[depth - 1].isArray != (c == ']')) {
+        fail("unbalanced brackets");
+        return;
+      }
+      depth--;
+      expectKey = false;
+      if (depth == 0) rootClosed = true;
+      break;
+  
+    case ',':
+      expectKey = depth > 0 && !frames[depth - 1].isArray;
+      break;
+  
+    case '"':
+      inString = true;
+      escaped = false;
+      tokenLen = 0;
+      break;
+  
+    case ':':
+    case ' ':
+    case '\t':
+    case '\r':
+    case '\n':
+      break;
+  
+    default:
+      if (depth == 0) {
+        fail("expected object");
+        return;
+      }
+      inLiteral = true;
+      tokenLen = 0;
+      token[tokenLen++] = c;
+      break;
+  }
+}
+
+void ProvisionManager::onValue(const char* value, bool isString) {
+  // null keeps the current value
+  if (!isString && strcmp(value, "null") == 0) return;
+  
+  if (depth == 1) {
+    if (strcmp(frames[0].key, "version") == 0) {
+      staged.version = strtoul(value, nullptr, 10);
+      fieldsParsed++;
+    }
+    return;
+  }
+  
+  // Values directly inside a section object, or inside schedule array items
+  if (depth == 2 && !frames[1].isArray) {
+    applyField(frames[0].key, frames[1].key, value, isString);
+  } else if (depth == 3 && frames[1].isArray && !frames[2].isArray) {
+    applyField(frames[0].key, frames[2].key, value, isString);
+  } else if (depth == 2 && frames[1].isArray) {
+    applyField(frames[0].key, "", value, isString);  // ["08:30", ...]
+  }
+}
+
+void ProvisionManager::applyField(const char* section, const char* key, const char* value, bool isString) {
+  long num = isString ? 0 : strtol(value, nullptr, 10);
+  
+  if (strcmp(section, "schedule") == 0) {
+    if (!isString || (key[0] != '\0' && strcmp(key, "feedTime") != 0)) return;
+  
+    int hour = 0;
+    int minute = 0;
+    if (sscanf(value, "%d:%d", &hour, &minute) != 2 ||
+        hour < 0 || hour > 23 || minute < 0 || minute > 59) {
+      LOG("ProvisionManager: Ignoring invalid feed time: %s", value);
+      return;
+    }
+    if (staged.timesCount >= MAX_FEED_TIMES) return;
+    staged.times[staged.timesCount].hour = (uint8_t)hour;
+    staged.times[staged.timesCount].minute = (uint8_t)minute;
+    staged.timesCount++;
+    fieldsParsed++;
+    return;
+  }
+  
+  if (strcmp(section, "backends") == 0) {
+    if (!isString || key[0] != '\0' || strchr(value, ':') == nullptr || strchr(value, ',') != nullptr) return;
+    
+    // Stored as one "host:port,host:port" string; entries that do not fit are dropped
+    size_t used = strlen(staged.backends);
+    size_t needed = strlen(value) + (used > 0 ? 1 : 0);
+    if (used + needed >= PROVISION_BACKENDS_LEN) return;
+    if (used > 0) strcat(staged.backends, ",");
+    strcat(staged.backends, value);
+    fieldsParsed++;
+    return;
+  }
+  
+  if (isString) return;
+  
+  if (strcmp(section, "settings") == 0) {
+    if (strcmp(key, "openHoldMs") == 0 && num > 0 && num < 60000) {
+      staged.openHoldMs = (uint32_t)num;
+    } else if (strcmp(key, "servoAngle") == 0 && num >= 0 && num <= 180) {
+      staged.servoAngle = (uint16_t)num;
+    } else if (strcmp(key, "excludeDays") == 0 && num >= 0 && num <= 0x7F) {
+      staged.excludeDaysBitmap = (uint8_t)num;
+    } else if (strcmp(key, "telemetryMs") == 0 && num >= 0) {
+      staged.telemetryMs = (uint32_t)num;
+    } else {
+      return;
+    }
+    fieldsParsed++;
+  } else if (strcmp(section, "actuator") == 0) {
+    if (num < SERVO_MIN_US || num > SERVO_MAX_US) return;
+    if (strcmp(key, "closedUs") == 0) {
+      staged.servoClosedUs = (uint16_t)num;
+    } else if (strcmp(key, "openUs") == 0) {
+      staged.servoOpenUs = (uint16_t)num;
+    } else {
+      return;
+    }
+    fieldsParsed++;
+  }
+}
+
+bool ProvisionManager::saveBundle() {
+#if defined(ESP32)
+  Preferences prefs;
+  if (!prefs.begin(NVS_NAMESPACE, false)) {
+    LOGE("ProvisionManager: Failed to open NVS");
+    return false;
+  }
+  metrics.inc(MET_NVS_WRITES_PROV);
+  
+  // Whole bundle as one blob: one NVS write, one commit
+  size_t written = prefs.putBytes("prov", &active, sizeof(active));
+  prefs.end();
+  return written == sizeof(active);
+#else
+  return false;
+#endif
+}
+
+bool ProvisionManager::loadBundle() {
+#if defined(ESP32)
+  Preferences prefs;
+  if (!prefs.begin(NVS_NAMESPACE, true)) {
+    LOGE("ProvisionManager: Failed to open NVS");
+    return false;
+  }
+  
+  // Blob from a firmware with a different bundle layout is ignored
+  if (prefs.getBytesLength("prov") != sizeof(ProvisionConfig)) {
+    prefs.end();
+    LOG("ProvisionManager: No saved bundle");
+    return false;
+  }
+  
+  ProvisionConfig loaded;
+  prefs.getBytes("prov", &loaded, sizeof(loaded));
+  prefs.end();
+  
+  if (loaded.timesCount > MAX_FEED_TIMES) {
+    LOG("ProvisionManager: Saved bundle invalid - ignored");
+    return false;
+  }
+  active = loaded;
+  
+  LOG("ProvisionManager: Loaded bundle v%lu - %u feed times",
+      (unsigned long)active.version, active.timesCount);
+  return true;
+#else
+  LOG("ProvisionManager: NVS not supported");
+  return false;
+#endif
+}
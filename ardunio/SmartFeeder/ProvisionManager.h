@@ -0,0 +1,135 @@
+#ifndef PROVISION_MANAGER_H
+#define PROVISION_MANAGER_H
+
+#include "Config.h"
+#include <Arduino.h>
+
+/**
+ * @brief Receives, persists and hands out the backend provisioning bundle
+ *
+ * The bundle carries settings, schedule, actuator calibration and telemetry
+ * rate in one document:
+ *   {"version": 123,
+ *    "settings": {"openHoldMs": 3000, "servoAngle": 90, "excludeDays": 0, "telemetryMs": 60000},
+ *    "actuator": {"closedUs": 1000, "openUs": 1700},
+ *    "schedule": [{"feedTime": "08:30"}, ...],
+ *    "backends": ["api1.example.com:8082", "api2.example.com:8082"]}
+ *
+ * The HTTP body is written straight into this object (it is a Stream), so
+ * the bundle is parsed as it arrives without buffering the whole response.
+ * Parsed values go to a staging copy; only a complete, valid bundle replaces
+ * the active one, persisted as a single NVS blob (one commit). A partial
+ * download never leaves a half-applied configuration behind.
+ */
+class ProvisionManager : public Stream {
+private:
+  static const uint8_t MAX_DEPTH = 6;
+  static const uint8_t KEY_LEN = 16;
+  static const uint8_t TOKEN_LEN = 48;
+  
+  /**
+   * @brief Open JSON container and the last key read in it
+   */
+  struct Frame {
+    bool isArray;
+    char key[KEY_LEN];
+  };
+  
+  ProvisionConfig active;     // Applied / persisted bundle
+  ProvisionConfig staged;     // Bundle being received
+  bool updatePending;
+  bool receiving;
+  
+  // Streaming parser state
+  Frame frames[MAX_DEPTH];
+  uint8_t depth;
+  bool inString;
+  bool inLiteral;
+  bool escaped;
+  bool expectKey;
+  bool rootClosed;
+  bool parseError;
+  char token[TOKEN_LEN];
+  uint8_t tokenLen;
+  size_t bytesReceived;
+  uint8_t fieldsParsed;
+  
+  /**
+   * @brief Feed one byte to the parser
+   */
+  void parseChar(char c);
+  
+  /**
+   * @brief Handle a complete scalar (string or literal)
+   */
+  void onValue(const char* value, bool isString);
+  
+  /**
+   * @brief Map a value at settings.* / actuator.* / schedule[] / backends[] onto the staging bundle
+   */
+  void applyField(const char* section, const char* key, const char* value, bool isString);
+  
+  void fail(const char* reason);
+  
+  bool loadBundle();
+  bool saveBundle();
+  
+  static void setDefaults(ProvisionConfig& cfg);
+  
+public:
+  ProvisionManager();
+  
+  /**
+   * @brief Load persisted bundle from NVS
+   * @return true if a provisioned bundle was restored (pending to apply)
+   */
+  bool begin();
+  
+  /**
+   * @brief Start receiving a new bundle (resets parser and staging copy)
+   */
+  void beginUpdate();
+  
+  /**
+   * @brief Finish receiving: validate, persist and publish staged bundle
+   * @return true if the new bundle was accepted
+   */
+  bool commitUpdate();
+  
+  /**
+   * @brief Drop staged bundle (request failed), active bundle is untouched
+   */
+  void abortUpdate() { receiving = false; }
+  
+  /**
+   * @brief Take bundle waiting to be applied to the modules
+   * @param out Output: bundle
+   * @return true if a new bundle was pending
+   */
+  bool takeUpdate(ProvisionConfig& out);
+  
+  /**
+   * @brief Forget the bundle in memory (factory reset; NVS is cleared by the caller)
+   */
+  void reset();
+  
+  /**
+   * @brief Version of the active bundle (0 = never provisioned)
+   */
+  uint32_t getVersion() const { return active.version; }
+  
+  /**
+   * @brief Active bundle
+   */
+  const ProvisionConfig& getConfig() const { return active; }
+  
+  // Stream interface: HTTP body is written into the parser
+  size_t write(uint8_t c) override;
+  size_t write(const uint8_t* buffer, size_t size) override;
+  int available() override { return 0; }
+  int read() override { return -1; }
+  int peek() override { return -1; }
+  void flush() override {}
+};
+
+#endif // PROVISION_MANAGER_H
@@ -0,0 +1,136 @@
+#define LOG_MODULE LOG_MOD_RADIO
+#include "RadioPolicy.h"
+
+#if defined(ESP8266)
+  #include <ESP8266WiFi.h>
+#elif defined(ESP32)
+  #include <WiFi.h>
+#endif
+
+RadioPolicy::RadioPolicy(ModeManager* mm, WiFiManager* wm, WebPortal* wp)
+  : modeManager(mm)
+  , wifiManager(wm)
+  , portal(wp)
+  , lastTick(0)
+  , lastNeededAt(0)
+  , staDown(false)
+  , staDownSince(0)
+  , portalRequestedAt(0)
+  , portalRequested(false)
+  , modemSleep(false)
+  , buttonDown(false)
+  , buttonChangedAt(0)
+  , apOnMs(0)
+  , sleepMs(0)
+  , apStarts(0)
+  , apStops(0)
+  , channelMoves(0) {
+}
+
+void RadioPolicy::begin() {
+#if RADIO_PORTAL_BUTTON_PIN >= 0
+  pinMode(RADIO_PORTAL_BUTTON_PIN, INPUT_PULLUP);
+#endif
+  lastTick = millis();
+  lastNeededAt = lastTick;
+  if (portal->isAPStarted()) apStarts++;
+}
+
+void RadioPolicy::requestPortal() {
+  portalRequested = true;
+  portalRequestedAt = millis();
+  LOG("RadioPolicy: Portal requested for %lu s", (unsigned long)(RADIO_AP_BUTTON_MS / 1000));
+}
+
+void RadioPolicy::pollButton(unsigned long now) {
+#if RADIO_PORTAL_BUTTON_PIN >= 0
+  bool down = digitalRead(RADIO_PORTAL_BUTTON_PIN) == LOW;
+  if (down != buttonDown && now - buttonChangedAt >= RADIO_BUTTON_DEBOUNCE_MS) {
+    buttonDown = down;
+    buttonChangedAt = now;
+    if (down) requestPortal();
+  }
+#else
+  (void)now;
+#endif
+}
+
+bool RadioPolicy::apNeeded(unsigned long now) {
+  if (!modeManager->isModeSelected()) return true;
+  if (modeManager->getMode() != MODE_ONLINE) return true;
+  if (!wifiManager->hasCredentials()) return true;
+  
+  // Connectivity lost long enough: give the user a way back in
+  if (WiFi.status() == WL_CONNECTED) {
+    staDown = false;
+  } else if (!staDown) {
+    staDown = true;
+    staDownSince = now;
+  }
+  bool fallback = staDown && now - staDownSince >= RADIO_AP_FALLBACK_MS;
+  
+  if (portalRequested && now - portalRequestedAt >= RADIO_AP_BUTTON_MS) {
+    portalRequested = false;
+  }
+  
+  return fallback || portalRequested;
+}
+
+void RadioPolicy::setModemSleep(bool on) {
+  if (on == modemSleep) return;
+  
+#if defined(ESP32)
+  WiFi.setSleep(on);
+#else
+  WiFi.setSleepMode(on ? WIFI_MODEM_SLEEP : WIFI_NONE_SLEEP);
+#endif
+  modemSleep = on;
+  LOG("RadioPolicy: Modem sleep %s", on ? "on" : "off");
+}
+
+void RadioPolicy::tick() {
+  unsigned long now = millis();
+  if (now - lastTick < RADIO_POLICY_TICK_MS) return;
+  
+  // Duty cycle bookkeeping for the state since the last tick
+  uint32_t elapsed = now - lastTick;
+  lastTick = now;
+  if (portal->isAPStarted()) apOnMs += elapsed;
+  if (modemSleep) sleepMs += elapsed;
+  
+  pollButton(now);
+  
+  bool needed = apNeeded(now);
+  if (needed || (portal->isAPStarted() && WiFi.softAPgetStationNum() > 0)) {
+    lastNeededAt = now;
+  }
+  
+  if (needed && !portal->isAPStarted()) {
+    // Come up on the station's channel if it has one, so both links share it
+    uint8_t channel = (WiFi.status() == WL_CONNECTED && WiFi.channel() > 0) ? WiFi.channel() : AP_CHANNEL;
+    setModemSleep(false);
+    if (portal->startAccessPoint(channel)) {
+      apStarts++;
+    }
+  } else if (!needed && portal->isAPStarted() && now - lastNeededAt >= RADIO_AP_LINGER_MS) {
+    LOG("RadioPolicy: AP idle, shutting down AP and DNS");
+    portal->stopAccessPoint();
+    apStops++;
+  }
+  
+  // Follow the station when it lands on another channel
+  if (portal->isAPStarted() && WiFi.status() == WL_CONNECTED) {
+    uint8_t staChannel = WiFi.channel();
+    if (staChannel > 0 && staChannel != portal->getAPChannel()) {
+      LOG("RadioPolicy: Moving AP from channel %u to station channel %u",
+          portal->getAPChannel(), staChannel);
+      if (portal->startAccessPoint(staChannel)) {
+        channelMoves++;
+      }
+    }
+  }
+  
+  // The AP must stay awake for its clients; a lone station may doze
+  bool online = modeManager->getMode() == MODE_ONLINE && WiFi.status() == WL_CONNECTED;
+  setModemSleep(online && !portal->isAPStarted());
+}
@@ -0,0 +1,86 @@
+#ifndef RADIO_POLICY_H
+#define RADIO_POLICY_H
+
+#include "Config.h"
+#include "ModeManager.h"
+#include "WiFiManager.h"
+#include "WebPortal.h"
+#include <Arduino.h>
+
+/**
+ * @brief Decides when the setup AP, captive DNS and modem sleep are on
+ * 
+ * The AP (and its DNS server) is needed while the device is being set up:
+ *   - no mode selected, offline mode (the portal is its only UI)
+ *   - online mode without WiFi credentials
+ *   - online mode with the station down for RADIO_AP_FALLBACK_MS
+ *   - for RADIO_AP_BUTTON_MS after a portal request (button / serial)
+ * Otherwise it is shut down once no client is associated and
+ * RADIO_AP_LINGER_MS have passed. While the AP runs next to a connected
+ * station it is moved to the station's channel, so the radio does not
+ * time-slice between two channels. Modem sleep is on whenever the device
+ * is online with the AP down.
+ * 
+ * AP and sleep time are accumulated so the radio duty cycle can be
+ * compared before and after (STATUS command).
+ */
+class RadioPolicy {
+private:
+  ModeManager* modeManager;
+  WiFiManager* wifiManager;
+  WebPortal* portal;
+  
+  unsigned long lastTick;
+  unsigned long lastNeededAt;      // Last time a rule asked for the AP
+  bool staDown;
+  unsigned long staDownSince;
+  unsigned long portalRequestedAt;
+  bool portalRequested;
+  bool modemSleep;
+  
+  // Button (RADIO_PORTAL_BUTTON_PIN, active low)
+  bool buttonDown;
+  unsigned long buttonChangedAt;
+  
+  // Statistics
+  uint32_t apOnMs;
+  uint32_t sleepMs;
+  uint32_t apStarts;
+  uint32_t apStops;
+  uint32_t channelMoves;
+  
+  /**
+   * @brief Whether a provisioning rule needs the AP right now
+   */
+  bool apNeeded(unsigned long now);
+  
+  void pollButton(unsigned long now);
+  void setModemSleep(bool on);
+  
+public:
+  RadioPolicy(ModeManager* mm, WiFiManager* wm, WebPortal* wp);
+  
+  /**
+   * @brief Set up the portal button (if configured)
+   */
+  void begin();
+  
+  /**
+   * @brief Apply the policy (call in loop)
+   */
+  void tick();
+  
+  /**
+   * @brief Bring the AP up for RADIO_AP_BUTTON_MS (button or serial command)
+   */
+  void requestPortal();
+  
+  bool isModemSleep() const { return modemSleep; }
+  uint32_t getApOnMs() const { return apOnMs; }
+  uint32_t getSleepMs() const { return sleepMs; }
+  uint32_t getApStarts() const { return apStarts; }
+  uint32_t getApStops() const { return apStops; }
+  uint32_t getChannelMoves() const { return channelMoves; }
+};
+
+#endif // RADIO_POLICY_H
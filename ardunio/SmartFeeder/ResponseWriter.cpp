@@ -0,0 +1,186 @@
+#include "ResponseWriter.h"
+#include <stdarg.h>
+
+// ================== ResponseWriter ==================
+
+ResponseWriter::ResponseWriter(char* buffer, size_t size)
+  : buf(buffer)
+  , cap(size)
+  , len(0)
+  , overflow(false) {
+  if (cap > 0) buf[0] = '\0';
+}
+
+void ResponseWriter::put(char c) {
+  if (len + 1 >= cap) {
+    overflow = true;
+    return;
+  }
+  buf[len++] = c;
+  buf[len] = '\0';
+}
+
+ResponseWriter& ResponseWriter::raw(const char* text) {
+  while (*text) put(*text++);
+  return *this;
+}
+
+ResponseWriter& ResponseWriter::rawf(const char* fmt, ...) {
+  if (len + 1 >= cap) {
+    overflow = true;
+    return *this;
+  }
+  
+  va_list args;
+  va_start(args, fmt);
+  int n = vsnprintf(buf + len, cap - len, fmt, args);
+  va_end(args);
+  
+  if (n < 0) return *this;
+  if ((size_t)n >= cap - len) {
+    // Truncated: keep what fit, like put() does
+    overflow = true;
+    len = cap - 1;
+  } else {
+    len += n;
+  }
+  return *this;
+}
+
+ResponseWriter& ResponseWriter::html(const char* text) {
+  for (; *text; text++) {
+    switch (*text) {
+      case '&':  raw("&amp;");  break;
+      case '<':  raw("&lt;");   break;
+      case '>':  raw("&gt;");   break;
+      case '"':  raw("&quot;"); break;
+      case '\'': raw("&#39;");  break;
+      default:   put(*text);    break;
+    }
+  }
+  return *this;
+}
+
+// ================== JsonWriter ==================
+
+JsonWriter::JsonWriter(char* buffer, size_t size)
+  : ResponseWriter(buffer, size)
+  , depth(0)
+  , hasItems(0)
+  , afterKey(false) {
+}
+
+void JsonWriter::separator() {
+  if (afterKey) {
+    afterKey = false;
+    return;
+  }
+  if (depth == 0) return;
+  
+  uint8_t bit = 1 << (depth - 1);
+  if (hasItems & bit) put(',');
+  hasItems |= bit;
+}
+
+void JsonWriter::string(const char* text) {
+  put('"');
+  for (const unsigned char* p = (const unsigned char*)text; *p; p++) {
+    switch (*p) {
+      case '"':  raw("\\\""); break;
+      case '\\': raw("\\\\"); break;
+      case '\n': raw("\\n");  break;
+      case '\r': raw("\\r");  break;
+      case '\t': raw("\\t");  break;
+      case '<':  raw("\\u003c"); break;  // Keeps "</script>" inert when inlined in a page
+      default:
+        if (*p < 0x20) {
+          rawf("\\u%04x", *p);
+        } else {
+          // UTF-8 bytes pass through unchanged
+          put((char)*p);
+        }
+        break;
+    }
+  }
+  put('"');
+}
+
+JsonWriter& JsonWriter::beginObject() {
+  separator();
+  put('{');
+  if (depth < MAX_DEPTH) {
+    depth++;
+    hasItems &= ~(1 << (depth - 1));
+  } else {
+    overflow = true;
+  }
+  return *this;
+}
+
+JsonWriter& JsonWriter::endObject() {
+  if (depth > 0) depth--;
+  put('}');
+  return *this;
+}
+
+JsonWriter& JsonWriter::beginArray() {
+  separator();
+  put('[');
+  if (depth < MAX_DEPTH) {
+    depth++;
+    hasItems &= ~(1 << (depth - 1));
+  } else {
+    overflow = true;
+  }
+  return *this;
+}
+
+JsonWriter& JsonWriter::endArray() {
+  if (depth > 0) depth--;
+  put(']');
+  return *this;
+}
+
+JsonWriter& JsonWriter::key(const char* name) {
+  separator();
+  string(name);
+  put(':');
+  afterKey = true;
+  return *this;
+}
+
+JsonWriter& JsonWriter::value(const char* text) {
+  if (!text) return null();
+  separator();
+  string(text);
+  return *this;
+}
+
+JsonWriter& JsonWriter::number(int64_t n) {
+  separator();
+  
+  // Formatted by hand: printf's %lld is not available on every core
+  char digits[21];
+  uint8_t i = 0;
+  uint64_t u = n < 0 ? (uint64_t)(-(n + 1)) + 1 : (uint64_t)n;
+  do {
+    digits[i++] = '0' + (u % 10);
+    u /= 10;
+  } while (u > 0);
+  
+  if (n < 0) put('-');
+  while (i > 0) put(digits[--i]);
+  return *this;
+}
+
+JsonWriter& JsonWriter::boolean(bool b) {
+  separator();
+  raw(b ? "true" : "false");
+  return *this;
+}
+
+JsonWriter& JsonWriter::null() {
+  separator();
+  raw("null");
+  return *this;
+}
@@ -0,0 +1,81 @@
+#ifndef RESPONSE_WRITER_H
+#define RESPONSE_WRITER_H
+
+#include <Arduino.h>
+
+/**
+ * @brief Text output into a fixed, caller-owned buffer
+ * 
+ * Never allocates: output that does not fit is dropped and overflowed()
+ * is set, the buffer always stays NUL-terminated. Used to build portal
+ * responses without String concatenation.
+ */
+class ResponseWriter {
+protected:
+  char* buf;
+  size_t cap;
+  size_t len;
+  bool overflow;
+  
+  void put(char c);
+  
+public:
+  ResponseWriter(char* buffer, size_t size);
+  
+  /**
+   * @brief Append text as is
+   */
+  ResponseWriter& raw(const char* text);
+  
+  /**
+   * @brief Append printf-formatted text
+   */
+  ResponseWriter& rawf(const char* fmt, ...) __attribute__((format(printf, 2, 3)));
+  
+  /**
+   * @brief Append text with HTML special characters escaped
+   */
+  ResponseWriter& html(const char* text);
+  
+  const char* c_str() const { return buf; }
+  size_t length() const { return len; }
+  size_t remaining() const { return cap > len + 1 ? cap - len - 1 : 0; }
+  bool overflowed() const { return overflow; }
+};
+
+/**
+ * @brief Streaming JSON on top of ResponseWriter
+ * 
+ * Commas and string escaping are handled by the writer:
+ *   json.beginObject().key("rssi").number(-61).key("ssid").value(ssid).endObject();
+ */
+class JsonWriter : public ResponseWriter {
+private:
+  static const uint8_t MAX_DEPTH = 8;
+  
+  uint8_t depth;
+  uint8_t hasItems;   // Bit per nesting level: level already has a member
+  bool afterKey;
+  
+  void separator();
+  void string(const char* text);
+  
+public:
+  JsonWriter(char* buffer, size_t size);
+  
+  JsonWriter& beginObject();
+  JsonWriter& endObject();
+  JsonWriter& beginArray();
+  JsonWriter& endArray();
+  JsonWriter& key(const char* name);
+  
+  /**
+   * @brief Escaped string value (nullptr writes null)
+   */
+  JsonWriter& value(const char* text);
+  JsonWriter& number(int64_t n);
+  JsonWriter& boolean(bool b);
+  JsonWriter& null();
+};
+
+#endif // RESPONSE_WRITER_H
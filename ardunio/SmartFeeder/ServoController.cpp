@@ -1,3 +1,4 @@
+#define LOG_MODULE LOG_MOD_SERVO
 #include "ServoController.h"
 
 ServoController::ServoController() 
@@ -6,6 +7,8 @@ ServoController::ServoController()
   , targetAngle(0)
   , openHoldMs(OPEN_HOLD_MS)
   , stateStartTime(0)
+  , openedAt(0)
+  , closedAt(0)
   , closedPositionUs(SERVO_CLOSED_US)
   , openPositionUs(SERVO_OPEN_US)
   , isAttached(false) {
@@ -49,7 +52,7 @@ void ServoController::moveToTarget() {
   servo.writeMicroseconds(targetUs);
   currentAngle = targetAngle;
   
-  LOG("ServoController: Moved to %u° (%u µs)", currentAngle, targetUs);
+  LOGD("ServoController: Moved to %u° (%u µs)", currentAngle, targetUs);
 }
 
 void ServoController::tick() {
@@ -63,13 +66,14 @@ void ServoController::tick() {
       moveToTarget();
       state = MOTOR_OPEN;
       stateStartTime = now;
+      openedAt = now;
       LOG("ServoController: Lid opened, holding for %lu ms", (unsigned long)openHoldMs);
       break;
       
     case MOTOR_OPEN:
       // Check if hold time elapsed
       if ((now - stateStartTime) >= openHoldMs) {
-        LOG("ServoController: Hold time elapsed, closing");
+        LOGD("ServoController: Hold time elapsed, closing");
         close();
       }
       break;
@@ -78,6 +82,7 @@ void ServoController::tick() {
       // Move immediately to closed position
       moveToTarget();
       state = MOTOR_IDLE;
+      closedAt = now;
       LOG("ServoController: Lid closed");
       break;
       
@@ -99,7 +104,7 @@ void ServoController::open(uint16_t angle) {
   targetAngle = angle;
   state = MOTOR_OPENING;
   
-  LOG("ServoController: Opening to %u°", angle);
+  LOGD("ServoController: Opening to %u°", angle);
 }
 
 void ServoController::close() {
@@ -110,10 +115,22 @@ void ServoController::close() {
   targetAngle = 0;
   state = MOTOR_CLOSING;
   
-  LOG("ServoController: Closing");
+  LOGD("ServoController: Closing");
 }
 
 void ServoController::stop() {
   state = MOTOR_IDLE;
   LOG("ServoController: Emergency stop");
 }
+
+void ServoController::setCalibration(uint16_t closedUs, uint16_t openUs) {
+  closedPositionUs = constrain(closedUs, SERVO_MIN_US, SERVO_MAX_US);
+  openPositionUs = constrain(openUs, SERVO_MIN_US, SERVO_MAX_US);
+  
+  // Take the new closed position right away if the lid is at rest
+  if (isAttached && state == MOTOR_IDLE) {
+    servo.writeMicroseconds(closedPositionUs);
+  }
+  
+  LOG("ServoController: Calibration closed=%u µs, open=%u µs", closedPositionUs, openPositionUs);
+}
@@ -23,6 +23,8 @@ private:
   uint16_t targetAngle;
   uint32_t openHoldMs;
   uint32_t stateStartTime;
+  uint32_t openedAt;      // millis() when the lid last reached open
+  uint32_t closedAt;      // millis() when the lid last reached closed
   
   uint16_t closedPositionUs;
   uint16_t openPositionUs;
@@ -75,6 +77,13 @@ public:
    */
   void setHoldDuration(uint32_t ms) { openHoldMs = ms; }
   
+  /**
+   * @brief Set actuator calibration (pulse widths for closed/open lid)
+   * @param closedUs Closed position in microseconds
+   * @param openUs Open position in microseconds
+   */
+  void setCalibration(uint16_t closedUs, uint16_t openUs);
+  
   /**
    * @brief Get current state
    */
@@ -89,6 +98,12 @@ public:
    * @brief Get current angle
    */
   uint16_t getCurrentAngle() const { return currentAngle; }
+  
+  /**
+   * @brief Time (millis) the lid last reached open / closed position
+   */
+  uint32_t getOpenedAt() const { return openedAt; }
+  uint32_t getClosedAt() const { return closedAt; }
 };
 
 #endif // SERVO_CONTROLLER_H
@@ -17,12 +17,19 @@
  * 
  * File Structure:
  * - Config.h              : Global configuration and data structures
+ * - Logger.*              : Ring-buffered LOG() with deferred formatting
  * - ModeManager.*         : Operation mode management
  * - ServoController.*     : Servo motor control
  * - TimeManager.*         : Time tracking and persistence
  * - OfflineScheduler.*    : Feed scheduling logic
  * - WebPortal.*           : Web server and API handlers
+ * - RadioPolicy.*         : Setup AP / captive DNS lifecycle, AP channel, modem sleep
  * - WebPortalPages.h      : HTML pages
+ * - OtaUpdater.*          : OTA firmware updates (ESP32)
+ * - FeedTracer.*          : Stage timestamps of backend feed commands
+ * - BackendBridge.*       : Online-mode glue, backend data to local modules (shared with fleet-sim)
+ * - LoopProfiler.*        : Loop latency and per-module time histograms
+ * - Metrics.*             : Static metric registry, Prometheus text for /metrics
  * - SmartFeeder.ino       : Main application (this file)
  * 
  * Usage:
@@ -43,7 +50,14 @@
 #include "OfflineScheduler.h"
 #include "WiFiManager.h"
 #include "BackendClient.h"
+#include "ProvisionManager.h"
+#include "BackendBridge.h"
+#include "OtaUpdater.h"
+#include "FeedTracer.h"
 #include "WebPortal.h"
+#include "RadioPolicy.h"
+#include "LoopProfiler.h"
+#include "Metrics.h"
 
 // ================== Global Objects ==================
 ModeManager modeManager;
@@ -51,8 +65,16 @@ ServoController servoController;
 TimeManager timeManager;
 WiFiManager wifiManager;
 BackendClient backendClient;
+ProvisionManager provisioning;
+OtaUpdater otaUpdater;
+FeedTracer feedTracer;
+LoopProfiler loopProfiler;
 OfflineScheduler scheduler(&timeManager, &servoController);
-WebPortal webPortal(&modeManager, &timeManager, &scheduler, &wifiManager);
+BackendBridge backendBridge(&backendClient, &provisioning, &scheduler, &timeManager,
+                            &servoController, &feedTracer);
+WebPortal webPortal(&modeManager, &timeManager, &scheduler, &wifiManager, &servoController,
+                    &loopProfiler, &provisioning);
+RadioPolicy radioPolicy(&modeManager, &wifiManager, &webPortal);
 
 SystemState currentState = STATE_BOOT;
 
@@ -62,25 +84,32 @@ void printSystemInfo();
 bool initializeHardware();
 bool initializeModules();
 void updateStateMachine();
+void startWiFi(OperationMode mode);
+void stopWiFi(OperationMode mode);
+void startBackend(OperationMode mode);
+void stopBackend(OperationMode mode);
 
 // ================== Setup ==================
 void setup() {
   // Initialize serial
   Serial.begin(BAUDRATE);
   delay(100);
+#if LOG_ASYNC
+  logger.begin();
+#endif
   
   printWelcomeBanner();
   
   // Initialize hardware
   if (!initializeHardware()) {
-    LOG("FATAL: Hardware initialization failed");
+    LOGE("FATAL: Hardware initialization failed");
     currentState = STATE_ERROR;
     return;
   }
   
   // Initialize modules
   if (!initializeModules()) {
-    LOG("FATAL: Module initialization failed");
+    LOGE("FATAL: Module initialization failed");
     currentState = STATE_ERROR;
     return;
   }
@@ -96,11 +125,15 @@ void setup() {
     currentState = STATE_READY;
   }
   
+  loopProfiler.begin();
   LOG("Setup complete - entering main loop");
 }
 
 // ================== Loop ==================
 void loop() {
+  // Closes the previous iteration's timing (STATUS, /api/metrics)
+  loopProfiler.beginLoop();
+  
   // Check for serial commands
   if (Serial.available()) {
     String cmd = Serial.readStringUntil('\n');
@@ -113,55 +146,125 @@ void loop() {
       modeManager.reset();
       timeManager.clearTime();
       scheduler.clearSchedule();
+      provisioning.reset();
       LOG("Reset complete! Rebooting...");
       delay(1000);
+#if LOG_ASYNC
+      logger.flush();
+#endif
       ESP.restart();
     } else if (cmd == "STATUS") {
       printSystemInfo();
+    } else if (cmd == "OTA") {
+      LOG("OTA check requested");
+      otaUpdater.requestCheck();
+    } else if (cmd == "PORTAL") {
+      radioPolicy.requestPortal();
+#if LOG_ASYNC
+    } else if (cmd.startsWith("LOGLEVEL ")) {
+      // LOGLEVEL <module|ALL> <0-4>: 0 none, 1 error, 2 warn, 3 info, 4 debug
+      int space = cmd.indexOf(' ', 9);
+      int module = space > 0 ? Logger::findModule(cmd.substring(9, space).c_str()) : -1;
+      if (module < 0) {
+        LOG("Usage: LOGLEVEL <MAIN|MODE|SERVO|TIME|SCHED|WIFI|WEB|BACKEND|PROV|OTA|RADIO|TRACE|ALL> <0-4>");
+      } else {
+        logger.setLevel(module, (uint8_t)cmd.substring(space + 1).toInt());
+        LOG("Log level %s = %u", Logger::moduleName(module),
+            Logger::levels[module < LOG_MOD_COUNT ? module : 0]);
+      }
+#endif
     }
   }
   
   // Update state machine
   updateStateMachine();
+  loopProfiler.lap(PROF_MAIN);
   
   // Handle web requests
   webPortal.handleClient();
+#if defined(ESP8266)
+  // No heap low-water mark in the ESP8266 core: sample it once per loop
+  metrics.lower(MET_HEAP_MIN_FREE_BYTES, ESP.getFreeHeap());
+#endif
+  loopProfiler.lap(PROF_WEB);
+  
+  // Mode changed from the portal: switch modules over in place, never mid-feed
+  if (modeManager.isTransitionPending() && servoController.isIdle()) {
+    modeManager.applyTransition();
+    loopProfiler.lap(PROF_MODE);
+  }
+  
+  // Station connect / reconnect (idle until credentials are used, never blocks,
+  // so a connect started from the portal also completes during setup)
+  wifiManager.maintain();
+  loopProfiler.lap(PROF_WIFI);
+  
+  // Setup AP / DNS up or down, AP channel, modem sleep
+  radioPolicy.tick();
+  loopProfiler.lap(PROF_RADIO);
   
   // Update servo controller
   servoController.tick();
+  loopProfiler.lap(PROF_SERVO);
+  
+#if OTA_ENABLED
+  // Post-update health check: loop() kept running, in any mode and state
+  // (a device that boots offline or into the setup AP must confirm too)
+  otaUpdater.confirmBoot(millis() > OTA_HEALTH_UPTIME_MS);
+  
+#if BACKEND_ENABLED
+  // No check or restart mid-feed or while the backend is failing; a download
+  // in progress advances one bounded step per pass, while feeding as well
+  if (modeManager.getMode() == MODE_ONLINE) {
+    otaUpdater.tick(currentState == STATE_READY && servoController.isIdle() &&
+                    backendClient.getBreakerState() == BREAKER_CLOSED);
+  }
+#endif
+  loopProfiler.lap(PROF_OTA);
+#endif
   
   // Update scheduler (if in ready state)
   if (currentState == STATE_READY) {
-    // Online mode: Check backend for feed schedule
     if (modeManager.getMode() == MODE_ONLINE) {
-      wifiManager.maintain();
-      
 #if BACKEND_ENABLED
-      // Check backend feed schedule
-      uint32_t feedDuration = 0;
-      if (backendClient.checkFeedSchedule(feedDuration)) {
-        LOG("Backend: Feed command received");
-        
-        // Override duration if specified
-        if (feedDuration > 0) {
-          scheduler.setOpenHoldDuration(feedDuration);
-        }
-        
-        // Trigger feed
-        servoController.open();
+      // Outbound request queue: heartbeat asks for feed decisions only while
+      // the schedule cannot run locally
+      backendClient.setLocalScheduleActive(backendBridge.isLocalScheduleActive());
+      backendClient.tick();
+      loopProfiler.lap(PROF_BACKEND);
+      
+      // Apply clock, provisioning and schedule changes pulled from backend
+      backendBridge.applyBackendClock();
+      backendBridge.applyProvisioning();
+      backendBridge.applyBackendSchedule();
+      
+      if (backendBridge.handleFeedCommand()) {
         currentState = STATE_FEEDING;
-        
-        // Log feed event
-        String meta = "{\"duration_ms\":" + String(feedDuration > 0 ? feedDuration : OPEN_HOLD_MS) + ",\"source\":\"backend\"}";
-        backendClient.sendLog("info", "Feeding triggered by backend", meta);
       }
+      loopProfiler.lap(PROF_BACKEND);
 #endif
-    } else {
-      // Offline mode: Use local scheduler
-      scheduler.tick();
     }
+    
+    // Local scheduler (offline mode, and online mode with synced schedule)
+    bool wasIdle = servoController.isIdle();
+    scheduler.tick();
+    loopProfiler.lap(PROF_SCHED);
+    
+#if BACKEND_ENABLED
+    if (modeManager.getMode() == MODE_ONLINE) {
+      backendBridge.reportScheduledFeed(wasIdle);
+    }
+    backendBridge.reportFeedTrace();
+    loopProfiler.lap(PROF_BACKEND);
+#endif
   }
   
+#if LOG_ASYNC && defined(ESP8266)
+  // No drain task: print what fits into the UART buffer
+  logger.drain(LOG_RING_SLOTS);
+  loopProfiler.lap(PROF_LOG);
+#endif
+  
   // Small delay to prevent watchdog timeout
   yield();
 }
@@ -188,11 +291,17 @@ void printWelcomeBanner() {
 }
 
 void printSystemInfo() {
+#if LOG_ASYNC
+  // Longer than the log ring: wait for the drain instead of dropping lines
+  logger.setBlocking(true);
+#endif
   LOG("============================================");
   LOG("SYSTEM INFORMATION:");
   LOG("--------------------------------------------");
   LOG("Mode: %s", modeManager.getModeString());
   LOG("Mode Selected: %s", modeManager.isModeSelected() ? "YES" : "NO");
+  LOG("Mode Transitions: %lu, last took %lu ms",
+      (unsigned long)modeManager.getTransitionCount(), (unsigned long)modeManager.getLastTransitionMs());
   LOG("Time Set: %s", timeManager.isSet() ? "YES" : "NO");
   
   if (timeManager.isSet()) {
@@ -208,12 +317,139 @@ void printSystemInfo() {
   LOG("Servo Angle: %u°", cfg.servoAngle);
   LOG("Hold Duration: %lu ms", (unsigned long)cfg.openHoldMs);
   LOG("Excluded Days: 0x%02X", cfg.excludeDaysBitmap);
+#if defined(ESP32)
+  LOG("Heap: %lu free, %lu min, %lu largest block",
+      (unsigned long)ESP.getFreeHeap(), (unsigned long)ESP.getMinFreeHeap(),
+      (unsigned long)ESP.getMaxAllocHeap());
+#elif defined(ESP8266)
+  LOG("Heap: %lu free, %lu largest block, %u%% fragmented",
+      (unsigned long)ESP.getFreeHeap(), (unsigned long)ESP.getMaxFreeBlockSize(),
+      (unsigned)ESP.getHeapFragmentation());
+#endif
+  
+#if BACKEND_ENABLED
+  if (modeManager.getMode() == MODE_ONLINE) {
+    uint32_t uptimeMin = millis() / 60000;
+    LOG("Heartbeat: every %lu ms, %lu sent (%lu/h)",
+        (unsigned long)backendClient.getHeartbeatIntervalMs(),
+        (unsigned long)backendClient.getHeartbeatCount(),
+        uptimeMin > 0 ? (unsigned long)(backendClient.getHeartbeatCount() * 60 / uptimeMin) : 0UL);
+    LOG("Backend Queue: %u pending, %u events buffered (%lu dropped), breaker %s",
+        backendClient.getQueueDepth(), backendClient.getPendingEvents(),
+        (unsigned long)backendClient.getEventsDropped(), backendClient.getBreakerStateString());
+    LOG("Backend Requests: %lu sent, %lu failed, %lu dropped, %lu over budget",
+        (unsigned long)backendClient.getRequestsSent(),
+        (unsigned long)backendClient.getRequestsFailed(),
+        (unsigned long)backendClient.getRequestsDropped(),
+        (unsigned long)backendClient.getBudgetOverruns());
+    LOG("Backend Connection: %s, %lu connects, %lu reused, %lu handshakes (avg %lu ms, last %lu ms), %lu pin failures",
+        backendClient.isSecure() ? "TLS" : "plain",
+        (unsigned long)backendClient.getConnectCount(),
+        (unsigned long)backendClient.getReuseCount(),
+        (unsigned long)backendClient.getHandshakeCount(),
+        (unsigned long)backendClient.getAvgHandshakeMs(),
+        (unsigned long)backendClient.getLastHandshakeMs(),
+        (unsigned long)backendClient.getPinFailures());
+    for (uint8_t t = 0; t < REQ_TYPE_COUNT; t++) {
+      const RttEstimator& est = backendClient.getRtt((BackendRequestType)t);
+      LOG("Backend RTT [%u]: srtt %lu ms, rttvar %lu ms, timeout %u ms, %lu samples, %lu timeouts",
+          t, (unsigned long)est.srttMs, (unsigned long)est.rttvarMs,
+          backendClient.getTimeoutMs((BackendRequestType)t),
+          (unsigned long)est.samples, (unsigned long)est.timeouts);
+    }
+    LOG("Backend Endpoints: %u, active #%u, %lu failovers",
+        backendClient.getEndpointCount(), backendClient.getActiveEndpoint(),
+        (unsigned long)backendClient.getFailoverCount());
+    for (uint8_t i = 0; i < backendClient.getEndpointCount(); i++) {
+      const BackendEndpoint& ep = backendClient.getEndpoint(i);
+      LOG("  %c %s:%u - %s, connect %lu ms, %lu requests, %lu failures",
+          i == backendClient.getActiveEndpoint() ? '*' : '-',
+          ep.host.c_str(), ep.port,
+          backendClient.isEndpointHealthy(i) ? "up" : "down",
+          (unsigned long)ep.connectRtt.srttMs, (unsigned long)ep.requests, (unsigned long)ep.failures);
+    }
+    LOG("Backend Connect RTT: srtt %lu ms, rttvar %lu ms, timeout %u ms",
+        (unsigned long)backendClient.getConnectRtt().srttMs,
+        (unsigned long)backendClient.getConnectRtt().rttvarMs,
+        backendClient.getConnectTimeoutMs());
+    const ProvisionConfig& prov = provisioning.getConfig();
+    LOG("Provisioning: v%lu, servo %u-%u µs, telemetry %lu ms",
+        (unsigned long)prov.version, prov.servoClosedUs, prov.servoOpenUs,
+        (unsigned long)prov.telemetryMs);
+  }
+#endif
+  
+#if OTA_ENABLED
+  LOG("OTA: %s", otaUpdater.getStateString());
+  if (otaUpdater.getLastImageBytes() > 0) {
+    LOG("OTA Last Update: %s, %lu bytes downloaded, %lu byte image, %lu ms",
+        otaUpdater.wasLastDelta() ? "delta" : "full",
+        (unsigned long)otaUpdater.getLastDownloadBytes(),
+        (unsigned long)otaUpdater.getLastImageBytes(),
+        (unsigned long)otaUpdater.getLastDurationMs());
+  }
+  if (otaUpdater.getLastError().length() > 0) {
+    LOG("OTA Last Error: %s", otaUpdater.getLastError().c_str());
+  }
+#endif
   
   if (webPortal.isAPStarted()) {
-    LOG("Web Portal: http://192.168.1.1");
+    LOG("Web Portal: http://192.168.1.1 (AP channel %u)", webPortal.getAPChannel());
   }
+  // Radio duty cycle; compare with the Backend RTT lines for station latency
+  uint32_t uptimeMs = millis();
+  LOG("Radio: AP up %lu%%, modem sleep %lu%% of uptime; %lu AP starts, %lu stops, %lu channel moves",
+      uptimeMs > 0 ? (unsigned long)((uint64_t)radioPolicy.getApOnMs() * 100 / uptimeMs) : 0UL,
+      uptimeMs > 0 ? (unsigned long)((uint64_t)radioPolicy.getSleepMs() * 100 / uptimeMs) : 0UL,
+      (unsigned long)radioPolicy.getApStarts(), (unsigned long)radioPolicy.getApStops(),
+      (unsigned long)radioPolicy.getChannelMoves());
+#if LOG_ASYNC
+  LOG("Log: %lu written, %lu dropped, %lu truncated, ring high-water %u/%u, write avg %lu us, max %lu us",
+      (unsigned long)logger.getWritten(), (unsigned long)logger.getDropped(),
+      (unsigned long)logger.getTruncated(), logger.getHighWater(), LOG_RING_SLOTS,
+      (unsigned long)logger.getAvgWriteUs(), (unsigned long)logger.getMaxWriteUs());
+#endif
+  // Reconnect time: "last" is begin() to IP, "outage" is loss to IP
+  LOG("WiFi: last connect %lu ms, last outage %lu ms; %lu fast, %lu full connects, %u failures in a row",
+      (unsigned long)wifiManager.getLastConnectMs(), (unsigned long)wifiManager.getLastOutageMs(),
+      (unsigned long)wifiManager.getFastConnects(), (unsigned long)wifiManager.getFullConnects(),
+      wifiManager.getFailures());
+  LOG("Web Portal Requests: %lu served, %lu rejected, %lu expired, max queue wait %lu ms",
+      (unsigned long)webPortal.getServedCount(),
+      (unsigned long)webPortal.getRejectedCount(),
+      (unsigned long)webPortal.getExpiredCount(),
+      (unsigned long)webPortal.getMaxQueueWaitMs());
+#if PROFILE_ENABLED
+  // Where loop() time goes; /api/metrics?reset=1 starts a new measurement
+  const LatencyHistogram& loopTime = loopProfiler.getLoop();
+  LOG("Loop: %lu iterations in %lu s, avg %lu us, p50 %lu us, p99 %lu us, p99.9 %lu us, max %lu us",
+      (unsigned long)loopTime.getCount(), (unsigned long)(loopProfiler.getSinceResetMs() / 1000),
+      (unsigned long)loopTime.getAvgUs(), (unsigned long)loopTime.percentile(500),
+      (unsigned long)loopTime.percentile(990), (unsigned long)loopTime.percentile(999),
+      (unsigned long)loopTime.getMaxUs());
+  for (uint8_t i = 0; i < PROF_SECTION_COUNT; i++) {
+    const LatencyHistogram& section = loopProfiler.getSection(i);
+    if (section.getCount() == 0) continue;
+    uint16_t share = loopProfiler.getSharePerMille(i);
+    LOG("  %-7s %3u.%u%% of loop time, avg %lu us, p99 %lu us, max %lu us",
+        LoopProfiler::sectionName(i), share / 10, share % 10,
+        (unsigned long)section.getAvgUs(), (unsigned long)section.percentile(990),
+        (unsigned long)section.getMaxUs());
+  }
+  LOG("Loop Stalls (>= %lu ms): %lu", (unsigned long)(PROFILE_STALL_US / 1000),
+      (unsigned long)loopProfiler.getStallCount());
+  for (uint8_t i = 0; i < loopProfiler.getStallEventCount(); i++) {
+    const StallEvent& stall = loopProfiler.getStallEvent(i);
+    LOG("  at %lu ms: %lu ms, %s %lu ms", (unsigned long)stall.atMs,
+        (unsigned long)(stall.loopUs / 1000), LoopProfiler::sectionName(stall.culprit),
+        (unsigned long)(stall.culpritUs / 1000));
+  }
+#endif
   
   LOG("============================================");
+#if LOG_ASYNC
+  logger.setBlocking(false);
+#endif
 }
 
 bool initializeHardware() {
@@ -221,7 +457,7 @@ bool initializeHardware() {
   
   // Initialize servo
   if (!servoController.begin()) {
-    LOG("ERROR: Servo initialization failed");
+    LOGE("ERROR: Servo initialization failed");
     return false;
   }
   
@@ -253,36 +489,25 @@ bool initializeModules() {
     LOG("Scheduler initialized");
   }
   
-  // Initialize WiFi manager and backend client (for online mode)
-  if (modeManager.getMode() == MODE_ONLINE) {
-    if (!wifiManager.begin()) {
-      LOG("WiFi manager initialized (no saved credentials)");
-    } else {
-      LOG("WiFi manager initialized");
-      // Try to connect with saved credentials
-      wifiManager.connectSaved();
-    }
-    
-    // Initialize backend client with token and HTTPS support
+  // Mode-specific parts, in dependency order: backend needs WiFi. The
+  // scheduler is not registered - it runs in every mode and keeps its state
+  modeManager.addModule("wifi", startWiFi, stopWiFi);
 #if BACKEND_ENABLED
-    backendClient.begin(BACKEND_HOST, BACKEND_PORT, BACKEND_AUTH_TOKEN, BACKEND_USE_HTTPS);
-    backendClient.setTimezoneOffset(timeManager.getTimezoneOffset());
-    LOG("Backend client initialized - MAC: %s", backendClient.getMacAddress().c_str());
-    
-    // Sync schedule from backend on startup
-    if (backendClient.syncScheduleFromBackend()) {
-      LOG("Initial schedule sync successful");
-    } else {
-      LOG("Initial schedule sync failed - will retry later");
-    }
+  modeManager.addModule("backend", startBackend, stopBackend);
+#endif
+  modeManager.applyTransition();
+  
+#if OTA_ENABLED
+  // Always initialized: a freshly updated image must confirm itself in either mode
+  otaUpdater.begin(&backendClient, BACKEND_AUTH_TOKEN);
 #endif
-  }
   
   // Initialize web portal
   if (!webPortal.begin()) {
-    LOG("ERROR: Web portal initialization failed");
+    LOGE("ERROR: Web portal initialization failed");
     return false;
   }
+  radioPolicy.begin();
   
   LOG("All modules initialized successfully");
   return true;
@@ -302,11 +527,11 @@ void updateStateMachine() {
       // Boot complete, move to next state
       currentState = STATE_INITIALIZING;
       break;
-      
+    
     case STATE_INITIALIZING:
       // Initialization complete in setup()
       break;
-      
+    
     case STATE_MODE_SELECTION:
       // Wait for user to select mode
       if (modeManager.isModeSelected()) {
@@ -315,29 +540,79 @@ void updateStateMachine() {
         printSystemInfo();
       }
       break;
-      
+    
     case STATE_READY:
       // Normal operation
+      if (!modeManager.isModeSelected()) {
+        LOG("Mode reset - waiting for user selection");
+        currentState = STATE_MODE_SELECTION;
+        break;
+      }
+    
       // Check if feeding is in progress
       if (servoController.getState() != MOTOR_IDLE) {
         currentState = STATE_FEEDING;
       }
       break;
-      
+    
     case STATE_FEEDING:
       // Wait for feeding to complete
       if (servoController.getState() == MOTOR_IDLE) {
         currentState = STATE_READY;
       }
       break;
-      
+    
     case STATE_ERROR:
       // Error state - halt operation
       static uint32_t lastErrorLog = 0;
       if (millis() - lastErrorLog > 5000) {
-        LOG("ERROR STATE - System halted");
+        LOGE("ERROR STATE - System halted");
         lastErrorLog = millis();
       }
       break;
   }
 }
+
+// ================== Mode Transition Hooks ==================
+
+void startWiFi(OperationMode mode) {
+  if (mode != MODE_ONLINE) return;
+  
+  if (!wifiManager.begin()) {
+    LOG("WiFi manager initialized (no saved credentials)");
+  } else {
+    LOG("WiFi manager initialized");
+    // Connect with saved credentials in the background (loop() drives it)
+    wifiManager.connectSaved();
+  }
+}
+
+void stopWiFi(OperationMode mode) {
+  if (mode != MODE_ONLINE) return;
+  
+  // Credentials stay saved; the radio policy brings the AP back if needed
+  wifiManager.disconnect();
+}
+
+#if BACKEND_ENABLED
+void startBackend(OperationMode mode) {
+  if (mode != MODE_ONLINE) return;
+  
+  // Initialize backend client with token and HTTPS support
+  backendBridge.start(BACKEND_HOST, BACKEND_PORT, BACKEND_AUTH_TOKEN, BACKEND_USE_HTTPS);
+  
+  // Initial schedule sync runs from loop() at a per-MAC offset, so a fleet
+  // rebooting after a power outage does not hit the backend in the same second
+}
+
+void stopBackend(OperationMode mode) {
+  if (mode != MODE_ONLINE) return;
+#if OTA_ENABLED
+  otaUpdater.cancel();
+#endif
+  backendBridge.stop();
+}
+#else
+void startBackend(OperationMode mode) {}
+void stopBackend(OperationMode mode) {}
+#endif
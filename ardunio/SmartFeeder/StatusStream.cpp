@@ -0,0 +1,154 @@
+#define LOG_MODULE LOG_MOD_WEB
+#include "StatusStream.h"
+
+StatusStream::StatusStream()
+  : events(LIVE_EVENTS_PATH)
+  , eventId(0)
+#if defined(ESP32)
+  , lock(nullptr)
+#endif
+  , sentCount(0)
+  , deferredCount(0)
+  , refusedCount(0) {
+  for (uint8_t i = 0; i < AP_MAX_CONNECTIONS; i++) {
+    subscribers[i].client = nullptr;
+    subscribers[i].dirty = 0;
+  }
+  memset(&state, 0, sizeof(state));
+}
+
+StatusStream::~StatusStream() {
+#if defined(ESP32)
+  if (lock) vSemaphoreDelete(lock);
+#endif
+}
+
+void StatusStream::begin(AsyncWebServer* server, const LiveState& initial) {
+#if defined(ESP32)
+  lock = xSemaphoreCreateMutex();
+#endif
+  state = initial;
+  
+  events.onConnect([this](AsyncEventSourceClient* client) { addSubscriber(client); });
+  events.onDisconnect([this](AsyncEventSourceClient* client) { removeSubscriber(client); });
+  server->addHandler(&events);
+  
+  LOG("StatusStream: Live status on %s (max %d subscribers)", LIVE_EVENTS_PATH, AP_MAX_CONNECTIONS);
+}
+
+void StatusStream::lockSubscribers() {
+#if defined(ESP32)
+  if (lock) xSemaphoreTake(lock, portMAX_DELAY);
+#endif
+  // ESP8266: async callbacks never preempt loop(), nothing to lock
+}
+
+void StatusStream::unlockSubscribers() {
+#if defined(ESP32)
+  if (lock) xSemaphoreGive(lock);
+#endif
+}
+
+void StatusStream::addSubscriber(AsyncEventSourceClient* client) {
+  lockSubscribers();
+  for (uint8_t i = 0; i < AP_MAX_CONNECTIONS; i++) {
+    if (subscribers[i].client) continue;
+    
+    // Full state goes out with the next publish()
+    subscribers[i].client = client;
+    subscribers[i].dirty = FIELD_ALL;
+    unlockSubscribers();
+    return;
+  }
+  refusedCount++;
+  unlockSubscribers();
+  
+  // Browser falls back to polling after repeated errors
+  LOG("StatusStream: Subscriber limit reached, closing connection");
+  client->close();
+}
+
+void StatusStream::removeSubscriber(AsyncEventSourceClient* client) {
+  lockSubscribers();
+  for (uint8_t i = 0; i < AP_MAX_CONNECTIONS; i++) {
+    if (subscribers[i].client == client) {
+      subscribers[i].client = nullptr;
+      subscribers[i].dirty = 0;
+    }
+  }
+  unlockSubscribers();
+}
+
+void StatusStream::publish(const LiveState& next) {
+  uint8_t changed = 0;
+  if (next.mode != state.mode) changed |= FIELD_MODE;
+  if (next.motor != state.motor) changed |= FIELD_MOTOR;
+  if (next.timeSet != state.timeSet || strcmp(next.time, state.time) != 0) changed |= FIELD_TIME;
+  if (next.wifiConnected != state.wifiConnected) changed |= FIELD_WIFI | FIELD_RSSI;
+  if (next.rssi != state.rssi) changed |= FIELD_RSSI;
+  if (next.feeds != state.feeds) changed |= FIELD_FEEDS;
+  
+  lockSubscribers();
+  state = next;
+  
+  for (uint8_t i = 0; i < AP_MAX_CONNECTIONS; i++) {
+    Subscriber& sub = subscribers[i];
+    if (!sub.client) continue;
+    
+    sub.dirty |= changed;
+    if (!sub.dirty) continue;
+    
+    // Backpressure: keep accumulating until this client has drained
+    if (sub.client->packetsWaiting() > LIVE_MAX_BACKLOG) {
+      if (changed) deferredCount++;
+      continue;
+    }
+    
+    char buf[192];
+    JsonWriter json(buf, sizeof(buf));
+    writeFields(json, sub.dirty);
+    sub.client->send(buf, "status", ++eventId);
+    sub.dirty = 0;
+    sentCount++;
+  }
+  
+  unlockSubscribers();
+}
+
+void StatusStream::writeFields(JsonWriter& json, uint8_t mask) const {
+  static const char* const modeNames[] = { "none", "offline", "online" };
+  static const char* const motorNames[] = { "idle", "opening", "open", "closing" };
+  
+  json.beginObject();
+  if (mask & FIELD_MODE) {
+    json.key("mode").value(modeNames[state.mode <= MODE_ONLINE ? state.mode : MODE_NOT_SELECTED]);
+  }
+  if (mask & FIELD_MOTOR) {
+    json.key("motor").value(motorNames[state.motor <= MOTOR_CLOSING ? state.motor : MOTOR_IDLE]);
+  }
+  if (mask & FIELD_TIME) {
+    json.key("time");
+    if (state.timeSet) json.value(state.time);
+    else json.null();
+  }
+  if (mask & FIELD_WIFI) {
+    json.key("wifi").boolean(state.wifiConnected);
+  }
+  if (mask & FIELD_RSSI) {
+    json.key("rssi");
+    if (state.wifiConnected) json.number(state.rssi);
+    else json.null();
+  }
+  if (mask & FIELD_FEEDS) {
+    json.key("feeds").number(state.feeds);
+  }
+  json.endObject();
+}
+
+uint8_t StatusStream::getSubscriberCount() const {
+  uint8_t count = 0;
+  for (uint8_t i = 0; i < AP_MAX_CONNECTIONS; i++) {
+    if (subscribers[i].client) count++;
+  }
+  return count;
+}
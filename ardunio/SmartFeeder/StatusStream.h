@@ -0,0 +1,100 @@
+#ifndef STATUS_STREAM_H
+#define STATUS_STREAM_H
+
+#include "Config.h"
+#include "ResponseWriter.h"
+
+#if defined(ESP8266)
+  #include <ESPAsyncTCP.h>
+  #include <ESPAsyncWebServer.h>
+#elif defined(ESP32)
+  #include <AsyncTCP.h>
+  #include <ESPAsyncWebServer.h>
+  #include <freertos/semphr.h>
+#endif
+
+/**
+ * @brief Device state shown live in the portal
+ */
+struct LiveState {
+  OperationMode mode;
+  MotorState motor;
+  bool timeSet;
+  char time[16];        // "Mon 16:23"
+  bool wifiConnected;
+  int8_t rssi;          // Rounded to LIVE_RSSI_STEP_DB so noise is not pushed
+  uint32_t feeds;       // Lid openings since boot
+};
+
+/**
+ * @brief Live status pushed to portal pages over Server-Sent Events
+ * 
+ * loop() hands in a fresh LiveState with publish(); each subscriber is
+ * sent only the fields that changed since its last event. Up to
+ * AP_MAX_CONNECTIONS subscribers are accepted. A subscriber with more than
+ * LIVE_MAX_BACKLOG unsent packets is skipped; its changes accumulate and go
+ * out as one event once it has drained, so a slow browser never queues
+ * stale copies of the state.
+ */
+class StatusStream {
+private:
+  enum Field : uint8_t {
+    FIELD_MODE  = 0x01,
+    FIELD_MOTOR = 0x02,
+    FIELD_TIME  = 0x04,
+    FIELD_WIFI  = 0x08,
+    FIELD_RSSI  = 0x10,
+    FIELD_FEEDS = 0x20,
+    FIELD_ALL   = 0x3F
+  };
+  
+  struct Subscriber {
+    AsyncEventSourceClient* client;  // nullptr = free
+    uint8_t dirty;                   // Fields changed since last sent
+  };
+  
+  AsyncEventSource events;
+  Subscriber subscribers[AP_MAX_CONNECTIONS];
+  LiveState state;
+  uint32_t eventId;
+#if defined(ESP32)
+  SemaphoreHandle_t lock;
+#endif
+  
+  // Statistics
+  uint32_t sentCount;
+  uint32_t deferredCount;  // Sends postponed by backpressure
+  uint32_t refusedCount;   // Connections over the subscriber limit
+  
+  void addSubscriber(AsyncEventSourceClient* client);
+  void removeSubscriber(AsyncEventSourceClient* client);
+  
+  /**
+   * @brief Write the fields in mask as one JSON object
+   */
+  void writeFields(JsonWriter& json, uint8_t mask) const;
+  
+  void lockSubscribers();
+  void unlockSubscribers();
+  
+public:
+  StatusStream();
+  ~StatusStream();
+  
+  /**
+   * @brief Register the event endpoint on the server
+   */
+  void begin(AsyncWebServer* server, const LiveState& initial);
+  
+  /**
+   * @brief Record new state and push changes to subscribers (call in loop)
+   */
+  void publish(const LiveState& next);
+  
+  uint8_t getSubscriberCount() const;
+  uint32_t getSentCount() const { return sentCount; }
+  uint32_t getDeferredCount() const { return deferredCount; }
+  uint32_t getRefusedCount() const { return refusedCount; }
+};
+
+#endif // STATUS_STREAM_H
@@ -1,4 +1,6 @@
+#define LOG_MODULE LOG_MOD_TIME
 #include "TimeManager.h"
+#include "Metrics.h"
 
 #if defined(ESP32)
   #include <Preferences.h>
@@ -39,6 +41,13 @@ uint32_t TimeManager::getLocalEpoch() const {
   return (uint32_t)(epochBase + elapsed);
 }
 
+uint64_t TimeManager::getUtcEpochMs() const {
+  if (!isTimeSet) return 0;
+  
+  int64_t utcBaseMs = (epochBase + (int64_t)timezoneOffsetMin * 60) * 1000;
+  return (uint64_t)(utcBaseMs + ((int64_t)millis() - epochSetAtMs));
+}
+
 uint8_t TimeManager::getDayOfWeek() const {
   uint32_t epoch = getLocalEpoch();
   if (epoch == 0) return 0;
@@ -58,7 +67,16 @@ uint16_t TimeManager::getMinuteOfDay() const {
 }
 
 String TimeManager::getTimeString() const {
-  if (!isTimeSet) return "Not Set";
+  char buf[32];
+  formatTime(buf, sizeof(buf));
+  return String(buf);
+}
+
+void TimeManager::formatTime(char* buf, size_t size) const {
+  if (!isTimeSet) {
+    snprintf(buf, size, "Not Set");
+    return;
+  }
   
   uint8_t dow = getDayOfWeek();
   uint16_t mod = getMinuteOfDay();
@@ -67,9 +85,7 @@ String TimeManager::getTimeString() const {
   
   const char* days[] = {"Sun", "Mon", "Tue", "Wed", "Thu", "Fri", "Sat"};
   
-  char buf[32];
-  snprintf(buf, sizeof(buf), "%s %02u:%02u", days[dow], hour, minute);
-  return String(buf);
+  snprintf(buf, size, "%s %02u:%02u", days[dow], hour, minute);
 }
 
 void TimeManager::save() {
@@ -78,9 +94,10 @@ void TimeManager::save() {
   
   Preferences prefs;
   if (!prefs.begin(NVS_NAMESPACE, false)) {
-    LOG("TimeManager: Failed to save time to NVS");
+    LOGE("TimeManager: Failed to save time to NVS");
     return;
   }
+  metrics.inc(MET_NVS_WRITES_TIME);
   
   uint32_t currentEpoch = getLocalEpoch();
   prefs.putUInt("lastEpoch", currentEpoch);
@@ -96,7 +113,7 @@ bool TimeManager::load() {
 #if defined(ESP32)
   Preferences prefs;
   if (!prefs.begin(NVS_NAMESPACE, true)) {
-    LOG("TimeManager: Failed to open NVS");
+    LOGE("TimeManager: Failed to open NVS");
     return false;
   }
   
@@ -129,9 +146,10 @@ void TimeManager::clearTime() {
 #if defined(ESP32)
   Preferences prefs;
   if (!prefs.begin(NVS_NAMESPACE, false)) {
-    LOG("TimeManager: Failed to open NVS for clearing");
+    LOGE("TimeManager: Failed to open NVS for clearing");
     return;
   }
+  metrics.inc(MET_NVS_WRITES_TIME);
   
   prefs.remove("lastEpoch");
   prefs.remove("tzOffset");
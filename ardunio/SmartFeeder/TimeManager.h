@@ -38,6 +38,12 @@ public:
    */
   uint32_t getLocalEpoch() const;
   
+  /**
+   * @brief Get current UTC time in milliseconds (for event timestamps)
+   * @return UTC epoch in milliseconds, or 0 if time not set
+   */
+  uint64_t getUtcEpochMs() const;
+  
   /**
    * @brief Get current day of week (0=Sun, 1=Mon, ..., 6=Sat)
    */
@@ -53,6 +59,11 @@ public:
    */
   String getTimeString() const;
   
+  /**
+   * @brief Write the same "Mon 16:23" text into buf (no allocation)
+   */
+  void formatTime(char* buf, size_t size) const;
+  
   /**
    * @brief Check if time is set
    */
@@ -1,5 +1,6 @@
+#define LOG_MODULE LOG_MOD_WEB
 #include "WebPortal.h"
-#include "WebPortalPages.h"
+#include "WebPortalPagesGz.h"
 
 #if defined(ESP8266)
   #include <ESP8266WiFi.h>
@@ -7,74 +8,290 @@
   #include <WiFi.h>
 #endif
 
-WebPortal::WebPortal(ModeManager* mm, TimeManager* tm, OfflineScheduler* sched, WiFiManager* wm)
+// Dotted quad without IPAddress::toString() (which builds a String)
+static void formatIp(const IPAddress& ip, char* buf, size_t size) {
+  snprintf(buf, size, "%u.%u.%u.%u", ip[0], ip[1], ip[2], ip[3]);
+}
+
+static uint32_t largestFreeBlock() {
+#if defined(ESP32)
+  return ESP.getMaxAllocHeap();
+#else
+  return ESP.getMaxFreeBlockSize();
+#endif
+}
+
+// CRC-32 (zlib polynomial), continuing from a previous crc32 value
+static uint32_t crc32Update(uint32_t crc, const uint8_t* data, size_t length) {
+  crc = ~crc;
+  while (length--) {
+    crc ^= *data++;
+    for (uint8_t k = 0; k < 8; k++) {
+      crc = (crc >> 1) ^ (0xEDB88320UL & (0 - (crc & 1)));
+    }
+  }
+  return ~crc;
+}
+
+// a * b modulo the CRC-32 polynomial (zlib's multmodp, used to combine CRCs)
+static uint32_t crc32MultModP(uint32_t a, uint32_t b) {
+  uint32_t m = 1UL << 31;
+  uint32_t p = 0;
+  for (;;) {
+    if (a & m) {
+      p ^= b;
+      if ((a & (m - 1)) == 0) break;
+    }
+    m >>= 1;
+    b = (b & 1) ? (b >> 1) ^ 0xEDB88320UL : b >> 1;
+  }
+  return p;
+}
+
+// Fill bytes [index, index + maxLen) of a spliced page response: flash head,
+// stored state block, flash tail, gzip trailer (state and trailer from the slot)
+static size_t fillSplicedPage(const SplicedPage& page, const uint8_t* state, size_t stateLength,
+                              uint8_t* out, size_t maxLen, size_t index) {
+  struct Part {
+    const uint8_t* data;
+    size_t length;
+    bool flash;
+  };
+  const Part parts[] = {
+    { page.head, page.headLength, true },
+    { state, stateLength, false },
+    { page.tail, page.tailLength, true },
+    { state + stateLength, 8, false },
+  };
+  
+  size_t n = 0;
+  size_t offset = 0;
+  for (const Part& part : parts) {
+    if (n >= maxLen) break;
+    if (index + n < offset + part.length) {
+      size_t from = index + n - offset;
+      size_t count = part.length - from;
+      if (count > maxLen - n) count = maxLen - n;
+      if (part.flash) {
+        memcpy_P(out + n, part.data + from, count);
+      } else {
+        memcpy(out + n, part.data + from, count);
+      }
+      n += count;
+    }
+    offset += part.length;
+  }
+  return n;
+}
+
+// ================== PortalRequest ==================
+
+void PortalRequest::reset() {
+  for (uint8_t i = 0; i < MAX_ARGS; i++) {
+    argNames[i] = String();
+    argValues[i] = String();
+  }
+  argCount = 0;
+  ifNoneMatch = String();
+  code = 0;
+  contentType = "text/plain";
+  body[0] = '\0';
+  bodyLength = 0;
+  page = nullptr;
+  spliced = nullptr;
+  metricValues = nullptr;
+}
+
+bool PortalRequest::hasArg(const char* name) const {
+  for (uint8_t i = 0; i < argCount; i++) {
+    if (argNames[i] == name) return true;
+  }
+  return false;
+}
+
+String PortalRequest::arg(const char* name) const {
+  for (uint8_t i = 0; i < argCount; i++) {
+    if (argNames[i] == name) return argValues[i];
+  }
+  return String();
+}
+
+void PortalRequest::send(int code, const char* contentType, const char* body) {
+  this->code = code;
+  this->contentType = contentType;
+  strlcpy(this->body, body, sizeof(this->body));
+  bodyLength = strlen(this->body);
+  page = nullptr;
+  spliced = nullptr;
+  metricValues = nullptr;
+}
+
+void PortalRequest::send(int code, const char* contentType, const ResponseWriter& writer) {
+  if (writer.overflowed()) {
+    LOG("WebPortal: Response exceeds %u bytes", (unsigned)sizeof(body));
+    send(500, "text/plain", "Response too large");
+    return;
+  }
+  
+  this->code = code;
+  this->contentType = contentType;
+  bodyLength = writer.length();
+  page = nullptr;
+  spliced = nullptr;
+  metricValues = nullptr;
+}
+
+void PortalRequest::sendPage(const GzipPage& page) {
+  code = 200;
+  this->page = &page;
+  spliced = nullptr;
+  metricValues = nullptr;
+}
+
+void PortalRequest::sendPage(const SplicedPage& page, const ResponseWriter& state) {
+  if (state.overflowed()) {
+    LOG("WebPortal: Page state exceeds %u bytes", (unsigned)stateBufferSize());
+    send(500, "text/plain", "Response too large");
+    return;
+  }
+  
+  // The state is already in place after room for a stored deflate block header
+  uint8_t* out = (uint8_t*)body;
+  size_t n = state.length();
+  out[0] = 0x00;  // BFINAL=0, BTYPE=00 (stored), byte-aligned after the head's sync flush
+  out[1] = n & 0xFF;
+  out[2] = (n >> 8) & 0xFF;
+  out[3] = ~out[1];
+  out[4] = ~out[2];
+  
+  // gzip trailer over the whole text: CRC-32 of head+state, combined with the tail's
+  uint32_t crc = crc32Update(page.headCrc, out + SPLICE_HEADER_LEN, n);
+  crc = crc32MultModP(page.tailShift, crc) ^ page.tailCrc;
+  uint32_t size = page.textLength + n;
+  uint8_t* trailer = out + SPLICE_HEADER_LEN + n;
+  for (uint8_t i = 0; i < 4; i++) {
+    trailer[i] = (crc >> (8 * i)) & 0xFF;
+    trailer[4 + i] = (size >> (8 * i)) & 0xFF;
+  }
+  
+  code = 200;
+  contentType = "text/html";
+  bodyLength = SPLICE_HEADER_LEN + n;
+  this->page = nullptr;
+  spliced = &page;
+  metricValues = nullptr;
+}
+
+static_assert(sizeof(MetricValues) <= WEB_RESPONSE_MAX, "MetricValues is copied into the response buffer");
+
+void PortalRequest::sendMetrics(const MetricValues& values) {
+  memcpy(body, &values, sizeof(values));
+  code = 200;
+  contentType = "text/plain; version=0.0.4";
+  bodyLength = sizeof(values);
+  page = nullptr;
+  spliced = nullptr;
+  metricValues = (const MetricValues*)body;
+}
+
+// ================== WebPortal ==================
+
+WebPortal::WebPortal(ModeManager* mm, TimeManager* tm, OfflineScheduler* sched, WiFiManager* wm,
+                     ServoController* servo, LoopProfiler* profiler,
+                     ProvisionManager* provisioning)
   : server(nullptr)
   , dnsServer(nullptr)
   , modeManager(mm)
   , timeManager(tm)
   , scheduler(sched)
   , wifiManager(wm)
-  , apStarted(false) {
+  , servo(servo)
+  , profiler(profiler)
+  , provisioning(provisioning)
+  , apStarted(false)
+  , apChannel(AP_CHANNEL)
+  , lastLiveSample(0)
+  , lastOpenedAt(0)
+  , feedCount(0)
+#if defined(ESP32)
+  , queueLock(nullptr)
+#endif
+  , servedCount(0)
+  , rejectedCount(0)
+  , expiredCount(0)
+  , maxQueueWaitMs(0) {
+  for (uint8_t i = 0; i < WEB_MAX_PENDING; i++) {
+    pending[i].request = nullptr;
+    pending[i].handler = nullptr;
+    pending[i].clientIp = 0;
+    pending[i].queuedAt = 0;
+    pending[i].state = SLOT_FREE;
+    pending[i].req.reset();
+  }
 }
 
 WebPortal::~WebPortal() {
   if (server) delete server;
   if (dnsServer) delete dnsServer;
+#if defined(ESP32)
+  if (queueLock) vSemaphoreDelete(queueLock);
+#endif
 }
 
 bool WebPortal::begin() {
-  if (!startAccessPoint()) {
-    LOG("WebPortal: Failed to start AP");
+  if (!startAccessPoint(AP_CHANNEL)) {
+    LOGE("WebPortal: Failed to start AP");
     return false;
   }
   
+#if defined(ESP32)
+  queueLock = xSemaphoreCreateMutex();
+#endif
+  
   // Create web server
-  server = new WebServer(80);
-  
-  // Register handlers
-  server->on("/", [this]() { this->handleRoot(); });
-  server->on("/api/set-mode/", HTTP_POST, [this]() { this->handleSetMode(); });
-  server->on("/api/set-time/", HTTP_POST, [this]() { this->handleSetTime(); });
-  server->on("/api/set-feed-times/", HTTP_POST, [this]() { this->handleSetFeedTimes(); });
-  server->on("/api/set-servo-angle/", HTTP_POST, [this]() { this->handleSetServoAngle(); });
-  server->on("/api/set-hold/", HTTP_POST, [this]() { this->handleSetHoldDuration(); });
-  server->on("/api/test-feed/", HTTP_POST, [this]() { this->handleTestFeed(); });
-  server->on("/api/get-status/", HTTP_GET, [this]() { this->handleGetStatus(); });
-  server->on("/api/get-config/", HTTP_GET, [this]() { this->handleGetConfig(); });
-  server->on("/api/change-mode/", HTTP_POST, [this]() { this->handleChangeMode(); });
-  server->on("/api/factory-reset/", HTTP_POST, [this]() { this->handleFactoryReset(); });
-  server->on("/api/wifi-scan/", HTTP_GET, [this]() { this->handleWiFiScan(); });
-  server->on("/api/wifi-connect/", HTTP_POST, [this]() { this->handleWiFiConnect(); });
-  server->on("/api/wifi-status/", HTTP_GET, [this]() { this->handleWiFiStatus(); });
-  server->on("/api/wifi-reset/", HTTP_POST, [this]() { this->handleWiFiReset(); });
-  server->on("/api/wifi-disconnect/", HTTP_POST, [this]() { this->handleWiFiDisconnect(); });
-  server->on("/api/reset-mode/", HTTP_POST, [this]() { this->handleResetMode(); });
-  server->on("/api/sync-schedule/", HTTP_POST, [this]() { this->handleSyncSchedule(); });
-  // Control UI (offline-like page) accessible in any mode
-  server->on("/control", HTTP_GET, [this]() {
-    server->setContentLength(strlen_P(SCHEDULER_PAGE));
-    server->send_P(200, "text/html", SCHEDULER_PAGE);
-  });
+  server = new AsyncWebServer(80);
+  
+  // Pages and API calls that read or change module state run from loop()
+  onDeferred("/", HTTP_GET, &WebPortal::handleRoot);
+  onDeferred("/debug", HTTP_GET, &WebPortal::handleDebug);
+  onDeferred("/api/metrics", HTTP_GET, &WebPortal::handleMetrics);
+  onDeferred("/metrics", HTTP_GET, &WebPortal::handlePrometheus);
+  onDeferred("/api/set-mode/", HTTP_POST, &WebPortal::handleSetMode);
+  onDeferred("/api/set-time/", HTTP_POST, &WebPortal::handleSetTime);
+  onDeferred("/api/set-feed-times/", HTTP_POST, &WebPortal::handleSetFeedTimes);
+  onDeferred("/api/set-servo-angle/", HTTP_POST, &WebPortal::handleSetServoAngle);
+  onDeferred("/api/set-hold/", HTTP_POST, &WebPortal::handleSetHoldDuration);
+  onDeferred("/api/config", HTTP_POST, &WebPortal::handleSetConfig);
+  onDeferred("/api/test-feed/", HTTP_POST, &WebPortal::handleTestFeed);
+  onDeferred("/api/get-status/", HTTP_GET, &WebPortal::handleGetStatus);
+  onDeferred("/api/get-config/", HTTP_GET, &WebPortal::handleGetConfig);
+  onDeferred("/api/change-mode/", HTTP_POST, &WebPortal::handleChangeMode);
+  onDeferred("/api/factory-reset/", HTTP_POST, &WebPortal::handleFactoryReset);
+  onDeferred("/api/wifi-scan/", HTTP_GET, &WebPortal::handleWiFiScan);
+  onDeferred("/api/wifi-connect/", HTTP_POST, &WebPortal::handleWiFiConnect);
+  onDeferred("/api/wifi-status/", HTTP_GET, &WebPortal::handleWiFiStatus);
+  onDeferred("/api/wifi-reset/", HTTP_POST, &WebPortal::handleWiFiReset);
+  onDeferred("/api/wifi-disconnect/", HTTP_POST, &WebPortal::handleWiFiDisconnect);
+  onDeferred("/api/reset-mode/", HTTP_POST, &WebPortal::handleResetMode);
+  onDeferred("/api/sync-schedule/", HTTP_POST, &WebPortal::handleSyncSchedule);
+  
+  // Control UI (offline-like page) accessible in any mode, state inlined
+  onDeferred("/control", HTTP_GET, &WebPortal::handleControl);
+  
+  // Fixed pages are answered straight from the TCP task
   // WiFi setup page accessible directly
-  server->on("/wifi-setup", HTTP_GET, [this]() {
-    server->setContentLength(strlen_P(WIFI_SETUP_PAGE));
-    server->send_P(200, "text/html", WIFI_SETUP_PAGE);
+  server->on("/wifi-setup", HTTP_GET, [](AsyncWebServerRequest* request) {
+    sendPage(request, WIFI_SETUP_PAGE_GZ);
   });
-  // Debug status page
-  server->on("/debug", HTTP_GET, [this]() {
-    String html = "<!DOCTYPE html><html><head><meta charset='utf-8'/><title>Debug</title></head><body>";
-    html += "<h2>Debug Bilgileri</h2>";
-    html += "<p><b>Mod:</b> " + String(modeManager->isModeSelected() ? (modeManager->getMode() == MODE_ONLINE ? "ONLINE" : "OFFLINE") : "SEÇİLMEDİ") + "</p>";
-    html += "<p><b>WiFi Status:</b> " + String(WiFi.status()) + " (3=WL_CONNECTED)</p>";
-    html += "<p><b>WiFi SSID:</b> " + WiFi.SSID() + "</p>";
-    html += "<p><b>WiFi IP:</b> " + WiFi.localIP().toString() + "</p>";
-    html += "<p><b>AP IP:</b> " + WiFi.softAPIP().toString() + "</p>";
-    html += "<p><b>Manager Connected:</b> " + String(wifiManager && wifiManager->connected() ? "YES" : "NO") + "</p>";
-    html += "<p><a href='/'>Ana Sayfa</a> | <a href='/control'>Kontrol</a></p>";
-    html += "</body></html>";
-    server->send(200, "text/html", html);
+  // Live status (Server-Sent Events)
+  LiveState initial;
+  sampleLiveState(initial);
+  liveStatus.begin(server, initial);
+  
+  // Redirect to root for captive portal
+  server->onNotFound([](AsyncWebServerRequest* request) {
+    request->redirect("/");
   });
-  server->onNotFound([this]() { this->handleNotFound(); });
   
   server->begin();
   LOG("WebPortal: Server started on http://%s", WiFi.softAPIP().toString().c_str());
@@ -83,50 +300,310 @@ bool WebPortal::begin() {
 }
 
 void WebPortal::handleClient() {
-  if (dnsServer) dnsServer->processNextRequest();
-  if (server) server->handleClient();
+  if (apStarted && dnsServer) dnsServer->processNextRequest();
+  runPending();
+  
+  if (server && millis() - lastLiveSample >= LIVE_SAMPLE_MS) {
+    lastLiveSample = millis();
+    LiveState s;
+    sampleLiveState(s);
+    liveStatus.publish(s);
+  }
 }
 
-bool WebPortal::startAccessPoint() {
-  // Disable WiFi sleep for stable AP operation (like reference code)
+void WebPortal::lockQueue() {
 #if defined(ESP32)
-  WiFi.setSleep(false);
-#else
-  WiFi.setSleepMode(WIFI_NONE_SLEEP);
+  if (queueLock) xSemaphoreTake(queueLock, portMAX_DELAY);
 #endif
+  // ESP8266: async callbacks never preempt loop(), nothing to lock
+}
+
+void WebPortal::unlockQueue() {
+#if defined(ESP32)
+  if (queueLock) xSemaphoreGive(queueLock);
+#endif
+}
+
+void WebPortal::onDeferred(const char* uri, WebRequestMethodComposite method, Handler handler) {
+  server->on(uri, method, [this, handler](AsyncWebServerRequest* request) {
+    enqueue(request, handler);
+  });
+}
+
+void WebPortal::enqueue(AsyncWebServerRequest* request, Handler handler) {
+  // Dropping arguments would change what the handler sees (e.g. no version)
+  if (request->params() > PortalRequest::MAX_ARGS) {
+    request->send(400, "text/plain", "Too many parameters");
+    return;
+  }
+  
+  uint32_t clientIp = (uint32_t)request->client()->remoteIP();
+  
+  lockQueue();
+  
+  PendingRequest* freeSlot = nullptr;
+  uint8_t clientInFlight = 0;
+  for (uint8_t i = 0; i < WEB_MAX_PENDING; i++) {
+    if (pending[i].state == SLOT_FREE) {
+      if (!freeSlot) freeSlot = &pending[i];
+    } else if (pending[i].clientIp == clientIp) {
+      clientInFlight++;
+    }
+  }
+  
+  if (clientInFlight >= WEB_MAX_PER_CLIENT || !freeSlot) {
+    rejectedCount++;
+    unlockQueue();
+    
+    // One client may not starve the others; a full queue sheds load
+    AsyncWebServerResponse* response = request->beginResponse(
+        freeSlot ? 429 : 503, "text/plain", "Busy");
+    response->addHeader("Retry-After", "1");
+    request->send(response);
+    return;
+  }
   
-  // Use AP_STA mode to allow scanning while AP is active
-  WiFi.mode(WIFI_AP_STA);
-  delay(100);
+  PortalRequest& req = freeSlot->req;
+  req.reset();
+  size_t params = request->params();
+  for (size_t i = 0; i < params; i++) {
+    const AsyncWebParameter* p = request->getParam(i);
+    req.argNames[req.argCount] = p->name();
+    req.argValues[req.argCount] = p->value();
+    req.argCount++;
+  }
+  if (request->hasHeader("If-None-Match")) {
+    req.ifNoneMatch = request->header("If-None-Match");
+  }
   
-  WiFi.softAPConfig(AP_IP_ADDR, AP_GATEWAY, AP_SUBNET);
+  freeSlot->request = request;
+  freeSlot->handler = handler;
+  freeSlot->clientIp = clientIp;
+  freeSlot->queuedAt = millis();
+  freeSlot->state = SLOT_QUEUED;
   
-  bool ok = WiFi.softAP(AP_SSID, AP_PASSWORD, AP_CHANNEL, AP_HIDDEN, AP_MAX_CONNECTIONS);
+  request->onDisconnect([this, request]() { cancel(request); });
+  
+  unlockQueue();
+}
+
+void WebPortal::cancel(AsyncWebServerRequest* request) {
+  lockQueue();
+  for (uint8_t i = 0; i < WEB_MAX_PENDING; i++) {
+    if (pending[i].state == SLOT_FREE || pending[i].request != request) continue;
+    
+    // A running handler finishes anyway; its response is dropped
+    pending[i].request = nullptr;
+    if (pending[i].state == SLOT_QUEUED || pending[i].state == SLOT_SENDING) {
+      pending[i].state = SLOT_FREE;
+    }
+  }
+  unlockQueue();
+}
+
+void WebPortal::runPending() {
+  unsigned long start = millis();
+  
+  while (millis() - start < WEB_WORKER_BUDGET_MS) {
+    // Oldest queued request first
+    lockQueue();
+    PendingRequest* slot = nullptr;
+    for (uint8_t i = 0; i < WEB_MAX_PENDING; i++) {
+      if (pending[i].state != SLOT_QUEUED) continue;
+      if (!slot || (long)(pending[i].queuedAt - slot->queuedAt) < 0) {
+        slot = &pending[i];
+      }
+    }
+    if (!slot) {
+      unlockQueue();
+      return;
+    }
+    
+    uint32_t waitMs = millis() - slot->queuedAt;
+    if (waitMs > WEB_QUEUE_TIMEOUT_MS) {
+      expiredCount++;
+      slot->req.send(503, "text/plain", "Timeout");
+      respond(*slot);
+      unlockQueue();
+      continue;
+    }
+    if (waitMs > maxQueueWaitMs) maxQueueWaitMs = waitMs;
+    
+    slot->state = SLOT_RUNNING;
+    unlockQueue();
+    
+    (this->*(slot->handler))(slot->req);
+    
+    lockQueue();
+    respond(*slot);
+    unlockQueue();
+  }
+}
+
+void WebPortal::respond(PendingRequest& slot) {
+  AsyncWebServerRequest* request = slot.request;
+  PortalRequest& req = slot.req;
+  
+  if (request) {
+    if (req.page) {
+      if (req.ifNoneMatch == req.page->etag) {
+        AsyncWebServerResponse* response = request->beginResponse(304);
+        response->addHeader("ETag", req.page->etag);
+        response->addHeader("Cache-Control", "no-cache");
+        request->send(response);
+      } else {
+        sendPage(request, *req.page);
+      }
+    } else if (req.spliced) {
+      // Head and tail stream straight from flash around the state in the slot
+      // buffer; the slot stays taken until the connection closes
+      const SplicedPage* page = req.spliced;
+      const uint8_t* state = (const uint8_t*)req.body;
+      size_t stateLength = req.bodyLength;
+      size_t total = page->headLength + stateLength + page->tailLength + PortalRequest::SPLICE_TRAILER_LEN;
+      AsyncWebServerResponse* response = request->beginResponse(req.contentType, total,
+          [page, state, stateLength](uint8_t* out, size_t maxLen, size_t index) -> size_t {
+            return fillSplicedPage(*page, state, stateLength, out, maxLen, index);
+          });
+      response->addHeader("Content-Encoding", "gzip");
+      response->addHeader("Cache-Control", "no-store");
+      request->send(response);
+      slot.state = SLOT_SENDING;
+      servedCount++;
+      return;
+    } else if (req.metricValues) {
+      // Text is rendered from the snapshot in the slot buffer as the TCP
+      // task asks for it; the slot stays taken until the connection closes
+      const MetricValues* values = req.metricValues;
+      AsyncWebServerResponse* response = request->beginResponse(req.contentType, Metrics::textLength(*values),
+          [values](uint8_t* out, size_t maxLen, size_t index) -> size_t {
+            return Metrics::render(*values, (char*)out, maxLen, index);
+          });
+      response->addHeader("Cache-Control", "no-store");
+      request->send(response);
+      slot.state = SLOT_SENDING;
+      servedCount++;
+      return;
+    } else if (req.bodyLength > 0) {
+      // Body is streamed from the slot buffer; the slot stays taken until
+      // the connection closes (cancel() frees it)
+      const char* body = req.body;
+      size_t bodyLength = req.bodyLength;
+      AsyncWebServerResponse* response = request->beginResponse(req.contentType, bodyLength,
+          [body, bodyLength](uint8_t* out, size_t maxLen, size_t index) -> size_t {
+            size_t n = bodyLength - index;
+            if (n > maxLen) n = maxLen;
+            memcpy(out, body + index, n);
+            return n;
+          });
+      response->setCode(req.code);
+      request->send(response);
+      slot.state = SLOT_SENDING;
+      servedCount++;
+      return;
+    } else {
+      request->send(req.code ? req.code : 500, req.contentType, "");
+    }
+    servedCount++;
+  }
+  
+  slot.request = nullptr;
+  slot.state = SLOT_FREE;
+  req.reset();
+}
+
+void WebPortal::sampleLiveState(LiveState& s) {
+  s.mode = modeManager->isModeSelected() ? modeManager->getMode() : MODE_NOT_SELECTED;
+  s.motor = servo ? servo->getState() : MOTOR_IDLE;
+  s.timeSet = timeManager->isSet();
+  timeManager->formatTime(s.time, sizeof(s.time));
+  s.wifiConnected = (WiFi.status() == WL_CONNECTED);
+  s.rssi = 0;
+  if (s.wifiConnected) {
+    int rssi = WiFi.RSSI() - LIVE_RSSI_STEP_DB / 2;
+    s.rssi = (int8_t)((rssi / LIVE_RSSI_STEP_DB) * LIVE_RSSI_STEP_DB);
+  }
+  
+  // One feed per lid opening, whatever triggered it
+  if (servo && servo->getOpenedAt() != lastOpenedAt) {
+    lastOpenedAt = servo->getOpenedAt();
+    feedCount++;
+  }
+  s.feeds = feedCount;
+}
+
+void WebPortal::sendPage(AsyncWebServerRequest* request, const GzipPage& page) {
+  // Pages only change with the firmware: revalidate, answer unchanged with 304
+  if (request->hasHeader("If-None-Match") && request->header("If-None-Match") == page.etag) {
+    AsyncWebServerResponse* response = request->beginResponse(304);
+    response->addHeader("ETag", page.etag);
+    response->addHeader("Cache-Control", "no-cache");
+    request->send(response);
+    return;
+  }
+  
+  AsyncWebServerResponse* response = request->beginResponse_P(200, "text/html", page.data, page.length);
+  response->addHeader("Content-Encoding", "gzip");
+  response->addHeader("ETag", page.etag);
+  response->addHeader("Cache-Control", "no-cache");
+  request->send(response);
+}
+
+bool WebPortal::startAccessPoint(uint8_t channel) {
+  if (!apStarted) {
+    // Disable WiFi sleep for stable AP operation (like reference code)
+#if defined(ESP32)
+    WiFi.setSleep(false);
+#else
+    WiFi.setSleepMode(WIFI_NONE_SLEEP);
+#endif
+    
+    // Use AP_STA mode to allow scanning while AP is active
+    WiFi.mode(WIFI_AP_STA);
+    delay(100);
+    
+    WiFi.softAPConfig(AP_IP_ADDR, AP_GATEWAY, AP_SUBNET);
+  }
+  
+  // Called again while running: restarts the AP on the new channel
+  bool ok = WiFi.softAP(AP_SSID, AP_PASSWORD, channel, AP_HIDDEN, AP_MAX_CONNECTIONS);
   
   if (!ok) {
     LOG("WebPortal: AP start failed");
     return false;
   }
+  apChannel = channel;
   
-  // Start DNS server for captive portal
-  dnsServer = new DNSServer();
-  dnsServer->start(DNS_PORT, "*", AP_IP_ADDR);
+  if (!apStarted) {
+    // Start DNS server for captive portal
+    if (!dnsServer) dnsServer = new DNSServer();
+    dnsServer->start(DNS_PORT, "*", AP_IP_ADDR);
+    apStarted = true;
+  }
   
-  apStarted = true;
-  LOG("WebPortal: AP started - SSID=%s, IP=%s", AP_SSID, WiFi.softAPIP().toString().c_str());
+  LOG("WebPortal: AP started - SSID=%s, IP=%s, channel %u", AP_SSID, WiFi.softAPIP().toString().c_str(), channel);
   
   return true;
 }
 
-void WebPortal::handleRoot() {
+void WebPortal::stopAccessPoint() {
+  if (!apStarted) return;
+  
+  if (dnsServer) dnsServer->stop();
+  WiFi.softAPdisconnect(true);
+  WiFi.mode(WIFI_STA);
+  apStarted = false;
+  LOG("WebPortal: AP and DNS stopped");
+}
+
+void WebPortal::handleRoot(PortalRequest& req) {
   LOG("WebPortal: handleRoot called - Mode=%d, WiFiStatus=%d", 
       modeManager->getMode(), WiFi.status());
-      
+  
   if (!modeManager->isModeSelected()) {
     // Show mode selection page
     LOG("WebPortal: Showing mode selection page");
-    server->setContentLength(strlen_P(MODE_SELECTION_PAGE));
-    server->send_P(200, "text/html", MODE_SELECTION_PAGE);
+    req.sendPage(MODE_SELECTION_PAGE_GZ);
     return;
   }
   
@@ -141,38 +618,180 @@ void WebPortal::handleRoot() {
     bool hasCredentials = wifiManager && wifiManager->hasCredentials();
     if (!hasCredentials) {
       LOG("WebPortal: No saved credentials, forcing WiFi setup");
-      server->setContentLength(strlen_P(WIFI_SETUP_PAGE));
-      server->send_P(200, "text/html", WIFI_SETUP_PAGE);
+      req.sendPage(WIFI_SETUP_PAGE_GZ);
       return;
     }
     
     if (!wifiConnected) {
       // Online mode but not connected to WiFi - show WiFi setup
       LOG("WebPortal: Showing WiFi setup (not connected)");
-      server->setContentLength(strlen_P(WIFI_SETUP_PAGE));
-      server->send_P(200, "text/html", WIFI_SETUP_PAGE);
+      req.sendPage(WIFI_SETUP_PAGE_GZ);
     } else {
       // Online mode and WiFi connected - show online status
       LOG("WebPortal: Showing online status (connected to %s, IP=%s)", 
           WiFi.SSID().c_str(), WiFi.localIP().toString().c_str());
-      server->setContentLength(strlen_P(ONLINE_STATUS_PAGE));
-      server->send_P(200, "text/html", ONLINE_STATUS_PAGE);
+      JsonWriter state(req.stateBuffer(), req.stateBufferSize());
+      state.beginObject();
+      state.key("wifi");
+      writeWiFiStatus(state);
+      state.key("status");
+      writeStatus(state);
+      state.endObject();
+      req.sendPage(ONLINE_STATUS_PAGE_SPLICED, state);
     }
   } else {
     // Offline mode - show scheduler page
     LOG("WebPortal: Showing scheduler page (offline mode)");
-    server->setContentLength(strlen_P(SCHEDULER_PAGE));
-    server->send_P(200, "text/html", SCHEDULER_PAGE);
+    sendSchedulerPage(req);
   }
 }
 
-void WebPortal::handleSetMode() {
-  if (!server->hasArg("mode")) {
-    server->send(400, "text/plain", "Missing mode");
+void WebPortal::handleControl(PortalRequest& req) {
+  sendSchedulerPage(req);
+}
+
+void WebPortal::sendSchedulerPage(PortalRequest& req) {
+  // Config and status inlined: the page renders without further requests
+  JsonWriter state(req.stateBuffer(), req.stateBufferSize());
+  state.beginObject();
+  state.key("config");
+  writeConfig(state);
+  state.key("status");
+  writeStatus(state);
+  state.endObject();
+  req.sendPage(SCHEDULER_PAGE_SPLICED, state);
+}
+
+void WebPortal::handleDebug(PortalRequest& req) {
+  char ssid[33];
+  char ip[16];
+  char apIp[16];
+  WiFiManager::getStationSSID(ssid, sizeof(ssid));
+  formatIp(WiFi.localIP(), ip, sizeof(ip));
+  formatIp(WiFi.softAPIP(), apIp, sizeof(apIp));
+  
+  const char* mode = modeManager->isModeSelected()
+      ? (modeManager->getMode() == MODE_ONLINE ? "ONLINE" : "OFFLINE")
+      : "SEÇİLMEDİ";
+  
+  ResponseWriter html(req.buffer(), req.bufferSize());
+  html.raw("<!DOCTYPE html><html><head><meta charset='utf-8'/><title>Debug</title></head><body>");
+  html.raw("<h2>Debug Bilgileri</h2>");
+  html.rawf("<p><b>Mod:</b> %s</p>", mode);
+  html.rawf("<p><b>WiFi Status:</b> %d (3=WL_CONNECTED)</p>", (int)WiFi.status());
+  html.raw("<p><b>WiFi SSID:</b> ").html(ssid).raw("</p>");
+  html.rawf("<p><b>WiFi IP:</b> %s</p>", ip);
+  html.rawf("<p><b>AP IP:</b> %s</p>", apIp);
+  html.rawf("<p><b>Manager Connected:</b> %s</p>", wifiManager && wifiManager->connected() ? "YES" : "NO");
+  html.rawf("<p><b>Heap:</b> %lu free, %lu largest block</p>",
+            (unsigned long)ESP.getFreeHeap(), (unsigned long)largestFreeBlock());
+  html.rawf("<p><b>Portal:</b> %lu served, %lu rejected, %lu expired, max queue wait %lu ms</p>",
+            (unsigned long)servedCount, (unsigned long)rejectedCount,
+            (unsigned long)expiredCount, (unsigned long)maxQueueWaitMs);
+  html.rawf("<p><b>Live:</b> %u subscribers, %lu events, %lu held back, %lu refused</p>",
+            (unsigned)liveStatus.getSubscriberCount(), (unsigned long)liveStatus.getSentCount(),
+            (unsigned long)liveStatus.getDeferredCount(), (unsigned long)liveStatus.getRefusedCount());
+  html.raw("<p><a href='/'>Ana Sayfa</a> | <a href='/control'>Kontrol</a></p>");
+  html.raw("</body></html>");
+  req.send(200, "text/html", html);
+}
+
+void WebPortal::handleMetrics(PortalRequest& req) {
+  if (!profiler) {
+    req.send(404, "text/plain", "Profiler not available");
     return;
   }
   
-  String mode = server->arg("mode");
+  JsonWriter json(req.buffer(), req.bufferSize());
+  json.beginObject();
+  json.key("uptime_ms").number(millis());
+  json.key("window_ms").number(profiler->getSinceResetMs());
+  json.key("cpu_mhz").number(profiler->getCpuMhz());
+  
+  const LatencyHistogram& loopTime = profiler->getLoop();
+  json.key("loop").beginObject();
+  json.key("count").number(loopTime.getCount());
+  json.key("avg_us").number(loopTime.getAvgUs());
+  json.key("p50_us").number(loopTime.percentile(500));
+  json.key("p90_us").number(loopTime.percentile(900));
+  json.key("p99_us").number(loopTime.percentile(990));
+  json.key("p999_us").number(loopTime.percentile(999));
+  json.key("max_us").number(loopTime.getMaxUs());
+  json.endObject();
+  
+  // Sections that ran in this window; share is of the total loop time, in 0.1 %
+  json.key("sections").beginObject();
+  for (uint8_t i = 0; i < PROF_SECTION_COUNT; i++) {
+    const LatencyHistogram& section = profiler->getSection(i);
+    if (section.getCount() == 0) continue;
+    json.key(LoopProfiler::sectionName(i)).beginObject();
+    json.key("count").number(section.getCount());
+    json.key("share_pm").number(profiler->getSharePerMille(i));
+    json.key("avg_us").number(section.getAvgUs());
+    json.key("p99_us").number(section.percentile(990));
+    json.key("max_us").number(section.getMaxUs());
+    json.endObject();
+  }
+  json.endObject();
+  
+  json.key("stalls").beginObject();
+  json.key("threshold_us").number(PROFILE_STALL_US);
+  json.key("count").number(profiler->getStallCount());
+  if (profiler->getStallCount() > 0) {
+    const StallEvent& worst = profiler->getWorstStall();
+    json.key("worst").beginObject();
+    json.key("at_ms").number(worst.atMs);
+    json.key("loop_us").number(worst.loopUs);
+    json.key("culprit").value(LoopProfiler::sectionName(worst.culprit));
+    json.key("culprit_us").number(worst.culpritUs);
+    json.endObject();
+  }
+  // Most recent first, as many as fit in the response buffer
+  json.key("recent").beginArray();
+  for (uint8_t i = 0; i < profiler->getStallEventCount() && json.remaining() > 96; i++) {
+    const StallEvent& stall = profiler->getStallEvent(i);
+    json.beginObject();
+    json.key("at_ms").number(stall.atMs);
+    json.key("loop_us").number(stall.loopUs);
+    json.key("culprit").value(LoopProfiler::sectionName(stall.culprit));
+    json.key("culprit_us").number(stall.culpritUs);
+    json.endObject();
+  }
+  json.endArray();
+  json.endObject();
+  json.endObject();
+  
+  req.send(200, "application/json", json);
+  
+  // ?reset=1: next read covers only what happened after this one
+  if (req.hasArg("reset") && req.arg("reset") == "1") {
+    profiler->reset();
+  }
+}
+
+void WebPortal::handlePrometheus(PortalRequest& req) {
+  // Gauges that are cheaper to read at scrape time than to keep updated
+  bool up = wifiManager && wifiManager->connected();
+  metrics.set(MET_BUILD_INFO, 1);
+  metrics.set(MET_UPTIME_SECONDS, (int32_t)(millis() / 1000));
+  metrics.set(MET_HEAP_FREE_BYTES, (int32_t)ESP.getFreeHeap());
+#if defined(ESP32)
+  metrics.set(MET_HEAP_MIN_FREE_BYTES, (int32_t)ESP.getMinFreeHeap());
+#endif
+  metrics.set(MET_HEAP_LARGEST_BLOCK_BYTES, (int32_t)largestFreeBlock());
+  metrics.set(MET_WIFI_CONNECTED, up ? 1 : 0);
+  metrics.set(MET_WIFI_RSSI_DBM, up ? wifiManager->getRSSI() : 0);
+  
+  req.sendMetrics(metrics.getValues());
+}
+
+void WebPortal::handleSetMode(PortalRequest& req) {
+  if (!req.hasArg("mode")) {
+    req.send(400, "text/plain", "Missing mode");
+    return;
+  }
+  
+  String mode = req.arg("mode");
   mode.trim();
   
   OperationMode selectedMode;
@@ -181,165 +800,237 @@ void WebPortal::handleSetMode() {
   } else if (mode == "online") {
     selectedMode = MODE_ONLINE;
   } else {
-    server->send(400, "text/plain", "Invalid mode");
+    req.send(400, "text/plain", "Invalid mode");
     return;
   }
   
   if (modeManager->setMode(selectedMode)) {
-    server->send(200, "text/plain", "OK");
+    req.send(200, "text/plain", "OK");
   } else {
-    server->send(500, "text/plain", "Failed to set mode");
+    req.send(500, "text/plain", "Failed to set mode");
   }
 }
 
-void WebPortal::handleSetTime() {
-  if (!server->hasArg("epoch") || !server->hasArg("tz")) {
-    server->send(400, "text/plain", "Missing params");
+void WebPortal::handleSetTime(PortalRequest& req) {
+  if (!req.hasArg("epoch") || !req.hasArg("tz")) {
+    req.send(400, "text/plain", "Missing params");
     return;
   }
   
-  uint32_t epoch = server->arg("epoch").toInt();
-  int32_t tz = server->arg("tz").toInt();
+  uint32_t epoch = req.arg("epoch").toInt();
+  int32_t tz = req.arg("tz").toInt();
   
   timeManager->setTime(epoch, tz);
-  server->send(200, "text/plain", "OK");
+  req.send(200, "text/plain", "OK");
 }
 
-void WebPortal::handleSetFeedTimes() {
-  String timesStr = server->hasArg("times") ? server->arg("times") : "";
-  String excludeStr = server->hasArg("exclude") ? server->arg("exclude") : "";
+void WebPortal::handleSetFeedTimes(PortalRequest& req) {
+  String timesStr = req.hasArg("times") ? req.arg("times") : "";
+  String excludeStr = req.hasArg("exclude") ? req.arg("exclude") : "";
+  
+  ScheduleConfig next = scheduler->getConfig();
   
   // Parse feed times
-  FeedTime times[MAX_FEED_TIMES];
-  uint8_t count = 0;
+  if (!parseFeedTimes(timesStr, next.times, &next.timesCount)) {
+    req.send(400, "text/plain", "Invalid times format");
+    return;
+  }
+  
+  // Parse excluded days
+  if (!parseExcludedDays(excludeStr, &next.excludeDaysBitmap)) {
+    req.send(400, "text/plain", "Invalid excluded days");
+    return;
+  }
+  
+  // Update scheduler (times and days in one NVS write)
+  scheduler->applyConfig(next);
+  
+  req.send(200, "text/plain", "OK");
+}
+
+void WebPortal::handleSetConfig(PortalRequest& req) {
+  if (!req.hasArg("times") || !req.hasArg("exclude") || !req.hasArg("angle") || !req.hasArg("hold")) {
+    req.send(400, "text/plain", "Missing params");
+    return;
+  }
   
-  if (timesStr.length() > 0) {
-    if (!parseFeedTimes(timesStr, times, &count)) {
-      server->send(400, "text/plain", "Invalid times format");
+  // Validate the whole document before anything is applied
+  ScheduleConfig next = scheduler->getConfig();
+  uint32_t angle = 0;
+  uint32_t hold = 0;
+  
+  if (!parseFeedTimes(req.arg("times"), next.times, &next.timesCount)) {
+    req.send(400, "text/plain", "Invalid times");
+    return;
+  }
+  if (!parseExcludedDays(req.arg("exclude"), &next.excludeDaysBitmap)) {
+    req.send(400, "text/plain", "Invalid exclude");
+    return;
+  }
+  if (!parseUInt(req.arg("angle"), 0, 180, &angle)) {
+    req.send(400, "text/plain", "Invalid angle");
+    return;
+  }
+  if (!parseUInt(req.arg("hold"), 1, 60, &hold)) {
+    req.send(400, "text/plain", "Invalid hold");
+    return;
+  }
+  
+  // Edits made against an older version would silently undo someone else's
+  if (req.hasArg("version")) {
+    uint32_t expected = 0;
+    if (!parseUInt(req.arg("version"), 0, UINT32_MAX, &expected)) {
+      req.send(400, "text/plain", "Invalid version");
+      return;
+    }
+    if (expected != scheduler->getConfigVersion()) {
+      JsonWriter json(req.buffer(), req.bufferSize());
+      json.beginObject();
+      json.key("error").value("Config changed");
+      json.key("version").number(scheduler->getConfigVersion());
+      json.endObject();
+      req.send(409, "application/json", json);
       return;
     }
   }
   
-  // Parse excluded days
-  uint8_t excludeBitmap = parseExcludedDays(excludeStr);
-  
-  // Update scheduler
-  scheduler->setFeedTimes(times, count);
-  scheduler->setExcludedDays(excludeBitmap);
+  next.servoAngle = (uint16_t)angle;
+  next.openHoldMs = hold * 1000;
+  uint32_t version = scheduler->applyConfig(next);
   
-  server->send(200, "text/plain", "OK");
+  JsonWriter json(req.buffer(), req.bufferSize());
+  json.beginObject();
+  json.key("version").number(version);
+  json.endObject();
+  req.send(200, "application/json", json);
 }
 
-void WebPortal::handleSetServoAngle() {
-  if (!server->hasArg("angle")) {
-    server->send(400, "text/plain", "Missing angle");
+void WebPortal::handleSetServoAngle(PortalRequest& req) {
+  if (!req.hasArg("angle")) {
+    req.send(400, "text/plain", "Missing angle");
     return;
   }
   
-  int angle = server->arg("angle").toInt();
+  int angle = req.arg("angle").toInt();
   if (angle < 0) angle = 0;
   if (angle > 180) angle = 180;
   
   scheduler->setServoAngle((uint16_t)angle);
-  server->send(200, "text/plain", "OK");
+  req.send(200, "text/plain", "OK");
 }
 
-void WebPortal::handleSetHoldDuration() {
-  if (!server->hasArg("hold")) {
-    server->send(400, "text/plain", "Missing hold");
+void WebPortal::handleSetHoldDuration(PortalRequest& req) {
+  if (!req.hasArg("hold")) {
+    req.send(400, "text/plain", "Missing hold");
     return;
   }
   
-  int hold = server->arg("hold").toInt();
+  int hold = req.arg("hold").toInt();
   if (hold < 1) hold = 1;
   if (hold > 60) hold = 60;
   
   scheduler->setOpenHoldDuration((uint32_t)hold * 1000);
-  server->send(200, "text/plain", "OK");
+  req.send(200, "text/plain", "OK");
 }
 
-void WebPortal::handleTestFeed() {
-  scheduler->triggerManualFeed();
-  server->send(200, "text/plain", "OK");
+void WebPortal::handleTestFeed(PortalRequest& req) {
+  metrics.inc(scheduler->triggerManualFeed() ? MET_FEEDS_MANUAL : MET_FEEDS_MISSED_MANUAL);
+  req.send(200, "text/plain", "OK");
 }
 
-void WebPortal::handleGetStatus() {
-  String json = "{";
+void WebPortal::handleGetStatus(PortalRequest& req) {
+  JsonWriter json(req.buffer(), req.bufferSize());
+  writeStatus(json);
+  req.send(200, "application/json", json);
+}
+
+void WebPortal::writeStatus(JsonWriter& json) {
+  json.beginObject();
   
   if (timeManager->isSet()) {
-    json += "\"time\":\"" + timeManager->getTimeString() + "\"";
+    char timeStr[16];
+    timeManager->formatTime(timeStr, sizeof(timeStr));
+    json.key("time").value(timeStr);
   } else {
-    json += "\"time\":null";
+    json.key("time").null();
   }
   
   // Add MAC address
-  json += ",\"mac\":\"" + WiFi.macAddress() + "\"";
+  uint8_t mac[6];
+  char macStr[18];
+  WiFi.macAddress(mac);
+  snprintf(macStr, sizeof(macStr), "%02X:%02X:%02X:%02X:%02X:%02X",
+           mac[0], mac[1], mac[2], mac[3], mac[4], mac[5]);
+  json.key("mac").value(macStr);
   
   // Add WiFi info if in online mode
   if (modeManager->getMode() == MODE_ONLINE) {
-    json += ",\"wifi_connected\":" + String(WiFi.status() == WL_CONNECTED ? "true" : "false");
-    if (WiFi.status() == WL_CONNECTED) {
-      json += ",\"wifi_ip\":\"" + WiFi.localIP().toString() + "\"";
-      json += ",\"wifi_ssid\":\"" + WiFi.SSID() + "\"";
+    bool wifiConnected = (WiFi.status() == WL_CONNECTED);
+    json.key("wifi_connected").boolean(wifiConnected);
+    if (wifiConnected) {
+      char ip[16];
+      char ssid[33];
+      formatIp(WiFi.localIP(), ip, sizeof(ip));
+      WiFiManager::getStationSSID(ssid, sizeof(ssid));
+      json.key("wifi_ip").value(ip);
+      json.key("wifi_ssid").value(ssid);
     }
   }
   
-  json += "}";
+  // Heap health (fragmentation shows as largest block falling behind free)
+  json.key("heap").beginObject();
+  json.key("free").number(ESP.getFreeHeap());
+  json.key("maxBlock").number(largestFreeBlock());
+#if defined(ESP32)
+  json.key("min").number(ESP.getMinFreeHeap());
+#endif
+  json.endObject();
   
-  server->send(200, "application/json", json);
+  json.endObject();
 }
 
-void WebPortal::handleGetConfig() {
+void WebPortal::handleGetConfig(PortalRequest& req) {
+  JsonWriter json(req.buffer(), req.bufferSize());
+  writeConfig(json);
+  req.send(200, "application/json", json);
+}
+
+void WebPortal::writeConfig(JsonWriter& json) {
   const ScheduleConfig& cfg = scheduler->getConfig();
   
-  String json = "{";
-  
   // Feed times
-  json += "\"times\":\"";
+  char times[MAX_FEED_TIMES * 6 + 1];
+  ResponseWriter timesOut(times, sizeof(times));
   for (uint8_t i = 0; i < cfg.timesCount; i++) {
-    char buf[6];
-    snprintf(buf, sizeof(buf), "%02u:%02u", cfg.times[i].hour, cfg.times[i].minute);
-    json += buf;
-    if (i + 1 < cfg.timesCount) json += ",";
+    timesOut.rawf("%s%02u:%02u", i > 0 ? "," : "", cfg.times[i].hour, cfg.times[i].minute);
   }
-  json += "\",";
   
   // Excluded days
-  json += "\"exclude\":\"";
-  bool first = true;
+  char exclude[16];
+  ResponseWriter excludeOut(exclude, sizeof(exclude));
   for (uint8_t d = 0; d < 7; d++) {
     if ((cfg.excludeDaysBitmap >> d) & 0x01) {
-      if (!first) json += ",";
-      json += String(d);
-      first = false;
+      excludeOut.rawf("%s%u", excludeOut.length() > 0 ? "," : "", d);
     }
   }
-  json += "\",";
   
-  // Servo angle
-  json += "\"angle\":" + String(cfg.servoAngle) + ",";
-  
-  // Hold duration (in seconds)
-  json += "\"hold\":" + String(cfg.openHoldMs / 1000);
-  
-  json += "}";
-  
-  server->send(200, "application/json", json);
-}
-
-void WebPortal::handleNotFound() {
-  // Redirect to root for captive portal
-  server->sendHeader("Location", "/", true);
-  server->send(302, "text/plain", "");
+  json.beginObject();
+  json.key("times").value(times);
+  json.key("exclude").value(exclude);
+  json.key("angle").number(cfg.servoAngle);
+  json.key("hold").number(cfg.openHoldMs / 1000);  // Hold duration (in seconds)
+  json.key("version").number(scheduler->getConfigVersion());
+  json.endObject();
 }
 
 bool WebPortal::parseFeedTimes(const String& timesStr, FeedTime* times, uint8_t* count) {
   *count = 0;
+  bool valid = true;
   
   int start = 0;
   int end = timesStr.indexOf(',');
   
-  while (start < (int)timesStr.length() && *count < MAX_FEED_TIMES) {
+  while (start < (int)timesStr.length()) {
     String timeStr;
     if (end == -1) {
       timeStr = timesStr.substring(start);
@@ -348,17 +1039,19 @@ bool WebPortal::parseFeedTimes(const String& timesStr, FeedTime* times, uint8_t*
     }
     
     timeStr.trim();
-    if (timeStr.length() >= 5) { // "HH:MM"
+    if (timeStr.length() > 0) {
+      // "HH:MM"; a malformed entry or one too many fails the whole list
       int colonPos = timeStr.indexOf(':');
-      if (colonPos > 0) {
-        int hour = timeStr.substring(0, colonPos).toInt();
-        int minute = timeStr.substring(colonPos + 1).toInt();
-        
-        if (hour >= 0 && hour < 24 && minute >= 0 && minute < 60) {
-          times[*count].hour = (uint8_t)hour;
-          times[*count].minute = (uint8_t)minute;
-          (*count)++;
-        }
+      uint32_t hour = 0;
+      uint32_t minute = 0;
+      if (colonPos > 0 && *count < MAX_FEED_TIMES &&
+          parseUInt(timeStr.substring(0, colonPos), 0, 23, &hour) &&
+          parseUInt(timeStr.substring(colonPos + 1), 0, 59, &minute)) {
+        times[*count].hour = (uint8_t)hour;
+        times[*count].minute = (uint8_t)minute;
+        (*count)++;
+      } else {
+        valid = false;
       }
     }
     
@@ -367,11 +1060,12 @@ bool WebPortal::parseFeedTimes(const String& timesStr, FeedTime* times, uint8_t*
     end = timesStr.indexOf(',', start);
   }
   
-  return true;
+  return valid;
 }
 
-uint8_t WebPortal::parseExcludedDays(const String& excludeStr) {
-  uint8_t bitmap = 0;
+bool WebPortal::parseExcludedDays(const String& excludeStr, uint8_t* bitmap) {
+  *bitmap = 0;
+  bool valid = true;
   
   int start = 0;
   int end = excludeStr.indexOf(',');
@@ -386,9 +1080,11 @@ uint8_t WebPortal::parseExcludedDays(const String& excludeStr) {
     
     dayStr.trim();
     if (dayStr.length() > 0) {
-      int day = dayStr.toInt();
-      if (day >= 0 && day < 7) {
-        bitmap |= (1 << day);
+      uint32_t day = 0;
+      if (parseUInt(dayStr, 0, 6, &day)) {
+        *bitmap |= (1 << day);
+      } else {
+        valid = false;
       }
     }
     
@@ -397,13 +1093,28 @@ uint8_t WebPortal::parseExcludedDays(const String& excludeStr) {
     end = excludeStr.indexOf(',', start);
   }
   
-  return bitmap;
+  return valid;
 }
 
-void WebPortal::handleChangeMode() {
+bool WebPortal::parseUInt(const String& str, uint32_t minValue, uint32_t maxValue, uint32_t* value) {
+  if (str.length() == 0 || str.length() > 10) return false;
+  
+  uint64_t n = 0;
+  for (size_t i = 0; i < str.length(); i++) {
+    char c = str[i];
+    if (c < '0' || c > '9') return false;
+    n = n * 10 + (c - '0');
+  }
+  if (n < minValue || n > maxValue) return false;
+  
+  *value = (uint32_t)n;
+  return true;
+}
+
+void WebPortal::handleChangeMode(PortalRequest& req) {
   // Check if specific mode is requested
-  if (server->hasArg("mode")) {
-    String mode = server->arg("mode");
+  if (req.hasArg("mode")) {
+    String mode = req.arg("mode");
     mode.trim();
     
     OperationMode targetMode;
@@ -412,179 +1123,165 @@ void WebPortal::handleChangeMode() {
     } else if (mode == "online") {
       targetMode = MODE_ONLINE;
     } else {
-      server->send(400, "text/plain", "Invalid mode");
+      req.send(400, "text/plain", "Invalid mode");
       return;
     }
     
     LOG("WebPortal: Changing to %s mode", mode.c_str());
     
+    // Modules are switched over from loop(), no reboot
     if (modeManager->setMode(targetMode)) {
-      server->send(200, "text/plain", "OK");
-      
-      // Give time for response to be sent
-      delay(100);
-      
-      LOG("WebPortal: Mode changed, rebooting...");
-      delay(500);
-      ESP.restart();
+      req.send(200, "text/plain", "OK");
     } else {
-      server->send(500, "text/plain", "Failed to set mode");
+      req.send(500, "text/plain", "Failed to set mode");
     }
   } else {
     // No mode specified - reset to mode selection
     LOG("WebPortal: Mode reset requested via web");
     
-    server->send(200, "text/plain", "OK");
-    
-    // Give time for response to be sent
-    delay(100);
-    
     // Only reset mode selection, keep schedule and time
     modeManager->reset();
     
-    LOG("WebPortal: Mode reset, schedule and time preserved, rebooting...");
-    delay(500);
+    req.send(200, "text/plain", "OK");
     
-    ESP.restart();
+    LOG("WebPortal: Mode reset, schedule and time preserved");
   }
 }
 
-void WebPortal::handleFactoryReset() {
+void WebPortal::handleFactoryReset(PortalRequest& req) {
   LOG("WebPortal: Factory reset requested via web");
   
-  server->send(200, "text/plain", "OK");
-  
-  // Give time for response to be sent
-  delay(100);
-  
-  // Clear all NVS data
+  // Clear all NVS data, and what the modules hold in memory
   modeManager->reset();
   timeManager->clearTime();
   scheduler->clearSchedule();
+  if (provisioning) {
+    provisioning->reset();
+  }
+  if (wifiManager) {
+    wifiManager->clearCredentials();
+  }
   
-  LOG("WebPortal: All data cleared, rebooting...");
-  delay(500);
+  req.send(200, "text/plain", "OK");
   
-  ESP.restart();
+  LOG("WebPortal: All data cleared, back to mode selection");
 }
 
-void WebPortal::handleWiFiScan() {
+void WebPortal::handleWiFiScan(PortalRequest& req) {
   LOG("WebPortal: WiFi scan requested");
   
   if (!wifiManager) {
     LOG("WebPortal: WiFi manager not available");
-    server->send(200, "application/json", "{\"success\":false,\"error\":\"WiFi yöneticisi hazır değil\"}");
+    req.send(200, "application/json", "{\"success\":false,\"error\":\"WiFi yöneticisi hazır değil\"}");
     return;
   }
   
-  String networksJson;
-  String errorMessage;
-  bool ok = wifiManager->scanNetworks(networksJson, errorMessage);
-  if (ok) {
-    LOG("WebPortal: Scan complete, returning %d bytes", networksJson.length());
-    String payload = "{\"success\":true,\"networks\":" + networksJson + "}";
-    server->send(200, "application/json", payload);
+  // Scan runs in the background: answer with what is cached, the page
+  // polls again while "scanning" is set. Starting first keeps a failure
+  // visible for one answer instead of retrying straight away.
+  wifiManager->startScan(req.hasArg("refresh"));
+  wifiManager->pollScan();
+  
+  JsonWriter json(req.buffer(), req.bufferSize());
+  json.beginObject();
+  
+  const char* error = wifiManager->getScanError();
+  if (error) {
+    LOG("WebPortal: Scan failed: %s", error);
+    json.key("success").boolean(false);
+    json.key("error").value(error);
   } else {
-    LOG("WebPortal: Scan failed: %s", errorMessage.c_str());
-    String payload = "{\"success\":false,\"error\":\"" + errorMessage + "\"}";
-    server->send(200, "application/json", payload);
+    json.key("success").boolean(true);
+    json.key("scanning").boolean(wifiManager->isScanning());
+    json.key("age").number(wifiManager->getScanAge());
+    json.key("networks");
+    wifiManager->writeScanResults(json);
   }
+  
+  json.endObject();
+  req.send(200, "application/json", json);
 }
 
-void WebPortal::handleWiFiConnect() {
+void WebPortal::handleWiFiConnect(PortalRequest& req) {
   if (!wifiManager) {
-    server->send(500, "text/plain", "WiFi manager not available");
+    req.send(500, "text/plain", "WiFi manager not available");
     return;
   }
   
-  if (!server->hasArg("ssid") || !server->hasArg("pass")) {
-    server->send(400, "text/plain", "Missing parameters");
+  if (!req.hasArg("ssid") || !req.hasArg("pass")) {
+    req.send(400, "text/plain", "Missing parameters");
     return;
   }
   
-  String ssid = server->arg("ssid");
-  String pass = server->arg("pass");
+  String ssid = req.arg("ssid");
+  String pass = req.arg("pass");
   
   LOG("WebPortal: WiFi connect request - SSID=%s, Pass length=%d", ssid.c_str(), pass.length());
   
   // Validate inputs
   if (ssid.length() == 0) {
     LOG("WebPortal: Empty SSID provided");
-    server->send(400, "text/plain", "SSID boş olamaz");
+    req.send(400, "text/plain", "SSID boş olamaz");
     return;
   }
   
-  if (wifiManager->connect(ssid, pass, 20000)) {
-    LOG("WebPortal: Connection successful");
-    server->send(200, "text/plain", "OK");
-  } else {
-    LOG("WebPortal: Connection failed");
-    // Get WiFi status to provide better error message
-    int status = WiFi.status();
-    String errorMsg = "Bağlantı başarısız";
-    
-    switch(status) {
-      case WL_NO_SSID_AVAIL:
-        errorMsg = "Ağ bulunamadı - SSID yanlış veya sinyal zayıf";
-        break;
-      case WL_CONNECT_FAILED:
-        errorMsg = "Şifre yanlış veya kimlik doğrulama hatası";
-        break;
-      case WL_DISCONNECTED:
-        errorMsg = "Bağlantı zaman aşımı - Sinyal çok zayıf";
-        break;
-      default:
-        errorMsg = "Bağlantı hatası (kod: " + String(status) + ")";
-        break;
-    }
-    
-    server->send(500, "text/plain", errorMsg);
-  }
+  // Connecting takes seconds; the page polls /api/wifi-status/ for the outcome
+  wifiManager->connect(ssid, pass);
+  req.send(200, "text/plain", "OK");
 }
 
-void WebPortal::handleWiFiStatus() {
-  if (!wifiManager) {
-    server->send(200, "application/json", "{\"connected\":false}");
-    return;
+void WebPortal::handleWiFiStatus(PortalRequest& req) {
+  JsonWriter json(req.buffer(), req.bufferSize());
+  writeWiFiStatus(json);
+  req.send(200, "application/json", json);
+}
+
+void WebPortal::writeWiFiStatus(JsonWriter& json) {
+  json.beginObject();
+  json.key("connected").boolean(wifiManager && wifiManager->connected());
+  json.key("connecting").boolean(wifiManager && wifiManager->isConnecting());
+  if (wifiManager && wifiManager->getConnectError()) {
+    json.key("error").value(wifiManager->getConnectError());
   }
   
-  String json = "{\"connected\":";
-  json += wifiManager->connected() ? "true" : "false";
-  
-  if (wifiManager->connected()) {
-    json += ",\"ssid\":\"" + wifiManager->getSSID() + "\"";
-    json += ",\"ip\":\"" + wifiManager->getLocalIP() + "\"";
-    json += ",\"rssi\":" + String(wifiManager->getRSSI());
+  if (wifiManager && wifiManager->connected()) {
+    // Same fallback as WiFiManager::getLocalIP()
+    char ip[16] = "0.0.0.0";
+    if (WiFi.status() == WL_CONNECTED && WiFi.localIP()[0] != 0) {
+      formatIp(WiFi.localIP(), ip, sizeof(ip));
+    }
+    json.key("ssid").value(wifiManager->getSSID().c_str());
+    json.key("ip").value(ip);
+    json.key("rssi").number(wifiManager->getRSSI());
   }
   
-  json += "}";
-  server->send(200, "application/json", json);
+  json.endObject();
 }
 
-void WebPortal::handleWiFiDisconnect() {
+void WebPortal::handleWiFiDisconnect(PortalRequest& req) {
   if (!wifiManager) {
-    server->send(500, "text/plain", "WiFi manager not available");
+    req.send(500, "text/plain", "WiFi manager not available");
     return;
   }
   
   LOG("WebPortal: WiFi disconnect requested");
   wifiManager->disconnect();
-  server->send(200, "text/plain", "OK");
+  req.send(200, "text/plain", "OK");
 }
 
-void WebPortal::handleWiFiReset() {
+void WebPortal::handleWiFiReset(PortalRequest& req) {
   if (!wifiManager) {
-    server->send(500, "text/plain", "WiFi manager not available");
+    req.send(500, "text/plain", "WiFi manager not available");
     return;
   }
   
   LOG("WebPortal: WiFi reset requested - clearing credentials and returning to setup");
   wifiManager->disconnect();
   wifiManager->clearCredentials();
-  server->send(200, "text/plain", "OK");
+  req.send(200, "text/plain", "OK");
 }
 
-void WebPortal::handleResetMode() {
+void WebPortal::handleResetMode(PortalRequest& req) {
   LOG("WebPortal: Mode reset requested - returning to mode selection");
   
   // Clear mode selection but keep other settings
@@ -598,20 +1295,18 @@ void WebPortal::handleResetMode() {
     wifiManager->clearCredentials();
   }
   
-  server->send(200, "text/plain", "OK");
+  req.send(200, "text/plain", "OK");
   
-  LOG("WebPortal: Mode reset complete, rebooting...");
-  delay(500);
-  ESP.restart();
+  LOG("WebPortal: Mode reset complete");
 }
 
-void WebPortal::handleSyncSchedule() {
+void WebPortal::handleSyncSchedule(PortalRequest& req) {
   LOG("WebPortal: Schedule sync requested");
   
   // This requires BackendClient to be available
   // We'll need to pass it to WebPortal or access it globally
   // For now, return a simple response
-  server->send(200, "text/plain", "Sync triggered - check serial monitor");
+  req.send(200, "text/plain", "Sync triggered - check serial monitor");
   
   // Note: Actual sync will be handled by BackendClient in main loop
   // This endpoint just triggers the sync request
@@ -6,16 +6,103 @@
 #include "TimeManager.h"
 #include "OfflineScheduler.h"
 #include "WiFiManager.h"
+#include "ServoController.h"
+#include "ResponseWriter.h"
+#include "StatusStream.h"
+#include "LoopProfiler.h"
+#include "ProvisionManager.h"
+#include "Metrics.h"
 
 #if defined(ESP8266)
-  #include <ESP8266WebServer.h>
+  #include <ESPAsyncTCP.h>
+  #include <ESPAsyncWebServer.h>
   #include <DNSServer.h>
-  using WebServer = ESP8266WebServer;
 #elif defined(ESP32)
-  #include <WebServer.h>
+  #include <AsyncTCP.h>
+  #include <ESPAsyncWebServer.h>
   #include <DNSServer.h>
+  #include <freertos/semphr.h>
 #endif
 
+struct GzipPage;
+struct SplicedPage;
+
+/**
+ * @brief API request handed to a WebPortal handler
+ * 
+ * Form arguments are copied out of the async server when the request is
+ * queued; the handler writes the response into the slot's fixed buffer,
+ * which is streamed to the client once it returns.
+ */
+class PortalRequest {
+public:
+  static const uint8_t MAX_ARGS = 6;   // /api/config takes 5; more is rejected (400)
+  
+  bool hasArg(const char* name) const;
+  String arg(const char* name) const;
+  
+  /**
+   * @brief Set the response (sent after the handler returns)
+   */
+  void send(int code, const char* contentType = "text/plain", const char* body = "");
+  void send(int code, const char* contentType, const String& body) { send(code, contentType, body.c_str()); }
+  
+  /**
+   * @brief Send what a writer over buffer() produced (500 if it overflowed)
+   */
+  void send(int code, const char* contentType, const ResponseWriter& writer);
+  
+  /**
+   * @brief Response buffer for a ResponseWriter / JsonWriter
+   */
+  char* buffer() { return body; }
+  size_t bufferSize() const { return sizeof(body); }
+  
+  /**
+   * @brief Respond with a gzip page (304 if the client's ETag matches)
+   */
+  void sendPage(const GzipPage& page);
+  
+  /**
+   * @brief Buffer for the state of a spliced page (leaves room for the gzip framing)
+   */
+  char* stateBuffer() { return body + SPLICE_HEADER_LEN; }
+  size_t stateBufferSize() const { return sizeof(body) - SPLICE_HEADER_LEN - SPLICE_TRAILER_LEN; }
+  
+  /**
+   * @brief Respond with a page whose state placeholder is replaced by what
+   *        a writer over stateBuffer() produced (500 if it overflowed)
+   */
+  void sendPage(const SplicedPage& page, const ResponseWriter& state);
+  
+  /**
+   * @brief Respond with the Prometheus text of a copy of the metric values
+   *        (rendered while it is sent, so it may exceed the buffer)
+   */
+  void sendMetrics(const MetricValues& values);
+  
+private:
+  friend class WebPortal;
+  
+  static const size_t SPLICE_HEADER_LEN = 5;   // Stored deflate block header
+  static const size_t SPLICE_TRAILER_LEN = 8;  // gzip CRC-32 + size
+  
+  String argNames[MAX_ARGS];
+  String argValues[MAX_ARGS];
+  uint8_t argCount;
+  String ifNoneMatch;
+  
+  int code;
+  const char* contentType;
+  alignas(8) char body[WEB_RESPONSE_MAX];  // Aligned for the MetricValues copy
+  size_t bodyLength;
+  const GzipPage* page;
+  const SplicedPage* spliced;  // body = stored block with the state, trailer after it
+  const MetricValues* metricValues;  // Points into body
+  
+  void reset();
+};
+
 /**
  * @brief Web portal for device configuration
  * 
@@ -24,51 +111,152 @@
  * - Time synchronization
  * - Schedule configuration
  * - Manual feed testing
+ * 
+ * Runs on the async web server: static pages are answered straight from the
+ * TCP task, API requests are queued (bounded, per-client limited) and their
+ * handlers run from handleClient() in loop(), so module state is only ever
+ * touched by the main task.
  */
 class WebPortal {
 private:
-  WebServer* server;
+  typedef void (WebPortal::*Handler)(PortalRequest& req);
+  
+  enum SlotState : uint8_t {
+    SLOT_FREE,
+    SLOT_QUEUED,
+    SLOT_RUNNING,
+    SLOT_SENDING   // Body streamed from the slot buffer until the client disconnects
+  };
+  
+  struct PendingRequest {
+    AsyncWebServerRequest* request;  // nullptr once the client has gone away
+    Handler handler;
+    PortalRequest req;
+    uint32_t clientIp;
+    unsigned long queuedAt;
+    SlotState state;
+  };
+  
+  AsyncWebServer* server;
   DNSServer* dnsServer;
   
   ModeManager* modeManager;
   TimeManager* timeManager;
   OfflineScheduler* scheduler;
   WiFiManager* wifiManager;
+  ServoController* servo;
+  LoopProfiler* profiler;
+  ProvisionManager* provisioning;
   
   bool apStarted;
+  uint8_t apChannel;
+  
+  // Live status pushed to open pages
+  StatusStream liveStatus;
+  unsigned long lastLiveSample;
+  uint32_t lastOpenedAt;
+  uint32_t feedCount;
   
-  // HTML Pages
-  static const char* getModeSelectionPage();
-  static const char* getSchedulerPage();
+  // API request queue, shared with the async TCP task
+  PendingRequest pending[WEB_MAX_PENDING];
+#if defined(ESP32)
+  SemaphoreHandle_t queueLock;
+#endif
+  
+  // Statistics
+  uint32_t servedCount;
+  uint32_t rejectedCount;
+  uint32_t expiredCount;
+  uint32_t maxQueueWaitMs;
   
   // Request Handlers
-  void handleRoot();
-  void handleSetMode();
-  void handleSetTime();
-  void handleSetFeedTimes();
-  void handleSetServoAngle();
-  void handleSetHoldDuration();
-  void handleTestFeed();
-  void handleGetStatus();
-  void handleGetConfig();
-  void handleChangeMode();
-  void handleFactoryReset();
-  void handleWiFiScan();
-  void handleWiFiConnect();
-  void handleWiFiStatus();
-  void handleWiFiReset();
-  void handleWiFiDisconnect();
-  void handleResetMode();
-  void handleSyncSchedule();
-  void handleNotFound();
+  void handleRoot(PortalRequest& req);
+  void handleControl(PortalRequest& req);
+  void handleDebug(PortalRequest& req);
+  void handleMetrics(PortalRequest& req);
+  void handlePrometheus(PortalRequest& req);
+  void handleSetMode(PortalRequest& req);
+  void handleSetTime(PortalRequest& req);
+  void handleSetFeedTimes(PortalRequest& req);
+  void handleSetConfig(PortalRequest& req);
+  void handleSetServoAngle(PortalRequest& req);
+  void handleSetHoldDuration(PortalRequest& req);
+  void handleTestFeed(PortalRequest& req);
+  void handleGetStatus(PortalRequest& req);
+  void handleGetConfig(PortalRequest& req);
+  void handleChangeMode(PortalRequest& req);
+  void handleFactoryReset(PortalRequest& req);
+  void handleWiFiScan(PortalRequest& req);
+  void handleWiFiConnect(PortalRequest& req);
+  void handleWiFiStatus(PortalRequest& req);
+  void handleWiFiReset(PortalRequest& req);
+  void handleWiFiDisconnect(PortalRequest& req);
+  void handleResetMode(PortalRequest& req);
+  void handleSyncSchedule(PortalRequest& req);
   
   // Helper functions
-  bool startAccessPoint();
   bool parseFeedTimes(const String& timesStr, FeedTime* times, uint8_t* count);
-  uint8_t parseExcludedDays(const String& excludeStr);
+  bool parseExcludedDays(const String& excludeStr, uint8_t* bitmap);
+  
+  /**
+   * @brief JSON bodies shared by the API handlers and the page state
+   */
+  void writeStatus(JsonWriter& json);
+  void writeConfig(JsonWriter& json);
+  void writeWiFiStatus(JsonWriter& json);
+  
+  /**
+   * @brief Scheduler page with its config and status inlined
+   */
+  void sendSchedulerPage(PortalRequest& req);
+  
+  /**
+   * @brief Parse a plain decimal number within [minValue, maxValue]
+   */
+  static bool parseUInt(const String& str, uint32_t minValue, uint32_t maxValue, uint32_t* value);
+  
+  /**
+   * @brief Collect the state shown by the live status stream
+   */
+  void sampleLiveState(LiveState& s);
+  
+  /**
+   * @brief Register a route whose handler runs from loop()
+   */
+  void onDeferred(const char* uri, WebRequestMethodComposite method, Handler handler);
+  
+  /**
+   * @brief Queue a request (async task); 429/503 when over the limits
+   */
+  void enqueue(AsyncWebServerRequest* request, Handler handler);
+  
+  /**
+   * @brief Forget a request whose client disconnected (async task)
+   */
+  void cancel(AsyncWebServerRequest* request);
+  
+  /**
+   * @brief Run queued handlers until the queue is empty or the budget is spent
+   */
+  void runPending();
+  
+  /**
+   * @brief Send a finished handler's response, free or hand over its slot (lock held)
+   */
+  void respond(PendingRequest& slot);
+  
+  void lockQueue();
+  void unlockQueue();
+  
+  /**
+   * @brief Send a gzip-compressed page with ETag (304 if the client has it)
+   */
+  static void sendPage(AsyncWebServerRequest* request, const GzipPage& page);
   
 public:
-  WebPortal(ModeManager* mm, TimeManager* tm, OfflineScheduler* sched, WiFiManager* wm = nullptr);
+  WebPortal(ModeManager* mm, TimeManager* tm, OfflineScheduler* sched, WiFiManager* wm = nullptr,
+            ServoController* servo = nullptr, LoopProfiler* profiler = nullptr,
+            ProvisionManager* provisioning = nullptr);
   ~WebPortal();
   
   /**
@@ -77,14 +265,31 @@ public:
   bool begin();
   
   /**
-   * @brief Handle client requests (call in loop)
+   * @brief Run queued API handlers, DNS and live status (call in loop)
    */
   void handleClient();
   
+  /**
+   * @brief Start the setup AP and captive DNS, or move a running AP to another channel
+   */
+  bool startAccessPoint(uint8_t channel);
+  
+  /**
+   * @brief Stop the setup AP and captive DNS (the server stays up on the station side)
+   */
+  void stopAccessPoint();
+  
   /**
    * @brief Check if AP is started
    */
   bool isAPStarted() const { return apStarted; }
+  uint8_t getAPChannel() const { return apChannel; }
+  
+  uint32_t getServedCount() const { return servedCount; }
+  uint32_t getRejectedCount() const { return rejectedCount; }
+  uint32_t getExpiredCount() const { return expiredCount; }
+  uint32_t getMaxQueueWaitMs() const { return maxQueueWaitMs; }
+  const StatusStream& getLiveStatus() const { return liveStatus; }
 };
 
 #endif // WEB_PORTAL_H
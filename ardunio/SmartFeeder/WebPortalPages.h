@@ -82,17 +82,23 @@ const msg=document.getElementById('msg');
 const c=document.getElementById('c');
 function pop(l){
   // Build options with exact SSID in value attribute; label shows RSSI
+  const cur=s.value;
   s.innerHTML='<option value="">-- Seç --</option>';
   l.forEach(i=>{
     const esc = (str)=>str.replace(/&/g,'&amp;').replace(/</g,'&lt;').replace(/>/g,'&gt;').replace(/"/g,'&quot;');
     s.innerHTML += '<option value="'+esc(i.ssid)+'">'+esc(i.ssid)+' ('+i.rssi+' dBm)</option>';
   });
+  if(cur)s.value=cur;
 }
-function scan(){
+// The device scans in the background: poll while it reports "scanning"
+let scanTimer=null;
+function scan(refresh,polls){
+  polls=polls||0;
+  clearTimeout(scanTimer);
   msg.innerText='Taranıyor...';
   msg.style.color='var(--accent)';
-  s.innerHTML='<option>Taranıyor...</option>';
-  fetch('/api/wifi-scan/')
+  if(!polls)s.innerHTML='<option>Taranıyor...</option>';
+  fetch('/api/wifi-scan/'+(refresh?'?refresh=1':''))
   .then(r=>{
     if(!r.ok)throw new Error('HTTP '+r.status);
     return r.json();
@@ -105,6 +111,11 @@ function scan(){
       return;
     }
     const list = Array.isArray(data.networks)?data.networks:[];
+    if(data.scanning&&polls<20){
+      if(list.length>0)pop(list);
+      scanTimer=setTimeout(()=>scan(false,polls+1),1000);
+      return;
+    }
     if(list.length===0){
       s.innerHTML='<option>Ağ bulunamadı</option>';
       msg.innerText='⚠️ Hiç ağ bulunamadı. Modem yakın mı? 2.4 GHz açık mı?';
@@ -122,7 +133,7 @@ function scan(){
     console.error('Scan error:',e);
   });
 }
-r.onclick=e=>{e.preventDefault();scan()};
+r.onclick=e=>{e.preventDefault();scan(true)};
 f.onsubmit=e=>{
   e.preventDefault();
   const sel = s.value || '';
@@ -133,13 +144,8 @@ f.onsubmit=e=>{
   msg.innerText='Bağlanıyor...';msg.style.color='var(--accent)';
   fetch('/api/wifi-connect/',{method:'POST',headers:{'Content-Type':'application/x-www-form-urlencoded'},body:'ssid='+encodeURIComponent(ss)+'&pass='+encodeURIComponent(pw)})
   .then(r=>r.text()).then(t=>{
-    if(t=='OK'){
-      msg.innerText='✅ Bağlandı! Sayfa otomatik yenilenecek veya yeşil butona basın.';
-      msg.style.color='var(--ok)';
-      c.innerHTML='<div class=ok>✓ Bağlantı başarılı - WiFi: '+ss+'</div>';
-      document.getElementById('manualNext').style.display='block';
-      setTimeout(()=>{window.location.href='/';},4000);
-    }else{
+    if(t=='OK'){waitConnect(ss,0);}
+    else{
       msg.innerText='❌ Hata: '+t;
       msg.style.color='#dc2626';
     }
@@ -148,6 +154,26 @@ f.onsubmit=e=>{
     msg.style.color='#dc2626';
   });
 };
+// The device connects in the background; follow it until it has an IP or gives up
+function waitConnect(ss,polls){
+  fetch('/api/wifi-status/').then(r=>r.json()).then(d=>{
+    if(d.connected&&d.ssid===ss){
+      msg.innerText='✅ Bağlandı! Sayfa otomatik yenilenecek veya yeşil butona basın.';
+      msg.style.color='var(--ok)';
+      c.innerHTML='<div class=ok>✓ Bağlantı başarılı - WiFi: '+ss+'</div>';
+      document.getElementById('manualNext').style.display='block';
+      setTimeout(()=>{window.location.href='/';},4000);
+    }else if(d.error){
+      msg.innerText='❌ Hata: '+d.error;
+      msg.style.color='#dc2626';
+    }else if(polls<40){
+      setTimeout(()=>waitConnect(ss,polls+1),1000);
+    }else{
+      msg.innerText='❌ Bağlantı zaman aşımı';
+      msg.style.color='#dc2626';
+    }
+  }).catch(()=>{if(polls<40)setTimeout(()=>waitConnect(ss,polls+1),1000);});
+}
 fetch('/api/wifi-status/').then(r=>r.json()).then(d=>{
   if(d.connected){
     c.innerHTML='<div class=ok>✓ Zaten bağlı: '+d.ssid+'</div>';
@@ -179,23 +205,41 @@ document.getElementById('disc').onclick=function(){
     msg.style.color='#dc2626';
   });
 };
-// Poll connection state and auto-transition when STA connects
-let pollCount=0;
-const pollInterval=setInterval(()=>{
-  pollCount++;
-  fetch('/api/wifi-status/').then(r=>r.json()).then(d=>{
-    if(d.connected){
-      clearInterval(pollInterval);
-      if(!document.getElementById('manualNext').style.display || document.getElementById('manualNext').style.display==='none'){
-        document.getElementById('manualNext').style.display='block';
-        msg.innerText='✅ WiFi bağlı! Yeşil butona basın veya bekleyin.';
-        msg.style.color='var(--ok)';
-        setTimeout(()=>{window.location.href='/';},2000);
+// Auto-transition when STA connects: pushed by the live status stream,
+// polling only if the stream is unavailable
+function onWifiConnected(){
+  if(!document.getElementById('manualNext').style.display || document.getElementById('manualNext').style.display==='none'){
+    document.getElementById('manualNext').style.display='block';
+    msg.innerText='✅ WiFi bağlı! Yeşil butona basın veya bekleyin.';
+    msg.style.color='var(--ok)';
+    setTimeout(()=>{window.location.href='/';},2000);
+  }
+}
+function pollWifi(){
+  let pollCount=0;
+  const pollInterval=setInterval(()=>{
+    pollCount++;
+    fetch('/api/wifi-status/').then(r=>r.json()).then(d=>{
+      if(d.connected){
+        clearInterval(pollInterval);
+        onWifiConnected();
       }
-    }
-  }).catch(()=>{});
-  if(pollCount>40){clearInterval(pollInterval);}
-},1500);
+    }).catch(()=>{});
+    if(pollCount>40){clearInterval(pollInterval);}
+  },1500);
+}
+if(window.EventSource){
+  let fails=0;
+  const es=new EventSource('/api/events');
+  es.addEventListener('status',e=>{
+    fails=0;
+    const d=JSON.parse(e.data);
+    if(d.wifi){es.close();onWifiConnected();}
+  });
+  es.onerror=()=>{if(++fails>=3){es.close();pollWifi();}};
+}else{
+  pollWifi();
+}
 function resetToModeSelection(){
 try{
 if(!confirm('Mod seçimine dönmek istediğinize emin misiniz?\n\nMod ve WiFi ayarları sıfırlanacak, zamanlayıcı korunacak.')){return}
@@ -204,9 +248,9 @@ msg.style.color='var(--warn)';
 fetch('/api/reset-mode/',{method:'POST'})
 .then(r=>r.text()).then(t=>{
 if(t=='OK'){
-msg.innerText='✅ Başarılı! Cihaz yeniden başlatılıyor...';
+msg.innerText='✅ Başarılı! Mod seçimine dönülüyor...';
 msg.style.color='var(--ok)';
-c.innerHTML='<div style="background:var(--warn);color:#fff;padding:12px;border-radius:8px;margin-top:12px;font-size:.9rem">⚠️ Cihaz yeniden başlıyor. Lütfen 10 saniye bekleyin, sonra <strong>192.168.4.1</strong> adresine tekrar girin.</div>';
+setTimeout(()=>{window.location.href='/';},1000);
 }else{msg.innerText='❌ Hata: '+t;msg.style.color='#dc2626'}
 })
 .catch(e=>{msg.innerText='❌ Bağlantı hatası: '+e.message;msg.style.color='#dc2626';console.error(e);});
@@ -219,9 +263,9 @@ msg.style.color='var(--warn)';
 fetch('/api/change-mode/',{method:'POST',headers:{'Content-Type':'application/x-www-form-urlencoded'},body:'mode=offline'})
 .then(r=>r.text()).then(t=>{
 if(t=='OK'){
-msg.innerText='✅ Başarılı! Cihaz yeniden başlatılıyor...';
+msg.innerText='✅ Offline moda geçildi. Bağlantı koparsa Feeder_AP ağına bağlanın.';
 msg.style.color='var(--ok)';
-c.innerHTML='<div style="background:var(--warn);color:#fff;padding:12px;border-radius:8px;margin-top:12px;font-size:.9rem">⚠️ Cihaz yeniden başlıyor. Lütfen 10 saniye bekleyin, sonra <strong>192.168.4.1</strong> adresine tekrar girin.</div>';
+setTimeout(()=>{window.location.href='/';},1500);
 }else{msg.innerText='❌ Hata: '+t;msg.style.color='#dc2626'}
 })
 .catch(()=>{msg.innerText='❌ Bağlantı hatası';msg.style.color='#dc2626'});
@@ -261,8 +305,9 @@ Besleme zamanları backend sunucudan otomatik alınıyor. İsterseniz aşağıda
 <div id='msg'></div>
 </div>
 <script>
-function updateStatus(){
-  fetch('/api/wifi-status/').then(r=>r.json()).then(d=>{
+// Initial state inserted by the device (null if served without it)
+const STATE=/*STATE*/null;
+function showWifi(d){
     if(d.connected){
       ssid.innerText=d.ssid||'Bilinmiyor';
       const ipAddr=d.ip||'0.0.0.0';
@@ -279,14 +324,17 @@ function updateStatus(){
       ip.innerText='Yok';
       backend.innerHTML='<span style="color:#dc2626">WiFi bağlı değil</span>';
     }
-  }).catch(()=>{
+}
+function showStatus(d){
+  if(d.mac){mac.innerText=d.mac;}
+}
+function updateStatus(){
+  fetch('/api/wifi-status/').then(r=>r.json()).then(showWifi).catch(()=>{
     ssid.innerText='API hatası';
     ip.innerText='Kontrol edilemiyor';
   });
   // Get MAC address
-  fetch('/api/get-status/').then(r=>r.json()).then(d=>{
-    if(d.mac){mac.innerText=d.mac;}
-  }).catch(()=>{});
+  fetch('/api/get-status/').then(r=>r.json()).then(showStatus).catch(()=>{});
 }
 function checkBackend(deviceIP){
   backend.innerText='Kontrol ediliyor...';
@@ -297,8 +345,21 @@ function checkBackend(deviceIP){
     backend.style.color='var(--ok)';
   },1000);
 }
-updateStatus();
-setInterval(updateStatus,5000);
+if(STATE){showWifi(STATE.wifi);showStatus(STATE.status);}else{updateStatus();}
+// Refresh when the live status stream reports a WiFi change; poll without it
+function pollStatus(){setInterval(updateStatus,5000);}
+if(window.EventSource){
+  let fails=0;
+  const es=new EventSource('/api/events');
+  es.addEventListener('status',e=>{
+    fails=0;
+    const d=JSON.parse(e.data);
+    if('wifi' in d||'rssi' in d){updateStatus();}
+  });
+  es.onerror=()=>{if(++fails>=3){es.close();pollStatus();}};
+}else{
+  pollStatus();
+}
 function syncSchedule(){
 msg.innerText='Takvim senkronize ediliyor...';
 msg.style.color='var(--accent)';
@@ -331,9 +392,9 @@ msg.style.color='var(--warn)';
 fetch('/api/reset-mode/',{method:'POST'})
 .then(r=>r.text()).then(t=>{
 if(t=='OK'){
-msg.innerText='✅ Başarılı! Cihaz yeniden başlatılıyor...';
+msg.innerText='✅ Mod seçimine dönüldü.';
 msg.style.color='var(--ok)';
-document.querySelector('.info').innerHTML='⚠️ Cihaz yeniden başlıyor. Lütfen 10 saniye bekleyin, sonra <strong>192.168.4.1</strong> adresine tekrar girin.';
+document.querySelector('.info').innerHTML='⚠️ WiFi bağlantısı kesildi. <strong>Feeder_AP</strong> ağına bağlanıp <strong>192.168.1.1</strong> adresini açın.';
 document.querySelector('.info').style.background='var(--warn)';
 }else{msg.innerText='❌ Hata: '+t;msg.style.color='#dc2626'}
 })
@@ -346,9 +407,9 @@ msg.style.color='var(--warn)';
 fetch('/api/change-mode/',{method:'POST',headers:{'Content-Type':'application/x-www-form-urlencoded'},body:'mode=offline'})
 .then(r=>r.text()).then(t=>{
 if(t=='OK'){
-msg.innerText='✅ Başarılı! Cihaz yeniden başlatılıyor...';
+msg.innerText='✅ Offline moda geçildi.';
 msg.style.color='var(--ok)';
-document.querySelector('.info').innerHTML='⚠️ Cihaz yeniden başlıyor. Lütfen 10 saniye bekleyin, sonra <strong>192.168.4.1</strong> adresine tekrar girin.';
+document.querySelector('.info').innerHTML='⚠️ WiFi bağlantısı kesildi. <strong>Feeder_AP</strong> ağına bağlanıp <strong>192.168.1.1</strong> adresini açın.';
 document.querySelector('.info').style.background='var(--warn)';
 }else{msg.innerText='❌ Hata: '+t;msg.style.color='#dc2626'}
 })
@@ -438,6 +499,7 @@ Open duration <input id='hold' type='number' min='1' max='60' value='3' style='w
 </div>
 <div id='msg'></div>
 <script>(function(){
+const STATE=/*STATE*/null;
 function updateAngleLabel(){const el=document.getElementById('angle');const label=document.getElementById('angleLabel');if(!el||!label)return;const v=el.value||90;label.textContent=v+'°';}
 const times=[];const timesEl=document.getElementById('times');
 function render(){timesEl.innerHTML='';times.forEach((t,i)=>{const s=document.createElement('span');s.className='pill';s.textContent=t+' ';const x=document.createElement('button');x.textContent='x';x.onclick=()=>{times.splice(i,1);render();};s.appendChild(x);timesEl.appendChild(s);});}
@@ -445,19 +507,23 @@ document.getElementById('addTime').onclick=function(){const v=document.getElemen
 function postForm(url,data){return fetch(url,{method:'POST',headers:{'Content-Type':'application/x-www-form-urlencoded'},body:new URLSearchParams(data)}).then(r=>r.text());}
 function updateBrowserTime(){const now=new Date();document.getElementById('browserTime').textContent=now.toLocaleString('en-GB',{weekday:'short',hour:'2-digit',minute:'2-digit',second:'2-digit',day:'2-digit',month:'short',year:'numeric'});}
 function syncTime(){const now=Math.floor(Date.now()/1000);const tz=new Date().getTimezoneOffset();document.getElementById('msg').textContent='Syncing time...';document.getElementById('msg').style.color='var(--muted)';postForm('/api/set-time/',{epoch:now,tz:tz}).then(()=>{document.getElementById('msg').textContent='Time synced!';document.getElementById('msg').style.color='var(--success)';setTimeout(()=>document.getElementById('msg').textContent='',3000);updateStatus();}).catch(()=>{document.getElementById('msg').style.color='#900';document.getElementById('msg').textContent='Sync failed';});}
-function updateStatus(){fetch('/api/get-status/').then(r=>r.json()).then(data=>{if(data.time){document.getElementById('deviceTime').textContent=data.time;}else{document.getElementById('deviceTime').textContent='Not set - Click Sync';}}).catch(()=>{document.getElementById('deviceTime').textContent='Error';});}
-function applyConfig(cfg){if(cfg.times){times.length=0;cfg.times.split(',').forEach(t=>{t=t.trim();if(t)times.push(t);});times.sort();render();}if(typeof cfg.angle!=='undefined'){document.getElementById('angle').value=cfg.angle;updateAngleLabel();}if(typeof cfg.hold!=='undefined'){document.getElementById('hold').value=cfg.hold;}if(cfg.exclude){const set=new Set(cfg.exclude.split(',').filter(x=>x!==''));document.querySelectorAll('.wd').forEach(cb=>{cb.checked=set.has(cb.value);});}}
+function showStatus(data){if(data.time){document.getElementById('deviceTime').textContent=data.time;}else{document.getElementById('deviceTime').textContent='Not set - Click Sync';}}
+function updateStatus(){fetch('/api/get-status/').then(r=>r.json()).then(showStatus).catch(()=>{document.getElementById('deviceTime').textContent='Error';});}
+let configVersion=null;
+function applyConfig(cfg){if(typeof cfg.version!=='undefined'){configVersion=cfg.version;}if(cfg.times){times.length=0;cfg.times.split(',').forEach(t=>{t=t.trim();if(t)times.push(t);});times.sort();render();}if(typeof cfg.angle!=='undefined'){document.getElementById('angle').value=cfg.angle;updateAngleLabel();}if(typeof cfg.hold!=='undefined'){document.getElementById('hold').value=cfg.hold;}if(cfg.exclude){const set=new Set(cfg.exclude.split(',').filter(x=>x!==''));document.querySelectorAll('.wd').forEach(cb=>{cb.checked=set.has(cb.value);});}}
 function loadConfig(){fetch('/api/get-config/').then(r=>r.json()).then(applyConfig).catch(()=>{});}
-document.getElementById('save').onclick=function(){const exclude=[...document.querySelectorAll('.wd:checked')].map(x=>x.value).join(',');const angle=document.getElementById('angle').value||'90';const hold=document.getElementById('hold').value||'3';document.getElementById('msg').textContent='Saving...';document.getElementById('msg').style.color='var(--muted)';postForm('/api/set-feed-times/',{times:times.join(','),exclude:exclude}).then(()=>postForm('/api/set-servo-angle/',{angle:angle})).then(()=>postForm('/api/set-hold/',{hold:hold})).then(()=>{document.getElementById('msg').textContent='Saved!';document.getElementById('msg').style.color='var(--success)';setTimeout(()=>document.getElementById('msg').textContent='',3000);}).catch(()=>{document.getElementById('msg').style.color='#900';document.getElementById('msg').textContent='Error';});};
+function liveStatus(){const poll=()=>setInterval(updateStatus,1000);if(!window.EventSource){poll();return;}let fails=0;const es=new EventSource('/api/events');es.addEventListener('status',e=>{fails=0;const d=JSON.parse(e.data);if('time' in d){document.getElementById('deviceTime').textContent=d.time||'Not set - Click Sync';}});es.onerror=()=>{if(++fails>=3){es.close();poll();}};}
+document.getElementById('save').onclick=function(){const exclude=[...document.querySelectorAll('.wd:checked')].map(x=>x.value).join(',');const angle=document.getElementById('angle').value||'90';const hold=document.getElementById('hold').value||'3';const msg=document.getElementById('msg');msg.textContent='Saving...';msg.style.color='var(--muted)';const data={times:times.join(','),exclude:exclude,angle:angle,hold:hold};if(configVersion!==null)data.version=configVersion;fetch('/api/config',{method:'POST',headers:{'Content-Type':'application/x-www-form-urlencoded'},body:new URLSearchParams(data)}).then(r=>{if(r.status===409){loadConfig();throw new Error('Changed on device - reloaded, review and save again');}if(!r.ok)return r.text().then(t=>{throw new Error(t||'Error');});return r.json();}).then(res=>{configVersion=res.version;msg.textContent='Saved!';msg.style.color='var(--success)';setTimeout(()=>msg.textContent='',3000);}).catch(e=>{msg.style.color='#900';msg.textContent=e.message||'Error';});};
 document.getElementById('test').onclick=function(){document.getElementById('msg').textContent='Testing...';document.getElementById('msg').style.color='var(--muted)';postForm('/api/test-feed/',{}).then(()=>{document.getElementById('msg').textContent='Test triggered!';document.getElementById('msg').style.color='var(--success)';setTimeout(()=>document.getElementById('msg').textContent='',3000);}).catch(()=>{document.getElementById('msg').style.color='#900';document.getElementById('msg').textContent='Test failed';});};
-document.getElementById('switchOnlineBtn').onclick=function(){if(!confirm('Online moda geçmek istediğinize emin misiniz?\n\nWiFi ağına bağlanmanız gerekecek.\nZamanlama ayarlarınız korunacak.'))return;document.getElementById('msg').textContent='Online moda geçiliyor...';document.getElementById('msg').style.color='#1a73e8';postForm('/api/change-mode/',{mode:'online'}).then(()=>{document.getElementById('msg').textContent='Yeniden başlatılıyor...';setTimeout(()=>location.reload(),3000);}).catch(()=>{document.getElementById('msg').style.color='#900';document.getElementById('msg').textContent='Hata';});};
-document.getElementById('changeModeBtn').onclick=function(){if(!confirm('🔄 Change operation mode?\n\nYour schedule and time settings will be kept.\nOnly the mode selection will be reset.'))return;document.getElementById('msg').textContent='Changing mode...';document.getElementById('msg').style.color='#f59e0b';postForm('/api/change-mode/',{}).then(()=>{document.getElementById('msg').textContent='Rebooting...';setTimeout(()=>location.reload(),3000);}).catch(()=>{document.getElementById('msg').style.color='#900';document.getElementById('msg').textContent='Failed';});};
-document.getElementById('resetBtn').onclick=function(){if(!confirm('⚠️ FACTORY RESET\n\nThis will erase:\n• Mode selection\n• All feed times\n• Time settings\n• Servo settings\n\nContinue?'))return;document.getElementById('msg').textContent='Resetting...';document.getElementById('msg').style.color='#dc2626';postForm('/api/factory-reset/',{}).then(()=>{document.getElementById('msg').textContent='Device rebooting...';setTimeout(()=>location.reload(),3000);}).catch(()=>{document.getElementById('msg').style.color='#900';document.getElementById('msg').textContent='Reset failed';});};
+document.getElementById('switchOnlineBtn').onclick=function(){if(!confirm('Online moda geçmek istediğinize emin misiniz?\n\nWiFi ağına bağlanmanız gerekecek.\nZamanlama ayarlarınız korunacak.'))return;document.getElementById('msg').textContent='Online moda geçiliyor...';document.getElementById('msg').style.color='#1a73e8';postForm('/api/change-mode/',{mode:'online'}).then(()=>{document.getElementById('msg').textContent='Online moda geçildi';setTimeout(()=>location.reload(),1000);}).catch(()=>{document.getElementById('msg').style.color='#900';document.getElementById('msg').textContent='Hata';});};
+document.getElementById('changeModeBtn').onclick=function(){if(!confirm('🔄 Change operation mode?\n\nYour schedule and time settings will be kept.\nOnly the mode selection will be reset.'))return;document.getElementById('msg').textContent='Changing mode...';document.getElementById('msg').style.color='#f59e0b';postForm('/api/change-mode/',{}).then(()=>{document.getElementById('msg').textContent='Mode reset';setTimeout(()=>location.reload(),1000);}).catch(()=>{document.getElementById('msg').style.color='#900';document.getElementById('msg').textContent='Failed';});};
+document.getElementById('resetBtn').onclick=function(){if(!confirm('⚠️ FACTORY RESET\n\nThis will erase:\n• Mode selection\n• All feed times\n• Time settings\n• Servo settings\n\nContinue?'))return;document.getElementById('msg').textContent='Resetting...';document.getElementById('msg').style.color='#dc2626';postForm('/api/factory-reset/',{}).then(()=>{document.getElementById('msg').textContent='Reset done';setTimeout(()=>location.reload(),1000);}).catch(()=>{document.getElementById('msg').style.color='#900';document.getElementById('msg').textContent='Reset failed';});};
 document.getElementById('syncBtn').onclick=syncTime;
 document.getElementById('refreshBtn').onclick=updateStatus;
 updateBrowserTime();setInterval(updateBrowserTime,1000);
-setInterval(updateStatus,1000);
-syncTime();updateStatus();loadConfig();
+liveStatus();
+if(STATE){applyConfig(STATE.config);showStatus(STATE.status);}else{updateStatus();loadConfig();}
+syncTime();
 const angleEl=document.getElementById('angle');if(angleEl){angleEl.addEventListener('input',updateAngleLabel);updateAngleLabel();}
 })();</script></main></body></html>
 )rawliteral";
@@ -0,0 +1,781 @@
+#ifndef WEB_PORTAL_PAGES_GZ_H
+#define WEB_PORTAL_PAGES_GZ_H
+
+// Generated by tools/pack_pages.py from WebPortalPages.h - do not edit
+
+#include <Arduino.h>
+
+/**
+ * @brief Gzip-compressed portal page in PROGMEM
+ */
+struct GzipPage {
+  const uint8_t* data;
+  size_t length;        // Compressed size (Content-Length)
+  const char* etag;     // Quoted content hash
+};
+
+/**
+ * @brief Gzip page with the page state spliced in at run time
+ * 
+ * Stream: head, stored deflate block with the state, tail, gzip trailer
+ * (CRC-32 and size of the whole text, computed by the device).
+ */
+struct SplicedPage {
+  const uint8_t* head;  // gzip header + deflate of the text before the state
+  size_t headLength;
+  const uint8_t* tail;  // Final deflate block(s) of the text after it
+  size_t tailLength;
+  uint32_t headCrc;     // CRC-32 of the text before the state
+  uint32_t tailCrc;     // CRC-32 of the text after it
+  uint32_t tailShift;   // x^(8 * tail text length) mod P, to combine the CRCs
+  uint32_t textLength;  // Page text length without the state
+};
+
+// MODE_SELECTION_PAGE: 2316 bytes -> 1230 bytes gzip
+const uint8_t MODE_SELECTION_PAGE_GZ_DATA[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x95, 0x56, 0x5d, 0x8e, 0xdb, 0x36,
+  0x10, 0x7e, 0xd7, 0x29, 0xd8, 0x04, 0x85, 0x24, 0xc0, 0xb2, 0x64, 0xd7, 0x71, 0xbc, 0xb2, 0xad,
+  0x36, 0x49, 0x13, 0x74, 0x81, 0xa4, 0x09, 0xb2, 0x09, 0x8a, 0x3e, 0xd2, 0xe2, 0xc8, 0x62, 0x2d,
+  0x91, 0x02, 0x49, 0xd9, 0xeb, 0x35, 0x7c, 0x83, 0x02, 0xcd, 0x0d, 0xf6, 0xb1, 0xaf, 0xf1, 0x05,
+  0xfa, 0x52, 0xe7, 0x22, 0x3d, 0x41, 0x8e, 0xd0, 0xa1, 0xe4, 0xdd, 0xf5, 0x66, 0x17, 0xfd, 0x81,
+  0x00, 0x89, 0x1c, 0x0d, 0x67, 0xbe, 0xf9, 0x66, 0x38, 0xa4, 0x33, 0xf9, 0x8a, 0xc9, 0xd4, 0xac,
+  0x2b, 0x20, 0xb9, 0x29, 0x8b, 0x64, 0x72, 0x78, 0x03, 0x65, 0xc9, 0xa4, 0x04, 0x43, 0x49, 0x9a,
+  0x53, 0xa5, 0xc1, 0x4c, 0xdd, 0xda, 0x64, 0xc1, 0xc8, 0x0d, 0x13, 0xa7, 0x95, 0x0b, 0x5a, 0xc2,
+  0xd4, 0x5d, 0x72, 0x58, 0x55, 0x52, 0x19, 0x97, 0xa4, 0x52, 0x18, 0x10, 0xa8, 0xb7, 0xe2, 0xcc,
+  0xe4, 0x53, 0x06, 0x4b, 0x9e, 0x42, 0xd0, 0x4c, 0x3a, 0x5c, 0x70, 0xc3, 0x69, 0x11, 0xe8, 0x94,
+  0x16, 0x30, 0xed, 0x35, 0x46, 0x0c, 0x37, 0x05, 0x24, 0x2f, 0x00, 0x18, 0x28, 0x72, 0x06, 0xa6,
+  0xae, 0x26, 0x61, 0x2b, 0x73, 0x26, 0xda, 0xac, 0xed, 0x37, 0x56, 0x52, 0x9a, 0x4d, 0x10, 0xcc,
+  0xe6, 0xf1, 0xc3, 0x6c, 0x98, 0x3d, 0xce, 0x4e, 0xc6, 0x41, 0x90, 0xe1, 0xa4, 0xd7, 0xeb, 0xe1,
+  0x28, 0xa5, 0x8a, 0xe1, 0x8f, 0x2c, 0xc3, 0x71, 0x59, 0x1b, 0xc0, 0xc9, 0x70, 0x38, 0xc4, 0x09,
+  0x4d, 0x53, 0x44, 0x82, 0x6a, 0xf4, 0xf1, 0x37, 0x30, 0x42, 0x81, 0xae, 0x51, 0xa2, 0x75, 0xfc,
+  0x30, 0x62, 0x27, 0x83, 0xd1, 0x68, 0xeb, 0x7c, 0x57, 0x02, 0xe3, 0x94, 0x78, 0x95, 0x82, 0x0c,
+  0x94, 0x0e, 0x52, 0x59, 0x48, 0x85, 0xf0, 0x72, 0x28, 0x21, 0x66, 0x54, 0x2d, 0xfc, 0xcd, 0xb1,
+  0xf3, 0x08, 0xd0, 0xe3, 0xf0, 0xe0, 0x1c, 0x86, 0xf6, 0xb9, 0xf6, 0xdf, 0x1b, 0xf6, 0x66, 0xfd,
+  0xfe, 0x0d, 0x04, 0x1a, 0xd9, 0xe7, 0xd8, 0x69, 0x6f, 0x30, 0x1b, 0xd1, 0xe1, 0x76, 0xeb, 0x58,
+  0x6e, 0x3b, 0x33, 0xc9, 0xd6, 0x9b, 0x1c, 0xf8, 0x3c, 0x37, 0x71, 0x2f, 0x8a, 0xbe, 0xde, 0x3a,
+  0x8d, 0xa4, 0xa4, 0x6a, 0xce, 0x45, 0x1c, 0x8d, 0x67, 0x34, 0x5d, 0xcc, 0x95, 0xac, 0x05, 0x8b,
+  0x97, 0x54, 0x79, 0x16, 0x80, 0x3f, 0x6e, 0xf0, 0x1d, 0xe6, 0x19, 0xce, 0x33, 0x24, 0x3b, 0xc8,
+  0x68, 0xc9, 0x8b, 0x75, 0xac, 0xd7, 0xda, 0x40, 0x19, 0xd4, 0xbc, 0x13, 0xd0, 0xaa, 0x2a, 0x20,
+  0x68, 0x05, 0x9d, 0x33, 0x98, 0x4b, 0x20, 0xef, 0x4f, 0x3b, 0x6f, 0xe5, 0x4c, 0x1a, 0xd9, 0x79,
+  0x3f, 0xab, 0x85, 0xa9, 0x3b, 0x9a, 0x0a, 0x1d, 0x68, 0x50, 0x3c, 0x1b, 0x33, 0xae, 0xab, 0x82,
+  0xae, 0xe3, 0xb9, 0xe2, 0x6c, 0x8c, 0x23, 0xcc, 0x17, 0xc7, 0x95, 0x3a, 0xb6, 0xf4, 0x81, 0xda,
+  0x3a, 0x5d, 0x1b, 0xe2, 0xa6, 0xc9, 0x61, 0x5c, 0x72, 0xe1, 0x9d, 0xf4, 0x97, 0xab, 0xce, 0x60,
+  0x18, 0x55, 0xe7, 0xfe, 0x5d, 0x9c, 0x56, 0x17, 0xc5, 0x52, 0x61, 0x42, 0x03, 0x45, 0x19, 0xaf,
+  0x75, 0xdc, 0xeb, 0x57, 0xe7, 0x28, 0x3a, 0x0f, 0x74, 0x4e, 0x99, 0x5c, 0xc5, 0x11, 0x41, 0x01,
+  0xb1, 0x52, 0xa2, 0xe6, 0x33, 0xea, 0x45, 0x1d, 0xfb, 0x74, 0xa3, 0x91, 0x3f, 0xae, 0x28, 0x63,
+  0x5c, 0xcc, 0xe3, 0xfe, 0xa0, 0x3a, 0x47, 0xaa, 0xfa, 0xd7, 0x8c, 0x90, 0x88, 0x8c, 0xd0, 0x8a,
+  0x81, 0x73, 0x13, 0xd0, 0x82, 0xcf, 0xc5, 0x01, 0x5e, 0x4b, 0xc2, 0xaa, 0x65, 0x72, 0x18, 0x45,
+  0x5b, 0xa7, 0xda, 0xdc, 0x55, 0x3a, 0x66, 0xae, 0xc9, 0xd0, 0x81, 0x3c, 0xcd, 0x2f, 0x20, 0xee,
+  0x9e, 0x28, 0x28, 0xc7, 0x47, 0x8e, 0x5a, 0xe7, 0xdd, 0x52, 0x32, 0x08, 0x66, 0x46, 0x1c, 0x42,
+  0xb7, 0x69, 0xba, 0xc6, 0xd7, 0x1b, 0x22, 0x98, 0xc3, 0x12, 0xc4, 0x45, 0xa2, 0x43, 0xc8, 0xb1,
+  0x0d, 0x4a, 0xcb, 0x82, 0x33, 0xf2, 0x30, 0xcd, 0xd8, 0x10, 0x06, 0xf7, 0x72, 0x71, 0x3f, 0x6b,
+  0xf7, 0xe6, 0xb7, 0x81, 0xd8, 0xb3, 0x08, 0xbf, 0x88, 0x74, 0x9c, 0xd6, 0x4a, 0xa3, 0x7e, 0x25,
+  0x79, 0x13, 0xa3, 0x51, 0x98, 0x53, 0xdc, 0x61, 0x52, 0xc4, 0xb4, 0x28, 0x48, 0xb7, 0xaf, 0x8f,
+  0x62, 0x88, 0x73, 0xb9, 0x04, 0xb5, 0x39, 0x60, 0x39, 0x76, 0xd4, 0x6e, 0x13, 0xbf, 0x5d, 0x9e,
+  0x49, 0x55, 0xc6, 0xcd, 0xa8, 0xa0, 0x06, 0x7e, 0xf6, 0x82, 0x7e, 0x93, 0xe4, 0xe3, 0xd4, 0x0d,
+  0xee, 0x4b, 0x5d, 0xcf, 0x3f, 0xf6, 0x45, 0x53, 0xc3, 0x97, 0xb0, 0xb9, 0xd7, 0x62, 0x74, 0xad,
+  0xc9, 0xb1, 0x57, 0x6c, 0x6e, 0x42, 0xec, 0xdf, 0x24, 0x21, 0xc0, 0x4a, 0x35, 0xb2, 0xb4, 0xc4,
+  0x5e, 0x29, 0x33, 0xd0, 0xe9, 0x91, 0x72, 0x77, 0xf4, 0xe8, 0x4b, 0x46, 0x06, 0x96, 0x91, 0xbb,
+  0x69, 0x3e, 0x58, 0x34, 0xb2, 0x8a, 0x9b, 0xac, 0x4e, 0xc2, 0xb6, 0xad, 0x4c, 0xc2, 0xb6, 0xbb,
+  0xd9, 0x6d, 0x87, 0x3d, 0x8e, 0x72, 0x41, 0xd2, 0x82, 0x6a, 0x3d, 0x75, 0x6d, 0x2e, 0x5c, 0x6c,
+  0x3f, 0x79, 0x3f, 0xf9, 0x7c, 0xf9, 0xe1, 0x0f, 0x72, 0xbb, 0x39, 0xa1, 0xd4, 0x99, 0x54, 0xc9,
+  0x33, 0x9e, 0xd3, 0x8b, 0xfd, 0x4e, 0xec, 0x77, 0xf8, 0xc6, 0x2e, 0xa8, 0xf7, 0xbb, 0x82, 0x2c,
+  0xea, 0xa2, 0xa0, 0xa2, 0xa4, 0x0b, 0xc2, 0x71, 0xef, 0x29, 0x8d, 0x0d, 0xef, 0xe2, 0xdb, 0x49,
+  0x58, 0xe1, 0x8a, 0x59, 0x8d, 0x11, 0x5d, 0xbb, 0xb8, 0x62, 0xca, 0x25, 0x52, 0xa4, 0x05, 0x4f,
+  0x17, 0x53, 0x57, 0x43, 0x01, 0xa9, 0x79, 0x85, 0x3f, 0xbc, 0x07, 0x32, 0xcb, 0x0a, 0x2e, 0xe0,
+  0x81, 0x6f, 0x61, 0x30, 0xbe, 0xbc, 0xb5, 0xcc, 0xd2, 0xe6, 0x26, 0x7f, 0xfd, 0xf6, 0x71, 0x12,
+  0xe2, 0xaf, 0x56, 0x21, 0x39, 0xb5, 0x15, 0x20, 0xc0, 0x90, 0xd7, 0x2f, 0x5f, 0x3d, 0xf9, 0xfe,
+  0xc9, 0x8f, 0x47, 0xff, 0x6e, 0x2d, 0xb6, 0x34, 0xba, 0xc9, 0x19, 0x65, 0x90, 0x02, 0xb9, 0xa0,
+  0x25, 0x15, 0xb8, 0xf3, 0xf7, 0xbb, 0x14, 0x63, 0xe0, 0x05, 0x90, 0x3f, 0x7f, 0xa7, 0xc5, 0x7e,
+  0xf7, 0xe9, 0x72, 0xbf, 0x53, 0x57, 0x16, 0xc2, 0x16, 0xf9, 0xff, 0x0e, 0x41, 0xfc, 0x5b, 0x04,
+  0x9f, 0x2f, 0x7f, 0xfd, 0x70, 0x6f, 0x08, 0xfb, 0x8f, 0x2f, 0x9f, 0xff, 0x33, 0xfe, 0x9f, 0xf8,
+  0x0b, 0xee, 0xae, 0x81, 0xcc, 0xe8, 0xfe, 0x12, 0x09, 0xdf, 0xef, 0x2a, 0x52, 0x5f, 0xd0, 0x85,
+  0xa1, 0x82, 0x2c, 0xb0, 0x22, 0x94, 0x2c, 0xee, 0xa2, 0xb7, 0x96, 0x38, 0x43, 0x33, 0x34, 0x3d,
+  0x15, 0x99, 0x74, 0x49, 0x53, 0x06, 0x53, 0xf7, 0x3f, 0xf5, 0x8a, 0xa3, 0x22, 0xea, 0xd9, 0x2e,
+  0x74, 0xdc, 0x3b, 0x1e, 0x41, 0xe9, 0x26, 0xaf, 0x9e, 0x3c, 0x8b, 0xc9, 0x44, 0x57, 0x88, 0xe0,
+  0xe0, 0xc4, 0x4d, 0x02, 0x2c, 0x35, 0x14, 0x24, 0x57, 0x58, 0x74, 0xaa, 0x78, 0x65, 0x12, 0x27,
+  0x03, 0x93, 0xe6, 0x9e, 0x1b, 0xd2, 0x8a, 0x87, 0x73, 0x40, 0x3b, 0x86, 0x9a, 0x5a, 0x87, 0xae,
+  0xdf, 0x35, 0x39, 0x08, 0x4f, 0x4d, 0x13, 0xd5, 0xfd, 0x45, 0x4b, 0xe1, 0xf9, 0x07, 0x09, 0x9b,
+  0x26, 0x1b, 0x87, 0x10, 0x9e, 0x79, 0xac, 0x8b, 0x96, 0x7d, 0x82, 0x67, 0x75, 0x5d, 0x22, 0xd8,
+  0x2e, 0x2e, 0x7f, 0x5e, 0x80, 0x1d, 0x3e, 0x5d, 0x9f, 0x32, 0xaf, 0xf1, 0xeb, 0x77, 0xb9, 0x10,
+  0xa0, 0xde, 0x61, 0x5c, 0x64, 0x4a, 0x9a, 0x15, 0x63, 0x67, 0xeb, 0x8f, 0x6d, 0xe5, 0x1f, 0x10,
+  0xdc, 0x40, 0xa9, 0x45, 0x6a, 0x1b, 0x06, 0x39, 0x4a, 0x9d, 0xe5, 0xd9, 0xdf, 0xdc, 0x42, 0x89,
+  0x07, 0x7f, 0x60, 0xc5, 0xa1, 0xdb, 0xd9, 0xe0, 0xa9, 0x9f, 0x4b, 0x16, 0xbb, 0x6f, 0x5e, 0x9f,
+  0xbd, 0x73, 0x3b, 0x76, 0x0f, 0x61, 0xa1, 0xc7, 0x1b, 0xf7, 0x59, 0x7b, 0xf0, 0x07, 0xef, 0xf0,
+  0x12, 0xe1, 0xc6, 0xae, 0x3d, 0x83, 0x78, 0x4a, 0xad, 0xf1, 0xf0, 0x3c, 0x58, 0xad, 0x56, 0x81,
+  0x6d, 0x04, 0x41, 0xad, 0x0a, 0x10, 0x29, 0x9a, 0x62, 0xee, 0xb6, 0x39, 0x03, 0x63, 0x01, 0x2b,
+  0xf2, 0xfe, 0xed, 0xcb, 0x33, 0xa0, 0x2a, 0xcd, 0xdf, 0x50, 0x45, 0x4b, 0xed, 0x6d, 0xac, 0xb3,
+  0xd8, 0xbe, 0xb6, 0xfe, 0xd6, 0x77, 0x5a, 0x16, 0x3c, 0x1f, 0x69, 0x58, 0x71, 0x81, 0x5d, 0xa8,
+  0x5b, 0xc8, 0xd6, 0x74, 0x37, 0xc7, 0x93, 0x7b, 0xea, 0x86, 0xee, 0xd8, 0xaa, 0xa1, 0x0c, 0x21,
+  0x37, 0x7a, 0x78, 0xc1, 0x50, 0xc6, 0x73, 0x7f, 0xa0, 0x78, 0x45, 0x91, 0x45, 0xfd, 0xe9, 0xd2,
+  0xd4, 0xae, 0x3f, 0xb6, 0x2c, 0x6c, 0x6f, 0x78, 0x98, 0x84, 0x76, 0xdb, 0xe3, 0xa7, 0xed, 0x01,
+  0x61, 0x73, 0xe9, 0x71, 0xfe, 0x06, 0x4a, 0x2e, 0x43, 0x40, 0x0c, 0x09, 0x00, 0x00,
+};
+constexpr size_t MODE_SELECTION_PAGE_GZ_LEN = 1230;
+const GzipPage MODE_SELECTION_PAGE_GZ = { MODE_SELECTION_PAGE_GZ_DATA, MODE_SELECTION_PAGE_GZ_LEN, "\"e185515cdc33519e\"" };
+
+// WIFI_SETUP_PAGE: 9784 bytes -> 3386 bytes gzip
+const uint8_t WIFI_SETUP_PAGE_GZ_DATA[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xb5, 0x5a, 0x49, 0x73, 0x1b, 0xc7,
+  0x15, 0xbe, 0xe3, 0x57, 0xb4, 0xa8, 0x8a, 0x06, 0x13, 0x02, 0x83, 0xc5, 0x14, 0x4d, 0x01, 0x18,
+  0x28, 0xda, 0x6c, 0x29, 0x5e, 0xa4, 0x32, 0x99, 0x72, 0x39, 0x4b, 0xa5, 0x1a, 0x33, 0x3d, 0x40,
+  0x07, 0xb3, 0xa5, 0xbb, 0x87, 0x20, 0x04, 0xe1, 0x92, 0x8a, 0x6f, 0xae, 0x72, 0xaa, 0x92, 0x53,
+  0xca, 0x89, 0x72, 0xf3, 0xd5, 0xbc, 0xb8, 0x72, 0xf0, 0x4d, 0xd4, 0x1f, 0xf1, 0x1f, 0x48, 0x7e,
+  0x42, 0x5e, 0x2f, 0xb3, 0x60, 0x23, 0x29, 0xc9, 0x11, 0x4b, 0xe0, 0x74, 0xcf, 0xeb, 0xd7, 0x6f,
+  0xf9, 0xde, 0xd2, 0x0d, 0xd6, 0x06, 0x37, 0xfc, 0xc4, 0x13, 0xf3, 0x94, 0xa0, 0x89, 0x88, 0xc2,
+  0xe1, 0xc0, 0x7c, 0x12, 0xec, 0x0f, 0x07, 0x11, 0x11, 0x18, 0x79, 0x13, 0xcc, 0x38, 0x11, 0xae,
+  0x95, 0x89, 0xa0, 0x79, 0x64, 0xb5, 0xcc, 0x74, 0x8c, 0x23, 0xe2, 0x5a, 0xa7, 0x94, 0xcc, 0xd2,
+  0x84, 0x09, 0x0b, 0x79, 0x49, 0x2c, 0x48, 0x0c, 0x64, 0x33, 0xea, 0x8b, 0x89, 0xeb, 0x93, 0x53,
+  0xea, 0x91, 0xa6, 0x1a, 0x34, 0x68, 0x4c, 0x05, 0xc5, 0x61, 0x93, 0x7b, 0x38, 0x24, 0x6e, 0x47,
+  0xf2, 0x10, 0x54, 0x84, 0x64, 0xf8, 0x39, 0xfd, 0x80, 0x0e, 0x5a, 0xfa, 0xb9, 0x36, 0xe0, 0x62,
+  0x0e, 0xbf, 0x7b, 0x2c, 0x49, 0xc4, 0xa2, 0xd9, 0x1c, 0x8d, 0x7b, 0x37, 0x83, 0xc3, 0xe0, 0xfd,
+  0xe0, 0x4e, 0xbf, 0xd9, 0x0c, 0x60, 0xd0, 0xe9, 0x74, 0xe0, 0xc9, 0xc3, 0xcc, 0x87, 0x17, 0x41,
+  0x00, 0xcf, 0x51, 0x26, 0x08, 0x0c, 0x0e, 0x0f, 0x0f, 0x61, 0x80, 0x3d, 0x0f, 0xf6, 0x07, 0x32,
+  0xfc, 0xfe, 0x7b, 0xe4, 0x08, 0x26, 0x92, 0x69, 0xef, 0x66, 0xdb, 0xbf, 0x73, 0x70, 0x24, 0x07,
+  0x33, 0xcc, 0x62, 0x58, 0x76, 0xfb, 0x0e, 0x69, 0x8f, 0x96, 0xb5, 0x5f, 0x44, 0xc4, 0xa7, 0x18,
+  0xd5, 0x53, 0x46, 0x02, 0xc2, 0x78, 0xd3, 0x4b, 0xc2, 0x84, 0x81, 0x78, 0x13, 0x12, 0x91, 0x9e,
+  0x8f, 0xd9, 0xd4, 0x5e, 0x54, 0xc5, 0x68, 0x13, 0xd8, 0xfb, 0xd0, 0x88, 0x41, 0x0e, 0xe5, 0x4f,
+  0x21, 0x49, 0xe7, 0xb0, 0x33, 0xea, 0x76, 0x4b, 0x61, 0x70, 0x5b, 0xfe, 0x98, 0xed, 0x3b, 0x07,
+  0xa3, 0x23, 0x7c, 0x58, 0x6e, 0x3f, 0x1a, 0x05, 0xdd, 0x83, 0xe5, 0xb2, 0xf6, 0xf3, 0xc5, 0x28,
+  0x39, 0x6b, 0x72, 0xfa, 0x9c, 0xc6, 0xe3, 0xde, 0x28, 0x61, 0x3e, 0x61, 0x4d, 0x98, 0x59, 0x4a,
+  0xe3, 0x37, 0x46, 0x89, 0x3f, 0x5f, 0x4c, 0x08, 0x1d, 0x4f, 0x44, 0xaf, 0xd3, 0x6e, 0xff, 0xac,
+  0x1f, 0x61, 0x36, 0xa6, 0x71, 0xaf, 0xbd, 0x54, 0x6f, 0x46, 0xd8, 0x9b, 0x8e, 0x59, 0x92, 0xc5,
+  0x7e, 0xef, 0x14, 0xb3, 0xba, 0x94, 0xd0, 0xee, 0x2b, 0x05, 0xcc, 0x38, 0x80, 0x71, 0x00, 0xde,
+  0xe8, 0x75, 0x0e, 0xd2, 0x33, 0xc4, 0xe7, 0x5c, 0x90, 0xa8, 0x99, 0xd1, 0x06, 0xc7, 0x31, 0x6f,
+  0x72, 0xc2, 0x68, 0xd0, 0xf7, 0x29, 0x4f, 0x43, 0x3c, 0xef, 0x8d, 0x19, 0xf5, 0xfb, 0xf0, 0x04,
+  0x9e, 0xa2, 0x40, 0xc5, 0x7b, 0xd2, 0x84, 0x84, 0x2d, 0x6b, 0x8e, 0x54, 0x6e, 0xa1, 0xbc, 0xd7,
+  0x8b, 0x68, 0x5c, 0xbf, 0xd3, 0x3d, 0x9d, 0x35, 0x0e, 0xba, 0xed, 0xf4, 0xcc, 0xee, 0x6f, 0x08,
+  0x20, 0x69, 0x61, 0x5a, 0xab, 0xc1, 0xb0, 0x4f, 0x33, 0xde, 0xeb, 0x74, 0xd3, 0xb3, 0xbe, 0x52,
+  0x72, 0x82, 0xfd, 0x64, 0xd6, 0x6b, 0x23, 0x98, 0x40, 0x47, 0xf0, 0x9f, 0x8d, 0x47, 0xb8, 0xde,
+  0x6e, 0xc8, 0x1f, 0xa7, 0x7d, 0x64, 0xf7, 0x53, 0xec, 0xfb, 0xd2, 0x0c, 0x92, 0xf9, 0xb2, 0x36,
+  0xe9, 0x2e, 0x72, 0x75, 0x51, 0x1b, 0x29, 0x2e, 0x82, 0x9c, 0x89, 0x26, 0x0e, 0xe9, 0x38, 0x36,
+  0xe2, 0x29, 0xed, 0xa4, 0xf5, 0x48, 0xaf, 0xe3, 0x74, 0x19, 0x89, 0x96, 0x21, 0x1e, 0x91, 0x70,
+  0x91, 0x6b, 0x35, 0x0a, 0x13, 0x6f, 0x6a, 0xac, 0xd6, 0x14, 0x49, 0x0a, 0x56, 0x04, 0x36, 0xe5,
+  0x22, 0xe7, 0x0e, 0xac, 0x59, 0x31, 0x99, 0xf2, 0x9d, 0xbd, 0xac, 0x71, 0x12, 0x12, 0x4f, 0x00,
+  0x5e, 0xd3, 0x4c, 0x18, 0xed, 0x95, 0x07, 0x72, 0x19, 0x15, 0xa3, 0x0a, 0xe3, 0x03, 0xa5, 0xa4,
+  0xd4, 0xbb, 0xd7, 0x91, 0xb6, 0x4e, 0x42, 0xea, 0xa3, 0x9b, 0x5e, 0xe0, 0x1f, 0x92, 0x83, 0x35,
+  0x83, 0x1c, 0x4a, 0xd2, 0xd2, 0x72, 0x82, 0x81, 0x37, 0x52, 0xcc, 0x40, 0x21, 0x23, 0x09, 0x8d,
+  0x27, 0xe0, 0x1b, 0xb1, 0x2e, 0xe7, 0xb2, 0x36, 0xca, 0x84, 0x48, 0xe2, 0xaa, 0x38, 0xeb, 0xaa,
+  0x15, 0xe2, 0x75, 0x4a, 0x79, 0xda, 0x9b, 0x7e, 0xd2, 0x11, 0x92, 0x83, 0x45, 0xc5, 0xd0, 0xa6,
+  0x8c, 0x6a, 0xfb, 0x99, 0x46, 0xdf, 0x61, 0xbb, 0xdd, 0xf7, 0x32, 0xc6, 0x81, 0x3a, 0x4d, 0xa8,
+  0x46, 0x86, 0x96, 0xc6, 0xe1, 0xc4, 0xdb, 0x44, 0xa2, 0x36, 0x63, 0x21, 0xce, 0x9d, 0x55, 0xab,
+  0x1f, 0xdd, 0x96, 0xea, 0x98, 0xf5, 0x32, 0x20, 0x36, 0x19, 0xc8, 0x59, 0x70, 0xc3, 0xcd, 0x88,
+  0x8f, 0x17, 0x9b, 0x6e, 0xaf, 0xa8, 0x7d, 0xb4, 0x85, 0xf5, 0x16, 0x8f, 0xf6, 0x01, 0xbb, 0xcd,
+  0x3c, 0x94, 0xa4, 0x2d, 0x9d, 0x64, 0xba, 0xb9, 0x6b, 0x32, 0x5d, 0xb1, 0x49, 0x2e, 0xfe, 0x6d,
+  0x0d, 0xd8, 0x35, 0x1b, 0x49, 0x97, 0xe7, 0x40, 0xa3, 0x71, 0x48, 0x63, 0xd2, 0xdc, 0xc0, 0xdb,
+  0x91, 0x44, 0xb2, 0xe3, 0xd3, 0x53, 0x0a, 0x0b, 0x17, 0x66, 0xbd, 0xf2, 0xd6, 0x06, 0x48, 0x0c,
+  0xd8, 0x3b, 0x60, 0x7a, 0xd4, 0xce, 0xb7, 0xd6, 0xb4, 0x5d, 0xc9, 0x65, 0xd0, 0xd2, 0x59, 0x71,
+  0xd0, 0xd2, 0x29, 0x59, 0xa6, 0x80, 0xe1, 0x00, 0x58, 0x23, 0x2f, 0xc4, 0x9c, 0xbb, 0x96, 0x0c,
+  0x3e, 0x0b, 0x12, 0x76, 0x77, 0xf8, 0xdf, 0x97, 0x5f, 0xfd, 0x05, 0xc9, 0x8c, 0x8a, 0x3e, 0xca,
+  0x58, 0x16, 0x66, 0x51, 0x06, 0x8b, 0xba, 0xc3, 0x41, 0x90, 0xb0, 0x08, 0x51, 0xdf, 0xb5, 0x02,
+  0x0b, 0x92, 0xac, 0x0a, 0x95, 0xe1, 0xbd, 0x8b, 0x97, 0x21, 0x66, 0x83, 0x96, 0x1e, 0x0d, 0x34,
+  0xee, 0x15, 0x11, 0x07, 0x66, 0x49, 0x2a, 0x68, 0x12, 0x0f, 0x4f, 0x30, 0x80, 0xf4, 0xe2, 0x7c,
+  0x9e, 0x30, 0xc7, 0x71, 0x06, 0x2d, 0x33, 0x0b, 0x12, 0x29, 0xea, 0x82, 0xd7, 0x27, 0x38, 0xce,
+  0x48, 0x88, 0x8e, 0x8f, 0x9f, 0x3c, 0x2c, 0x18, 0xaa, 0x08, 0x52, 0xfc, 0x22, 0x0b, 0xa9, 0x04,
+  0x33, 0x49, 0x42, 0xb0, 0x82, 0x6b, 0x7d, 0x48, 0x9f, 0x87, 0x14, 0xe1, 0x8b, 0x97, 0x88, 0xbe,
+  0xfa, 0x96, 0xc6, 0xa5, 0x48, 0xaf, 0xff, 0x49, 0x03, 0x46, 0xd6, 0x38, 0xc8, 0xc2, 0xe4, 0x5a,
+  0x29, 0x68, 0x3a, 0x03, 0x2b, 0x5a, 0x8a, 0x63, 0xba, 0xc6, 0x51, 0xa9, 0xfc, 0xfa, 0xa5, 0x5c,
+  0xcd, 0xa9, 0xe4, 0xa7, 0x21, 0x36, 0xbc, 0x8f, 0xa5, 0x92, 0xf1, 0xa0, 0x65, 0xc6, 0x66, 0xde,
+  0xf0, 0xd4, 0x03, 0x2b, 0x37, 0x23, 0xe0, 0x59, 0x73, 0x67, 0x16, 0x18, 0xf2, 0x6f, 0x7f, 0x46,
+  0x52, 0xf9, 0xeb, 0x2d, 0x95, 0xa0, 0xd5, 0x6b, 0x01, 0x17, 0xc0, 0x45, 0x39, 0x4c, 0x0d, 0x14,
+  0x48, 0xe2, 0x24, 0x26, 0xd6, 0xf0, 0xc7, 0x6f, 0xfe, 0xf4, 0x9f, 0x7f, 0x7f, 0x8d, 0x8c, 0x4c,
+  0x02, 0xac, 0x7a, 0x71, 0x8e, 0x3e, 0x22, 0xbc, 0xdc, 0xa2, 0x25, 0xfd, 0x04, 0xd2, 0x4b, 0xdf,
+  0x2a, 0xc3, 0xf1, 0xb1, 0xb5, 0xee, 0x02, 0x78, 0xa7, 0x9d, 0x6f, 0xf6, 0xd8, 0x88, 0x11, 0x2d,
+  0x87, 0x07, 0x3e, 0x54, 0xb4, 0xb5, 0x2a, 0x52, 0x0c, 0x1e, 0xcb, 0x77, 0x46, 0x29, 0xb5, 0x19,
+  0xf8, 0x10, 0x87, 0x9f, 0x02, 0xbb, 0xad, 0xf2, 0xf7, 0xb7, 0xc5, 0x8c, 0x85, 0x92, 0xd8, 0x0b,
+  0xa9, 0x37, 0x75, 0x2d, 0x08, 0x00, 0x2c, 0xc1, 0xe1, 0x4c, 0xa0, 0xa0, 0xba, 0x7b, 0xad, 0x3d,
+  0xa9, 0xf0, 0x97, 0xe8, 0xa9, 0x8a, 0x0f, 0x74, 0x8c, 0xe7, 0x01, 0xe6, 0x17, 0xe7, 0x31, 0x46,
+  0x1f, 0x52, 0x51, 0x68, 0x5c, 0x08, 0x60, 0x36, 0xac, 0xec, 0x71, 0xf3, 0x68, 0x74, 0xdb, 0x0b,
+  0x0e, 0x2b, 0x3b, 0x80, 0x6f, 0x89, 0x38, 0x49, 0x3e, 0x49, 0x7c, 0x72, 0xac, 0xe0, 0x07, 0xbb,
+  0xd5, 0x6d, 0xe3, 0xab, 0xfb, 0xf8, 0xf5, 0x4b, 0x8c, 0x1e, 0xbe, 0xfa, 0x3e, 0x46, 0x75, 0xa0,
+  0x40, 0xc7, 0x04, 0xa0, 0x15, 0x51, 0x7b, 0x73, 0xab, 0x15, 0x97, 0x15, 0xcc, 0xf9, 0x8c, 0x0a,
+  0x6f, 0x72, 0x92, 0x3c, 0x0d, 0x02, 0x29, 0xb0, 0xe4, 0xfb, 0xe3, 0xd7, 0xdf, 0x21, 0x33, 0x44,
+  0xc0, 0x12, 0x24, 0x07, 0x9e, 0x15, 0x7e, 0xc6, 0x84, 0xdc, 0x63, 0x34, 0x85, 0x50, 0x80, 0xee,
+  0x87, 0x0b, 0xc4, 0x5d, 0xe8, 0xa5, 0xb2, 0x08, 0x3c, 0xe1, 0x8c, 0x89, 0x78, 0x14, 0x12, 0xf9,
+  0x78, 0x7f, 0xfe, 0xc4, 0xaf, 0x43, 0x58, 0xd9, 0x7d, 0x43, 0x15, 0xed, 0xa6, 0x8a, 0x4a, 0xaa,
+  0x74, 0x37, 0x55, 0x5a, 0x52, 0xb1, 0xdd, 0x54, 0xac, 0xa4, 0x0a, 0x76, 0x53, 0x05, 0x15, 0xb9,
+  0xf8, 0xf8, 0x12, 0xc9, 0x00, 0x8d, 0x05, 0xa5, 0xb7, 0x9b, 0xce, 0x93, 0x54, 0x41, 0x16, 0x2b,
+  0x07, 0xa1, 0x34, 0x49, 0xeb, 0xa1, 0xbd, 0xa8, 0x21, 0xd4, 0x6a, 0xa1, 0xfb, 0x19, 0x0d, 0x7d,
+  0xa4, 0xb3, 0x08, 0x47, 0x60, 0xf2, 0x09, 0x22, 0x67, 0x18, 0xd2, 0x8e, 0xcc, 0x1c, 0x88, 0xc6,
+  0xe8, 0x14, 0x87, 0x19, 0x41, 0x58, 0x08, 0x46, 0xc1, 0xce, 0xa4, 0x8f, 0x54, 0x2a, 0x40, 0x7c,
+  0x92, 0xcc, 0x38, 0xfa, 0x0c, 0xa8, 0x80, 0x8f, 0x11, 0x20, 0x63, 0x2e, 0x77, 0x14, 0x7d, 0x1f,
+  0x26, 0xb9, 0x43, 0xe3, 0x98, 0xb0, 0xc7, 0x27, 0x9f, 0x7c, 0xec, 0x5a, 0x26, 0x7b, 0x69, 0x6e,
+  0xee, 0xde, 0xde, 0xb0, 0xd9, 0x54, 0x80, 0x40, 0xcd, 0x66, 0x91, 0xc3, 0x2c, 0xb9, 0x2a, 0x74,
+  0x20, 0xe2, 0x1e, 0x61, 0x6f, 0x52, 0xa7, 0xee, 0x50, 0xca, 0x98, 0x73, 0x27, 0xdc, 0x43, 0x2e,
+  0xaa, 0x73, 0xc1, 0x6c, 0x77, 0x08, 0x9f, 0x0e, 0x23, 0x2a, 0xe1, 0xd4, 0x5b, 0xb7, 0x5a, 0xe3,
+  0x86, 0x75, 0x0b, 0x47, 0x69, 0xdf, 0xb2, 0xcb, 0xd9, 0x81, 0x9a, 0x0d, 0xc5, 0xca, 0xe4, 0x50,
+  0x4d, 0x8e, 0x57, 0x27, 0xf7, 0xd4, 0xe4, 0x1f, 0xb3, 0x44, 0x4e, 0xf7, 0xd5, 0x96, 0x15, 0xd9,
+  0xd1, 0xbe, 0x8b, 0xd6, 0xc5, 0xb7, 0xf6, 0x41, 0x9a, 0x3a, 0x75, 0x38, 0xa7, 0xbe, 0xbd, 0x6f,
+  0xed, 0x0d, 0xd7, 0x26, 0x50, 0xdd, 0xda, 0xa7, 0x0e, 0x83, 0x11, 0x3c, 0xfb, 0xf7, 0x23, 0x7b,
+  0x55, 0xc7, 0xa5, 0xda, 0x85, 0x06, 0x75, 0xb0, 0x98, 0x6d, 0x2c, 0xe6, 0xc2, 0x73, 0xbf, 0xb6,
+  0xac, 0x81, 0x4b, 0x4e, 0x26, 0x04, 0xe9, 0x4e, 0x1d, 0x41, 0x6f, 0x0e, 0x5e, 0x01, 0x2f, 0x08,
+  0x98, 0xab, 0x84, 0x22, 0xf8, 0x30, 0x0c, 0xd1, 0x6c, 0x42, 0x43, 0x82, 0x28, 0x00, 0x8e, 0xc8,
+  0x76, 0x9f, 0xa3, 0x3d, 0x49, 0x1f, 0x43, 0xad, 0xda, 0xab, 0x85, 0x44, 0xa8, 0xd5, 0x27, 0x34,
+  0x82, 0x74, 0x1c, 0x67, 0x61, 0x58, 0x41, 0x80, 0x7c, 0x51, 0x87, 0xa4, 0x00, 0xf1, 0x3b, 0x69,
+  0x48, 0x56, 0x5c, 0xc1, 0x41, 0x3d, 0xb9, 0xea, 0xf3, 0xc5, 0x8b, 0xb6, 0x94, 0xd1, 0x0b, 0x09,
+  0x66, 0x92, 0x45, 0x92, 0x89, 0x7a, 0xc1, 0x4e, 0x89, 0x0f, 0xd8, 0xd3, 0x46, 0x3a, 0x81, 0xfc,
+  0xe4, 0x5a, 0x2b, 0x39, 0xd1, 0xca, 0x09, 0x54, 0x12, 0x71, 0x54, 0x19, 0x87, 0x63, 0x49, 0xb5,
+  0xdf, 0xb1, 0x8c, 0x09, 0x6e, 0xe8, 0xed, 0xb7, 0x81, 0x65, 0x47, 0xa9, 0x53, 0x2b, 0x03, 0x02,
+  0xb9, 0xa1, 0x6e, 0xb5, 0x70, 0x4a, 0x5b, 0x33, 0x1a, 0x50, 0x79, 0x8a, 0x89, 0x5b, 0xd6, 0x7e,
+  0xae, 0xd5, 0x5d, 0xeb, 0xae, 0x79, 0x82, 0x93, 0x4d, 0xcf, 0xb2, 0x6c, 0x1b, 0x16, 0x39, 0x60,
+  0x45, 0xd0, 0x3b, 0xc7, 0x95, 0xdc, 0x9d, 0x41, 0xef, 0x61, 0x8b, 0x09, 0x4b, 0x66, 0x28, 0x26,
+  0x33, 0xf4, 0x88, 0xb1, 0x84, 0xd5, 0xad, 0xc7, 0x27, 0x27, 0xcf, 0x90, 0xb5, 0xcf, 0x40, 0x7e,
+  0x2c, 0x32, 0x6e, 0x40, 0xc1, 0x88, 0xc8, 0x58, 0x8c, 0x98, 0xf3, 0x07, 0x2e, 0xd3, 0x9c, 0xf6,
+  0x64, 0xc1, 0xd6, 0xc7, 0x02, 0x57, 0x39, 0xcb, 0xb1, 0xc3, 0x33, 0xd0, 0x96, 0x6b, 0xeb, 0xae,
+  0xe1, 0x6a, 0x55, 0xcd, 0x08, 0x83, 0x7b, 0x21, 0x5f, 0xb2, 0x8b, 0x73, 0xc8, 0xc9, 0xcf, 0x57,
+  0x95, 0x95, 0xff, 0xd6, 0xcc, 0xfd, 0xe3, 0x3f, 0xbe, 0x02, 0x01, 0xd5, 0xa6, 0x0e, 0x91, 0x42,
+  0xbf, 0x78, 0x61, 0x6d, 0xe1, 0x93, 0xe3, 0x79, 0x8b, 0x37, 0x6e, 0xfa, 0x5e, 0xf7, 0xb0, 0x7b,
+  0x58, 0x6c, 0xa0, 0xb5, 0xd3, 0xa3, 0x65, 0x25, 0xee, 0x42, 0x0a, 0x1f, 0x2e, 0xba, 0xc7, 0x18,
+  0x9e, 0x3b, 0x94, 0xab, 0xdf, 0x7a, 0xdf, 0x98, 0x08, 0xa8, 0xff, 0x53, 0x6e, 0xdf, 0x5d, 0x19,
+  0xf6, 0x7e, 0xf3, 0xbb, 0x7e, 0x6e, 0x05, 0x6d, 0x04, 0x03, 0xca, 0x5b, 0xb7, 0x94, 0xaf, 0x07,
+  0xdd, 0x76, 0x61, 0x0f, 0x20, 0x91, 0xfc, 0x9d, 0x90, 0xc4, 0x63, 0x31, 0x19, 0xb6, 0x6d, 0x95,
+  0x9b, 0x60, 0xa6, 0x90, 0xbb, 0xc4, 0xb0, 0x2c, 0x35, 0x06, 0x89, 0x75, 0x99, 0x02, 0x24, 0x86,
+  0x03, 0x1c, 0x72, 0xa2, 0x11, 0xbc, 0xdf, 0xb1, 0x1b, 0xd0, 0x87, 0xb7, 0xed, 0xdd, 0x0a, 0xad,
+  0xee, 0xe6, 0xba, 0x6e, 0xfb, 0x72, 0xc7, 0x40, 0x3f, 0x86, 0x46, 0xd0, 0xb3, 0xc1, 0xa9, 0x1a,
+  0xfb, 0x17, 0xe7, 0x57, 0x3b, 0xe5, 0xef, 0xff, 0x92, 0xed, 0xc4, 0x63, 0xe8, 0xa1, 0x54, 0x2f,
+  0x55, 0x59, 0xeb, 0xc8, 0x7a, 0x45, 0x22, 0x34, 0xc7, 0x53, 0x28, 0xb9, 0x28, 0xba, 0x38, 0xbf,
+  0x8b, 0xba, 0xce, 0x01, 0xfa, 0xf0, 0xf1, 0x73, 0x84, 0x5f, 0x7d, 0x7b, 0x71, 0x3e, 0x55, 0x73,
+  0xd6, 0x4e, 0x77, 0x55, 0x5a, 0x71, 0x43, 0xb4, 0x24, 0xa0, 0x7b, 0x2e, 0xff, 0x86, 0xdd, 0xd6,
+  0x45, 0xfb, 0xe6, 0xaf, 0x80, 0x97, 0x8a, 0xf6, 0x90, 0x98, 0x0a, 0x11, 0xfd, 0xec, 0xaa, 0x7d,
+  0x65, 0x63, 0x51, 0x5a, 0x52, 0xa3, 0x1e, 0x9a, 0x0b, 0x08, 0x41, 0x92, 0x63, 0x7e, 0xab, 0x05,
+  0x1f, 0x83, 0xff, 0x51, 0x12, 0x66, 0xaf, 0x5f, 0x8a, 0x6c, 0xdd, 0x7c, 0x5b, 0x10, 0x6d, 0x10,
+  0x3c, 0x81, 0x55, 0x80, 0xde, 0x1e, 0x48, 0x4c, 0x9c, 0x08, 0xe2, 0x07, 0x8f, 0x49, 0xb9, 0xe6,
+  0x12, 0x14, 0x4b, 0xc4, 0x26, 0xf0, 0x92, 0xe8, 0x30, 0x3e, 0x06, 0x88, 0x20, 0xf5, 0xdc, 0xb3,
+  0x1a, 0xc4, 0xce, 0x53, 0xef, 0xb2, 0x06, 0x51, 0x6f, 0xba, 0x0c, 0x29, 0x3e, 0x71, 0x52, 0x46,
+  0x4e, 0x21, 0x29, 0x3d, 0x24, 0x01, 0xce, 0x42, 0x01, 0xa1, 0xad, 0xc0, 0x25, 0x58, 0x46, 0xec,
+  0x25, 0xa4, 0x4d, 0xa0, 0xe6, 0xd9, 0x28, 0xa2, 0xc2, 0x35, 0xda, 0x6e, 0x59, 0x51, 0x54, 0x41,
+  0xe8, 0xc3, 0x21, 0x5c, 0x4c, 0x56, 0x47, 0x2f, 0x5e, 0x20, 0xcb, 0x2a, 0x5f, 0xea, 0x8e, 0x0e,
+  0xde, 0x47, 0xdb, 0xdf, 0x73, 0x2e, 0xdf, 0x29, 0x22, 0x07, 0x0a, 0x6e, 0x54, 0xb7, 0x8b, 0xd0,
+  0x40, 0x77, 0x57, 0x5f, 0xa0, 0x9e, 0xdc, 0xca, 0x0c, 0x4a, 0x0e, 0xe9, 0x0c, 0x38, 0xa4, 0xeb,
+  0xdc, 0x65, 0x42, 0x92, 0x69, 0x08, 0x87, 0x84, 0x09, 0x30, 0x8c, 0xac, 0xed, 0x63, 0x2a, 0x9b,
+  0x11, 0x1d, 0x25, 0xcb, 0xcd, 0x84, 0x6e, 0x9a, 0xe2, 0x32, 0xa5, 0x5f, 0x23, 0x9f, 0x6f, 0x64,
+  0x65, 0x90, 0x29, 0x86, 0xb6, 0xb0, 0x65, 0x35, 0x16, 0x11, 0x11, 0x93, 0xc4, 0xef, 0x59, 0xcf,
+  0x9e, 0x1e, 0x9f, 0x58, 0x0d, 0x79, 0x6e, 0x22, 0x8c, 0xf7, 0x16, 0xd6, 0x03, 0x7d, 0x45, 0xd5,
+  0x3c, 0x81, 0x2e, 0x1e, 0x32, 0x35, 0x4e, 0x53, 0x70, 0x8c, 0xea, 0x5b, 0x5b, 0x67, 0xcd, 0xd9,
+  0x6c, 0xd6, 0x94, 0x1d, 0x78, 0x33, 0x63, 0x60, 0x07, 0x0f, 0x42, 0xc8, 0xb7, 0x96, 0xea, 0x2e,
+  0xa6, 0x67, 0xc9, 0x5a, 0xeb, 0x02, 0x42, 0xd4, 0xf4, 0xaf, 0x3e, 0x7b, 0xf2, 0x20, 0x89, 0x52,
+  0xe8, 0x8a, 0x63, 0x28, 0x54, 0x1c, 0x6a, 0xf0, 0xad, 0x54, 0x35, 0x95, 0xdb, 0xde, 0xa7, 0x33,
+  0x7b, 0xb9, 0x52, 0x0f, 0x98, 0x23, 0x7b, 0xf6, 0xba, 0x6d, 0xeb, 0x19, 0x51, 0xc9, 0xe3, 0xc2,
+  0x75, 0xad, 0xa7, 0x1f, 0x59, 0xf6, 0x62, 0x86, 0xa9, 0x78, 0xa0, 0xd5, 0x81, 0x0d, 0x1a, 0x90,
+  0x67, 0x74, 0x52, 0xa9, 0x46, 0xe1, 0x16, 0x48, 0xcb, 0x08, 0x90, 0x40, 0x16, 0xd7, 0x4c, 0xc4,
+  0x3a, 0xbe, 0x4c, 0x70, 0xc9, 0x3c, 0xb7, 0xd8, 0x15, 0x2c, 0xe5, 0xa9, 0x25, 0x0f, 0x18, 0xeb,
+  0x1a, 0x41, 0xa2, 0x02, 0xa0, 0xbf, 0xd6, 0x66, 0x18, 0x37, 0x6d, 0xe9, 0x34, 0xfa, 0x28, 0x80,
+  0xe4, 0x0a, 0xd5, 0x11, 0xba, 0x8c, 0x2c, 0x16, 0x34, 0x94, 0x0f, 0x13, 0xcc, 0x11, 0x44, 0xd6,
+  0x93, 0x67, 0x28, 0x61, 0x00, 0xa3, 0x53, 0xc2, 0x51, 0x96, 0x96, 0xdd, 0xc5, 0x9a, 0xa5, 0xca,
+  0xfe, 0x62, 0xb3, 0x68, 0xab, 0xf2, 0xda, 0xb2, 0xec, 0x8a, 0x27, 0x74, 0x71, 0x35, 0x33, 0x7e,
+  0xc5, 0x13, 0xbe, 0x63, 0xc4, 0x24, 0xfe, 0xad, 0x5b, 0xbe, 0x6a, 0xb5, 0x20, 0x85, 0x57, 0x8a,
+  0xeb, 0x46, 0xca, 0xfb, 0x32, 0xb7, 0x11, 0x24, 0xe0, 0x1b, 0xfa, 0xc0, 0x83, 0x12, 0x91, 0x44,
+  0x80, 0xae, 0x29, 0x9a, 0x93, 0x18, 0xba, 0x27, 0xe0, 0x47, 0xa6, 0xe8, 0x94, 0xcc, 0x31, 0x4c,
+  0xc0, 0x71, 0x35, 0x84, 0x8c, 0x08, 0x67, 0x09, 0x59, 0x45, 0xe5, 0xd9, 0xc8, 0xb9, 0x7e, 0x62,
+  0x84, 0x00, 0x5c, 0xc9, 0x80, 0xe5, 0x19, 0x2f, 0x99, 0x0e, 0x65, 0xfa, 0xad, 0xf8, 0x2b, 0x2f,
+  0xd1, 0x21, 0x3c, 0x37, 0xd5, 0xed, 0x80, 0x84, 0x08, 0xe7, 0xfb, 0x96, 0x3e, 0xc2, 0x14, 0x2c,
+  0x77, 0x77, 0xfe, 0xe5, 0xd1, 0xd0, 0x36, 0x72, 0x99, 0xa3, 0x21, 0x1c, 0xd9, 0xe4, 0xcd, 0x47,
+  0xc1, 0x62, 0xad, 0x6c, 0x2e, 0x66, 0x34, 0xf6, 0x93, 0x99, 0xb3, 0x7a, 0x38, 0xb4, 0x5a, 0x56,
+  0x7f, 0xd9, 0x38, 0x28, 0xcb, 0xa7, 0x2a, 0x2e, 0xda, 0xea, 0x2a, 0x81, 0xda, 0xd7, 0x80, 0xb8,
+  0x21, 0xbd, 0x2e, 0xd0, 0xf3, 0x1d, 0x74, 0x53, 0x70, 0x50, 0xa9, 0xc5, 0xab, 0x12, 0x6f, 0x83,
+  0xd3, 0x5a, 0xb1, 0x5f, 0x5e, 0x11, 0x84, 0x15, 0xd3, 0x3f, 0x87, 0x02, 0x13, 0x23, 0xb0, 0xff,
+  0xc5, 0x79, 0x54, 0x44, 0xcc, 0x5b, 0x44, 0x65, 0x55, 0xf0, 0x37, 0x12, 0x58, 0x57, 0xa0, 0xb7,
+  0x0e, 0x85, 0xd5, 0x40, 0x30, 0x36, 0xbb, 0x02, 0x79, 0xbf, 0xc6, 0x90, 0x61, 0x01, 0x74, 0x60,
+  0x04, 0x5d, 0x55, 0x75, 0xf4, 0xac, 0xa1, 0xed, 0x9d, 0xb1, 0xb6, 0x93, 0x81, 0xba, 0x81, 0xb9,
+  0x64, 0xe9, 0xb2, 0xb6, 0x6a, 0x5b, 0x69, 0x22, 0x55, 0x81, 0x6d, 0x95, 0xa8, 0x1e, 0xc2, 0x72,
+  0xad, 0x30, 0x32, 0x17, 0x06, 0x13, 0x08, 0x69, 0xa8, 0x64, 0xb5, 0xab, 0x76, 0xcc, 0xab, 0x7c,
+  0x9e, 0x9a, 0xea, 0xb6, 0x31, 0xe1, 0x0d, 0x60, 0x18, 0x50, 0x16, 0xd5, 0xf5, 0x3d, 0xd5, 0xa8,
+  0xc0, 0x87, 0x0c, 0x7a, 0x40, 0xc9, 0x94, 0xf0, 0x08, 0xf2, 0x02, 0xb4, 0x4b, 0xc4, 0xa7, 0x17,
+  0x2f, 0x69, 0x4c, 0x9f, 0x13, 0x44, 0x22, 0x48, 0x8f, 0x11, 0xe5, 0x72, 0x74, 0x17, 0x4e, 0x14,
+  0x65, 0x83, 0xb9, 0xbd, 0x74, 0x0a, 0xcd, 0x88, 0x86, 0xf4, 0xea, 0x53, 0x51, 0xd9, 0xd8, 0x6d,
+  0x20, 0xc3, 0x2f, 0xd4, 0xdf, 0x28, 0xa3, 0x6f, 0x5e, 0xc5, 0x76, 0x77, 0x87, 0xeb, 0x42, 0xfb,
+  0xd4, 0x41, 0x5f, 0x40, 0x8e, 0x54, 0x6d, 0x22, 0x87, 0xa3, 0x3a, 0x19, 0x81, 0x26, 0x4c, 0x69,
+  0xff, 0xf6, 0x69, 0xf1, 0xdd, 0x32, 0x9b, 0xba, 0xb5, 0xbb, 0x92, 0xc3, 0x76, 0xb8, 0xad, 0xac,
+  0xcd, 0xd1, 0x75, 0x9d, 0xe4, 0xf1, 0xff, 0xab, 0xe0, 0x17, 0xdf, 0x01, 0xbe, 0xa6, 0x6f, 0x57,
+  0xbd, 0xef, 0x41, 0x99, 0x6a, 0xaa, 0xef, 0x2b, 0xa8, 0x2e, 0xba, 0xe0, 0x72, 0x74, 0x7c, 0x72,
+  0xaf, 0xa8, 0xe5, 0x3d, 0x94, 0x66, 0x7c, 0x42, 0x7c, 0x34, 0x9a, 0xab, 0x9a, 0x1e, 0x42, 0x9d,
+  0x46, 0x3a, 0xcb, 0xc0, 0x2f, 0x46, 0x70, 0xd4, 0x90, 0x7c, 0x64, 0x76, 0x82, 0xb3, 0x19, 0x4a,
+  0xe2, 0x70, 0x0e, 0x48, 0x51, 0xa4, 0xfa, 0x35, 0xa0, 0x1f, 0x4a, 0x3e, 0x3e, 0xc5, 0x34, 0xc4,
+  0xa3, 0x90, 0x94, 0xf5, 0x3d, 0x89, 0x3f, 0x07, 0x5c, 0x3e, 0xc8, 0x73, 0x50, 0x19, 0x54, 0x6f,
+  0xe1, 0x53, 0xd9, 0xa2, 0xbe, 0x0d, 0x14, 0x5c, 0xe3, 0x50, 0x83, 0xe8, 0x77, 0xce, 0x5d, 0x5b,
+  0x7a, 0x87, 0x32, 0x33, 0xc8, 0xee, 0xe1, 0x8b, 0x2d, 0xdd, 0x81, 0xee, 0x1b, 0x46, 0x64, 0x1a,
+  0x92, 0x39, 0x2d, 0x7a, 0x85, 0x2b, 0x43, 0xe2, 0x0d, 0x2a, 0x72, 0x37, 0xaf, 0x71, 0x4b, 0x59,
+  0x33, 0xca, 0x0b, 0xbc, 0x30, 0x94, 0x2e, 0xd0, 0x96, 0x97, 0x37, 0x3d, 0x72, 0xe6, 0x01, 0xf4,
+  0x6b, 0xc2, 0x6d, 0x57, 0x8e, 0x02, 0x30, 0xf9, 0x44, 0xde, 0x3f, 0xc3, 0x61, 0x40, 0x9e, 0x9e,
+  0xf3, 0xe7, 0x0a, 0x28, 0x8b, 0x75, 0xfb, 0xfb, 0x5a, 0xb6, 0x77, 0x68, 0xd1, 0x76, 0xd4, 0x26,
+  0x95, 0x02, 0xe4, 0x35, 0x52, 0xb1, 0x7d, 0x55, 0xae, 0xe2, 0xbc, 0x8a, 0x36, 0x61, 0x95, 0xbf,
+  0xd2, 0x7d, 0xf6, 0x66, 0x89, 0x30, 0x5b, 0x16, 0x3a, 0x0c, 0x65, 0x0f, 0x71, 0xd9, 0x56, 0x2a,
+  0x32, 0x1b, 0x9d, 0xdb, 0xca, 0xa6, 0xcb, 0x1a, 0xac, 0x35, 0xa6, 0x7f, 0x24, 0xcf, 0x72, 0xc7,
+  0x49, 0xc6, 0x3c, 0x52, 0x98, 0x34, 0x00, 0xdc, 0xf3, 0xaa, 0x39, 0x09, 0x77, 0xd5, 0x15, 0x51,
+  0x49, 0x6b, 0xec, 0xa4, 0x4e, 0x82, 0x5c, 0x5f, 0xb5, 0x10, 0xee, 0x60, 0xdf, 0x57, 0x34, 0x1f,
+  0xcb, 0xea, 0x01, 0x88, 0xaa, 0x5b, 0xda, 0x86, 0x70, 0x04, 0xcd, 0x4d, 0x55, 0xe1, 0x9d, 0x73,
+  0xf7, 0xdd, 0x5f, 0x1e, 0x3f, 0xfd, 0xd4, 0x49, 0xe5, 0xd7, 0xfa, 0x75, 0x00, 0x29, 0xe4, 0x84,
+  0x52, 0x45, 0xdf, 0x91, 0xbe, 0xb0, 0x17, 0xc0, 0xdd, 0x0b, 0x13, 0x20, 0xb0, 0xfb, 0x9b, 0xd6,
+  0x5a, 0x16, 0x37, 0x8b, 0x40, 0x06, 0xb1, 0x21, 0x7b, 0x31, 0x37, 0xef, 0x55, 0xf6, 0xf7, 0xd5,
+  0x9e, 0x43, 0xf7, 0xbd, 0x15, 0x2e, 0x25, 0x92, 0xfa, 0x4b, 0xc8, 0x2b, 0x45, 0x2a, 0xac, 0xcc,
+  0x57, 0x81, 0xb7, 0xfd, 0xbe, 0x7f, 0x51, 0x13, 0x6c, 0xbe, 0xa8, 0xad, 0x94, 0x55, 0x79, 0xe1,
+  0xcf, 0xf5, 0x85, 0x7f, 0x0c, 0xc7, 0x8c, 0x57, 0xdf, 0xc7, 0x57, 0xd4, 0xd3, 0xdf, 0xc6, 0xbf,
+  0x8d, 0xe5, 0x22, 0x48, 0x52, 0x2a, 0xf0, 0xf0, 0x1c, 0xb3, 0x50, 0xf6, 0xc8, 0x08, 0x22, 0x2d,
+  0xb8, 0x38, 0x87, 0x41, 0x8c, 0x3d, 0x3c, 0x6d, 0xe8, 0x0e, 0x0e, 0x02, 0xf8, 0xe2, 0xdc, 0x93,
+  0xb5, 0x2a, 0x61, 0x99, 0x7a, 0xe1, 0x40, 0x45, 0x5e, 0xe4, 0xa7, 0xd9, 0xb5, 0x70, 0x3e, 0x2e,
+  0x58, 0x54, 0x6e, 0x28, 0xaf, 0xa8, 0xc4, 0xd5, 0x48, 0x50, 0x7a, 0x37, 0x23, 0x50, 0x7b, 0x5b,
+  0x09, 0xbe, 0xb4, 0x00, 0xaf, 0x14, 0xdf, 0xad, 0x27, 0x94, 0xe2, 0x28, 0x70, 0x03, 0x6d, 0x5a,
+  0xed, 0xd5, 0x0f, 0xe1, 0xab, 0x1f, 0xae, 0x12, 0x59, 0xa7, 0x96, 0x37, 0x48, 0x2b, 0xa6, 0x75,
+  0xd6, 0xee, 0xbe, 0xb4, 0xe4, 0xed, 0xac, 0x46, 0xb2, 0x67, 0xab, 0x55, 0xee, 0x80, 0xae, 0x75,
+  0x40, 0x5d, 0xbd, 0xd1, 0xd9, 0x5d, 0xe9, 0x56, 0xef, 0x71, 0x88, 0x69, 0x9a, 0xcd, 0x66, 0xc5,
+  0x2d, 0x46, 0x2e, 0x65, 0xc1, 0xd1, 0xde, 0xb2, 0xb0, 0x0a, 0xdf, 0x8d, 0x6f, 0x94, 0xd6, 0x40,
+  0x9b, 0x7f, 0xb5, 0x14, 0xc9, 0xaf, 0x96, 0xc6, 0xe0, 0x87, 0x6b, 0x60, 0x76, 0xb3, 0x7f, 0x44,
+  0x49, 0x18, 0x61, 0x1f, 0x0e, 0x19, 0xab, 0x40, 0x95, 0x57, 0xf5, 0xaf, 0xbe, 0xc5, 0xe0, 0x67,
+  0x70, 0xb8, 0xc1, 0x6b, 0xde, 0x41, 0xae, 0x19, 0x6f, 0x43, 0x8e, 0x6a, 0x0b, 0xf9, 0x06, 0xb0,
+  0xf5, 0xa0, 0x4f, 0x1e, 0x93, 0xed, 0xb8, 0xfd, 0x29, 0x6e, 0x60, 0x24, 0x63, 0x37, 0xd1, 0xc2,
+  0xbe, 0x73, 0x20, 0x6c, 0x51, 0x5a, 0xb6, 0xa0, 0xd5, 0xb6, 0x34, 0x91, 0xd9, 0x11, 0xa3, 0x0f,
+  0x08, 0x01, 0xc9, 0x7f, 0x7f, 0xef, 0x99, 0x6c, 0x4d, 0xd5, 0x17, 0x98, 0xa3, 0xfc, 0xae, 0x2a,
+  0xfe, 0x49, 0xa3, 0xe4, 0xf6, 0x4f, 0x1a, 0x25, 0x6a, 0xbb, 0x6b, 0xde, 0xe3, 0xec, 0x66, 0xa8,
+  0x12, 0xf2, 0xa0, 0x65, 0xbe, 0xe2, 0x1c, 0xb4, 0xf4, 0x9f, 0x1e, 0xb4, 0xd4, 0x1f, 0x88, 0xd5,
+  0xfe, 0x07, 0x60, 0x84, 0x3b, 0x2a, 0x38, 0x26, 0x00, 0x00,
+};
+constexpr size_t WIFI_SETUP_PAGE_GZ_LEN = 3386;
+const GzipPage WIFI_SETUP_PAGE_GZ = { WIFI_SETUP_PAGE_GZ_DATA, WIFI_SETUP_PAGE_GZ_LEN, "\"a30f649d80fd189f\"" };
+
+// ONLINE_STATUS_PAGE: 7101 bytes -> 2858 bytes gzip + state
+const uint8_t ONLINE_STATUS_PAGE_HEAD[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x94, 0x56, 0xdd, 0x6e, 0xe3, 0x44,
+  0x14, 0xbe, 0xcf, 0x53, 0x1c, 0xb6, 0x42, 0x4e, 0x50, 0x9d, 0xd8, 0xd9, 0xd6, 0x4d, 0x9d, 0x1f,
+  0xd1, 0xc2, 0x82, 0x56, 0x68, 0xb5, 0x88, 0x16, 0x71, 0x3d, 0xb6, 0xc7, 0xf6, 0x28, 0xf6, 0x8c,
+  0x35, 0x33, 0x4e, 0x9a, 0x46, 0xb9, 0xe3, 0x12, 0x69, 0x91, 0xe0, 0x06, 0x84, 0xd4, 0x4b, 0x6e,
+  0xb7, 0x37, 0x88, 0xfb, 0x2d, 0x2f, 0xd2, 0x17, 0x80, 0x47, 0xe0, 0x8c, 0xed, 0x34, 0x5e, 0xb2,
+  0x5a, 0xba, 0xb2, 0xda, 0x78, 0xc6, 0x67, 0xbe, 0xf3, 0x9d, 0xef, 0xfc, 0xd8, 0x9d, 0xc9, 0x47,
+  0x91, 0x08, 0xf5, 0xaa, 0xa0, 0x90, 0xea, 0x3c, 0x9b, 0x4d, 0x9a, 0xff, 0x94, 0x44, 0xb3, 0x49,
+  0x4e, 0x35, 0x81, 0x30, 0x25, 0x52, 0x51, 0x3d, 0xb5, 0x4a, 0x1d, 0xdb, 0x23, 0x6b, 0xd0, 0x6c,
+  0x73, 0x92, 0xd3, 0xa9, 0xb5, 0x60, 0x74, 0x59, 0x08, 0xa9, 0x2d, 0x08, 0x05, 0xd7, 0x94, 0xa3,
+  0xd9, 0x92, 0x45, 0x3a, 0x9d, 0x46, 0x74, 0xc1, 0x42, 0x6a, 0x57, 0x8b, 0x43, 0xc6, 0x99, 0x66,
+  0x24, 0xb3, 0x55, 0x48, 0x32, 0x3a, 0x75, 0x0d, 0x86, 0x66, 0x3a, 0xa3, 0xb3, 0x97, 0x3c, 0x63,
+  0x9c, 0xc2, 0x0b, 0x11, 0x4d, 0x06, 0xf5, 0x4e, 0x67, 0xa2, 0xf4, 0x0a, 0x7f, 0x7d, 0x29, 0x84,
+  0x5e, 0xdb, 0x76, 0x90, 0xf8, 0x07, 0xb1, 0x17, 0x9f, 0xc4, 0xa7, 0x63, 0xdb, 0x8e, 0x71, 0xe1,
+  0xba, 0x2e, 0xde, 0x85, 0x44, 0x46, 0xf8, 0x20, 0x8e, 0xf1, 0x3e, 0x2f, 0x35, 0xc5, 0x85, 0xe7,
+  0x79, 0xb8, 0x20, 0x61, 0x88, 0x2c, 0xd0, 0x8c, 0x9c, 0x3c, 0xa5, 0x23, 0xdc, 0x10, 0x73, 0xff,
+  0xc0, 0x89, 0x4e, 0x8f, 0x46, 0x66, 0xb1, 0x24, 0x92, 0xe3, 0xb1, 0xe3, 0x53, 0xea, 0x04, 0x9b,
+  0xce, 0xa7, 0x39, 0x8d, 0x18, 0x81, 0x6e, 0x21, 0x69, 0x4c, 0xa5, 0xb2, 0x43, 0x91, 0x09, 0x89,
+  0x24, 0x53, 0x9a, 0x53, 0x3f, 0x22, 0x72, 0xde, 0x5b, 0xb7, 0x69, 0x38, 0x14, 0x7d, 0x7b, 0x0d,
+  0x0d, 0xea, 0x99, 0xeb, 0x81, 0x89, 0xeb, 0xb9, 0xc1, 0x70, 0xb8, 0x23, 0x43, 0x1c, 0x73, 0x35,
+  0xee, 0xdd, 0xa3, 0x60, 0x44, 0xbc, 0x9d, 0xfb, 0x20, 0x88, 0x87, 0x47, 0x9b, 0x4d, 0xe7, 0x93,
+  0x75, 0x20, 0xae, 0x6c, 0xc5, 0xae, 0x19, 0x4f, 0xfc, 0x40, 0xc8, 0x88, 0x4a, 0x1b, 0x77, 0x36,
+  0x26, 0x05, 0x87, 0x81, 0x88, 0x56, 0xeb, 0x94, 0xb2, 0x24, 0xd5, 0xbe, 0xeb, 0x38, 0x1f, 0x8f,
+  0x73, 0x22, 0x13, 0xc6, 0x7d, 0x67, 0x53, 0x3d, 0x09, 0x48, 0x38, 0x4f, 0xa4, 0x28, 0x79, 0xe4,
+  0x2f, 0x88, 0xec, 0x1a, 0x86, 0xbd, 0x71, 0x15, 0x40, 0xb3, 0x8e, 0x71, 0x1d, 0x63, 0x4e, 0x7c,
+  0xf7, 0xa8, 0xb8, 0x02, 0xb5, 0x52, 0x9a, 0xe6, 0x76, 0xc9, 0x0e, 0x15, 0xe1, 0xca, 0x56, 0x54,
+  0xb2, 0x78, 0x1c, 0x31, 0x55, 0x64, 0x64, 0xe5, 0x27, 0x92, 0x45, 0x63, 0xbc, 0xc3, 0x7c, 0x31,
+  0xb4, 0x52, 0xbe, 0x91, 0x90, 0xca, 0x4d, 0xa7, 0x6f, 0x82, 0x5b, 0x57, 0x39, 0xf4, 0x73, 0xc6,
+  0xbb, 0xa7, 0xc3, 0xc5, 0xf2, 0xf0, 0x68, 0xe8, 0x14, 0x57, 0xbd, 0xf1, 0x1e, 0x01, 0x63, 0x8b,
+  0xdb, 0x75, 0x18, 0x92, 0x44, 0xac, 0x54, 0xbe, 0x3b, 0x2c, 0xae, 0xc6, 0x55, 0x90, 0x29, 0x89,
+  0xc4, 0xd2, 0x77, 0x00, 0x37, 0x60, 0x84, 0x7f, 0x32, 0x09, 0x48, 0xd7, 0x39, 0x34, 0x57, 0xdf,
+  0x19, 0xf5, 0xc6, 0x05, 0x89, 0x22, 0x23, 0x83, 0x01, 0xdf, 0x74, 0xd2, 0xe1, 0x7a, 0x1b, 0x2e,
+  0x38, 0xe0, 0x7a, 0x88, 0xa2, 0xe9, 0x95, 0xb6, 0x49, 0xc6, 0x12, 0xde, 0xd0, 0xab, 0xa2, 0x33,
+  0xea, 0x51, 0xdf, 0xed, 0x3f, 0x95, 0x34, 0x47, 0xbe, 0x8c, 0xc7, 0x62, 0x5f, 0x1a, 0x31, 0xdf,
+  0x4a, 0x53, 0x55, 0xcc, 0xd6, 0x55, 0x43, 0xae, 0xcd, 0x17, 0x99, 0x6d, 0x75, 0x36, 0x4f, 0xc1,
+  0xd9, 0x77, 0x8b, 0x5e, 0x94, 0x26, 0xba, 0x54, 0x6d, 0x3f, 0x07, 0x94, 0xc6, 0xc3, 0xd8, 0xdb,
+  0x41, 0x3b, 0x7b, 0xd0, 0xde, 0x0e, 0x7a, 0x54, 0x21, 0xef, 0xe8, 0xf7, 0x4f, 0x6b, 0xf6, 0x35,
+  0x2e, 0x64, 0x24, 0xa0, 0xd9, 0xba, 0x9d, 0xcb, 0xaa, 0xa8, 0x7a, 0xed, 0x13, 0xa3, 0x63, 0x3c,
+  0xf2, 0x90, 0xc0, 0x20, 0x13, 0xe1, 0xbc, 0x41, 0xc7, 0x0a, 0xd2, 0x5a, 0xe4, 0xfe, 0x91, 0xd1,
+  0x71, 0x0b, 0xd9, 0x5f, 0x90, 0x6c, 0x5d, 0x1d, 0x5f, 0xd6, 0x15, 0xe5, 0x39, 0xce, 0x5b, 0xfa,
+  0xb9, 0x15, 0x83, 0xa0, 0xc4, 0xa3, 0xbc, 0x49, 0x78, 0xab, 0xe8, 0x6c, 0x2d, 0x8a, 0x3a, 0xa6,
+  0x87, 0x00, 0xdd, 0x87, 0x00, 0x7d, 0x67, 0xbf, 0x16, 0x1a, 0xc2, 0x2d, 0xd1, 0xf7, 0xc5, 0xf8,
+  0x2f, 0x9d, 0xb0, 0x94, 0x0a, 0xad, 0x0b, 0xc1, 0x6a, 0x99, 0x6b, 0x32, 0xfd, 0x42, 0x32, 0x24,
+  0xf1, 0x8e, 0x82, 0xaf, 0x3b, 0xbd, 0xb7, 0x69, 0xec, 0x4c, 0x6f, 0xed, 0x1b, 0x99, 0xdd, 0xde,
+  0xa6, 0x73, 0x90, 0xab, 0x64, 0xbd, 0x5f, 0x41, 0xad, 0xe8, 0x46, 0x5b, 0x46, 0x6d, 0x7d, 0xdf,
+  0x91, 0x03, 0x6c, 0x03, 0x7b, 0xdb, 0x95, 0x46, 0xb2, 0xc9, 0xa0, 0x9e, 0x57, 0x93, 0x41, 0x3d,
+  0x32, 0x4d, 0x73, 0xce, 0x26, 0x11, 0x5b, 0x40, 0x98, 0x11, 0xa5, 0xa6, 0x96, 0x69, 0x0b, 0x0b,
+  0x07, 0xea, 0x70, 0xf6, 0xcf, 0xcd, 0x0f, 0x3f, 0xc2, 0x6e, 0xe2, 0xc1, 0xd9, 0x5c, 0xb3, 0x18,
+  0xcf, 0x0d, 0x71, 0xe8, 0xb5, 0x0e, 0x98, 0x1a, 0xb6, 0x66, 0xf7, 0xbf, 0xfd, 0x04, 0xdf, 0xb1,
+  0x2f, 0x18, 0x9c, 0x93, 0xbb, 0x9b, 0xec, 0xee, 0x76, 0x32, 0x40, 0x93, 0xb7, 0x0d, 0xeb, 0xdc,
+  0x22, 0x76, 0x55, 0x30, 0xb3, 0xca, 0xfa, 0xec, 0xee, 0xc6, 0xd8, 0xd6, 0x3b, 0x6d, 0x63, 0x2c,
+  0x00, 0x0b, 0x58, 0x84, 0xa7, 0x14, 0x43, 0x3e, 0x76, 0x8d, 0xf7, 0xff, 0xa8, 0xcf, 0xbf, 0x86,
+  0xb3, 0x48, 0x52, 0xc5, 0xde, 0x0b, 0xca, 0x8a, 0x0f, 0x80, 0x7c, 0x71, 0xf6, 0xd9, 0x63, 0x30,
+  0x73, 0x12, 0x5a, 0x50, 0x89, 0x3b, 0xb5, 0x76, 0x99, 0x71, 0xaa, 0x66, 0xf9, 0x00, 0x6f, 0xe7,
+  0x58, 0x12, 0x94, 0x47, 0xef, 0x75, 0x15, 0xd4, 0x36, 0xd6, 0xec, 0x2b, 0xf4, 0x23, 0x45, 0x06,
+  0xf8, 0x5e, 0xc8, 0xd8, 0x4a, 0xc8, 0x7e, 0xbf, 0xff, 0xb6, 0x9f, 0x62, 0xcb, 0x68, 0xbf, 0x98,
+  0x1e, 0xd3, 0xb0, 0xed, 0x76, 0xc2, 0x1e, 0xb0, 0x66, 0x9d, 0x73, 0xaa, 0x32, 0x7c, 0xdd, 0xc0,
+  0x35, 0xc9, 0x09, 0xcf, 0x88, 0xbc, 0xbb, 0x85, 0x86, 0x0d, 0xa8, 0x92, 0x97, 0x61, 0x19, 0x11,
+  0x0e, 0x02, 0x1b, 0x9a, 0x68, 0x36, 0x07, 0x82, 0x95, 0xc0, 0xef, 0x6e, 0x0d, 0x33, 0xb8, 0x7b,
+  0x8d, 0x23, 0x1d, 0xdf, 0xcc, 0x9c, 0x5d, 0x03, 0xf9, 0xeb, 0x86, 0x98, 0xcc, 0x1b, 0xe3, 0x79,
+  0x13, 0x83, 0x22, 0xab, 0x98, 0x28, 0xb4, 0x27, 0x90, 0xd0, 0x37, 0xbf, 0xb3, 0x02, 0x42, 0x96,
+  0x12, 0xb4, 0x5d, 0x11, 0x59, 0x39, 0x42, 0x20, 0xe8, 0x8a, 0x38, 0xae, 0x0a, 0x72, 0x6b, 0x0d,
+  0x09, 0x0b, 0x58, 0x0f, 0x56, 0x6f, 0xfe, 0xe0, 0x54, 0xd3, 0x00, 0x65, 0x90, 0x0a, 0x5f, 0xdf,
+  0xd7, 0x7d, 0xac, 0xf4, 0x02, 0x05, 0xa8, 0xbb, 0x6d, 0xab, 0x60, 0xd3, 0x9c, 0x16, 0x08, 0x1e,
+  0x66, 0x2c, 0x9c, 0xa3, 0xfa, 0x2b, 0x1e, 0x5e, 0xe0, 0x1b, 0x34, 0x2a, 0x33, 0xda, 0xed, 0x59,
+  0x58, 0xf4, 0x3f, 0x7f, 0x0f, 0x97, 0x64, 0xbe, 0x60, 0x39, 0x83, 0x0b, 0xca, 0xe7, 0x52, 0x20,
+  0x1a, 0x85, 0x67, 0x7a, 0x32, 0xa8, 0xb1, 0x76, 0xa0, 0x8d, 0xb4, 0xed, 0xb9, 0x5a, 0xbf, 0xc6,
+  0x5b, 0xf8, 0x89, 0xb8, 0x14, 0xdf, 0x50, 0x12, 0xea, 0xb3, 0xa2, 0xa8, 0xf1, 0xb1, 0xa9, 0xaa,
+  0x0d, 0xf8, 0x76, 0x95, 0x94, 0x19, 0xca, 0x58, 0xc7, 0xfc, 0x25, 0x7b, 0x9c, 0x07, 0x2f, 0x38,
+  0x19, 0x8e, 0x9c, 0x9d, 0x87, 0x27, 0x38, 0x4b, 0x51, 0x6b, 0x9c, 0x28, 0x29, 0x7e, 0x16, 0x4c,
+  0xad, 0x41, 0x58, 0xeb, 0x69, 0x3d, 0x99, 0xdd, 0xff, 0xfa, 0xcb, 0xdf, 0x7f, 0xbe, 0x82, 0x6d,
+  0x91, 0x5c, 0x34, 0x92, 0x3d, 0xca, 0xcd, 0x28, 0x38, 0x0e, 0x63, 0xaf, 0x15, 0x08, 0xd6, 0x3f,
+  0xd5, 0x97, 0x02, 0x07, 0x01, 0xbd, 0xa0, 0x19, 0x0d, 0x8d, 0xcb, 0x07, 0xc1, 0xce, 0x4d, 0x42,
+  0xe1, 0x73, 0x4c, 0x02, 0x74, 0xcd, 0xa8, 0xb8, 0x30, 0x09, 0xcc, 0x59, 0x6f, 0xdf, 0x55, 0x93,
+  0x08, 0x33, 0xe7, 0xda, 0x59, 0x58, 0x32, 0x1d, 0xa6, 0x97, 0xe2, 0x65, 0x9d, 0x5d, 0x83, 0x7b,
+  0xff, 0xea, 0x35, 0x34, 0x4b, 0x33, 0x7d, 0x50, 0x20, 0xc4, 0x6c, 0xe1, 0x99, 0xbe, 0xa8, 0xda,
+  0x4e, 0x25, 0xd6, 0x43, 0xb9, 0x37, 0x3f, 0x2a, 0x94, 0xac, 0xd0, 0xb3, 0xce, 0x60, 0x00, 0xcf,
+  0xeb, 0x4f, 0x39, 0x30, 0x5d, 0x46, 0x81, 0x71, 0xfc, 0x92, 0xc0, 0x52, 0x87, 0x60, 0x05, 0x3a,
+  0xa5, 0x50, 0x7f, 0xf5, 0x41, 0x97, 0x97, 0x59, 0x06, 0x2c, 0x06, 0x7c, 0xba, 0xc0, 0xa7, 0xc8,
+  0x26, 0x15, 0xa5, 0x06, 0xa6, 0x7b, 0x1d, 0x94, 0x53, 0x69, 0xb8, 0xb8, 0x3c, 0xbb, 0x7c, 0x36,
+  0xfd, 0x17, 0x00, 0x00, 0xff, 0xff,
+};
+const uint8_t ONLINE_STATUS_PAGE_TAIL[] PROGMEM = {
+  0xed, 0x57, 0x4f, 0x6f, 0xdb, 0x36, 0x14, 0xbf, 0xe7, 0x53, 0xb0, 0xdd, 0x81, 0x16, 0x62, 0xcb,
+  0xf9, 0x83, 0x76, 0x9b, 0x1d, 0x7b, 0x48, 0xb3, 0x76, 0xcd, 0x9a, 0x2e, 0x41, 0xec, 0xae, 0x18,
+  0x50, 0xa0, 0x60, 0xa5, 0x27, 0x9b, 0xb3, 0x44, 0x6a, 0x14, 0x6d, 0x57, 0x4d, 0x7c, 0xdc, 0x6d,
+  0xc0, 0x0e, 0xbb, 0x0d, 0x1d, 0xba, 0x5b, 0xcf, 0xb9, 0x14, 0x3b, 0xe4, 0x66, 0xf7, 0x8b, 0xf4,
+  0x0b, 0xec, 0x2b, 0xec, 0x91, 0x92, 0x15, 0xd9, 0x4e, 0xd3, 0x04, 0xbb, 0xec, 0xb0, 0x06, 0x68,
+  0x20, 0xf2, 0xf1, 0xf1, 0xf1, 0xfd, 0xfe, 0x90, 0x69, 0xae, 0x05, 0x43, 0xe1, 0x69, 0x2e, 0x05,
+  0x49, 0xfa, 0x72, 0xfc, 0x94, 0x07, 0xbc, 0xe2, 0x3b, 0x27, 0x6b, 0x04, 0xff, 0xf1, 0xa0, 0xe2,
+  0xbb, 0x9e, 0x14, 0x02, 0x3c, 0x0d, 0xf3, 0x41, 0x42, 0x92, 0x84, 0xfb, 0x2e, 0xc7, 0x51, 0xd5,
+  0x85, 0x97, 0xba, 0xe5, 0xbb, 0x66, 0xe0, 0xf4, 0x94, 0xde, 0xe3, 0x21, 0x17, 0x11, 0x4f, 0xa5,
+  0xa2, 0xcd, 0x3c, 0x14, 0x17, 0x27, 0x9a, 0xf0, 0x78, 0xd7, 0xf7, 0x15, 0x06, 0xf2, 0x18, 0xc3,
+  0x36, 0x5c, 0xfb, 0x53, 0xc4, 0xf0, 0xb8, 0x94, 0x2c, 0x0b, 0x2d, 0xa6, 0x82, 0x4a, 0xbe, 0xb6,
+  0xd5, 0x2a, 0xd6, 0x9d, 0x9e, 0x5e, 0x8c, 0xd1, 0xa2, 0xa8, 0x8b, 0x3c, 0x0f, 0xbb, 0x8f, 0x0f,
+  0x5a, 0x74, 0x27, 0x89, 0x19, 0x1e, 0x49, 0xa7, 0x21, 0xb4, 0x6e, 0x7b, 0x32, 0x94, 0xaa, 0xf1,
+  0x99, 0xef, 0x6d, 0xdd, 0xdd, 0xba, 0x7b, 0xbb, 0xbd, 0x7f, 0x44, 0x58, 0x38, 0x3b, 0x13, 0x2c,
+  0x62, 0xfe, 0xec, 0x8c, 0xd4, 0xc8, 0xb1, 0x1c, 0x6a, 0x50, 0xe4, 0xeb, 0x87, 0x7b, 0x47, 0x64,
+  0x20, 0x85, 0x56, 0x32, 0x24, 0xe0, 0x73, 0xb1, 0x53, 0x37, 0x59, 0xda, 0x45, 0xa9, 0x84, 0xbc,
+  0x60, 0xde, 0x00, 0x84, 0x7f, 0x83, 0x9d, 0x52, 0x39, 0xc0, 0x1d, 0xee, 0x65, 0xeb, 0x08, 0x28,
+  0xfe, 0xfe, 0x0d, 0x0f, 0x21, 0x82, 0x57, 0xcb, 0xc9, 0x27, 0x10, 0x26, 0x70, 0x71, 0x9c, 0x7a,
+  0x9d, 0xec, 0xf5, 0xc1, 0x1b, 0xcc, 0xb7, 0x24, 0x39, 0x10, 0x7c, 0xc4, 0x75, 0x5a, 0x44, 0x79,
+  0x26, 0x24, 0x4f, 0x9e, 0xf7, 0xca, 0x29, 0x12, 0xae, 0xad, 0xa4, 0x5d, 0x82, 0x8e, 0xde, 0x63,
+  0xb3, 0x37, 0xd8, 0x09, 0xe2, 0xc3, 0x0c, 0xab, 0xba, 0x1c, 0x12, 0xfa, 0x83, 0x1c, 0x14, 0x33,
+  0x37, 0x3c, 0xff, 0x53, 0xfe, 0x80, 0xe3, 0x9a, 0xf2, 0x26, 0x8b, 0xc7, 0x9e, 0xac, 0x4d, 0x16,
+  0x09, 0xd8, 0xd1, 0x4c, 0x0f, 0x93, 0x9c, 0x82, 0x96, 0x80, 0x11, 0xf3, 0x9c, 0x13, 0xfc, 0x6f,
+  0x81, 0x72, 0xf8, 0xdd, 0x5c, 0x58, 0x3b, 0x8c, 0x7d, 0xa6, 0x21, 0x5f, 0x6d, 0x17, 0x07, 0xa0,
+  0xbd, 0x7e, 0x85, 0xd6, 0x59, 0xcc, 0xeb, 0x63, 0xa4, 0x75, 0x2d, 0xb1, 0x93, 0x75, 0xea, 0xb8,
+  0xba, 0x0f, 0xa2, 0xa2, 0x5a, 0x6d, 0xe5, 0xfe, 0x98, 0x48, 0x51, 0x71, 0xf2, 0x91, 0xb9, 0x00,
+  0x1c, 0xd7, 0x63, 0x66, 0x6d, 0xc5, 0x69, 0xb5, 0xb3, 0xce, 0x2d, 0xf7, 0x6d, 0xf7, 0x68, 0x9f,
+  0xf4, 0x99, 0x66, 0xc9, 0xec, 0x2c, 0x3f, 0xc8, 0x62, 0xcb, 0x1e, 0x5d, 0x90, 0x08, 0xb1, 0x2e,
+  0x24, 0x31, 0xb1, 0xd8, 0x20, 0xb2, 0xdf, 0x80, 0x26, 0x8f, 0x77, 0xf7, 0x08, 0x43, 0xbc, 0x20,
+  0x49, 0x96, 0xaa, 0xed, 0x81, 0xbe, 0x5e, 0xb1, 0xd9, 0x71, 0x17, 0xca, 0x35, 0x5b, 0x94, 0xda,
+  0xb2, 0xc0, 0x0f, 0x1f, 0x46, 0xdc, 0x83, 0xfd, 0x23, 0xdb, 0x9e, 0x05, 0x24, 0x57, 0xab, 0x36,
+  0x35, 0xbb, 0xae, 0x6b, 0xcb, 0x9e, 0x87, 0x5a, 0x8c, 0x5d, 0x0b, 0x71, 0x8b, 0x8e, 0x98, 0xaa,
+  0xd4, 0x6a, 0xd1, 0xd0, 0x38, 0x03, 0xcd, 0x8f, 0xd5, 0x55, 0x29, 0xd1, 0x92, 0xc4, 0x5c, 0xf4,
+  0x0a, 0xda, 0xea, 0xbe, 0x92, 0xc3, 0x5e, 0x9f, 0x64, 0x9b, 0x63, 0x5c, 0x02, 0xba, 0xcb, 0x23,
+  0x40, 0xc9, 0x95, 0x1a, 0x7c, 0x3d, 0x5e, 0x65, 0x7b, 0xca, 0x81, 0x73, 0xbb, 0xfd, 0xe1, 0xf5,
+  0x6f, 0xe4, 0x50, 0xcb, 0x88, 0x69, 0x3e, 0x28, 0x34, 0xcb, 0x06, 0x9a, 0x07, 0x8b, 0x04, 0xbb,
+  0xa2, 0x76, 0xcc, 0x93, 0xa1, 0x52, 0xdd, 0xdc, 0xd8, 0xd8, 0xb0, 0x7d, 0x43, 0xc2, 0x75, 0xba,
+  0xbb, 0xdd, 0xfb, 0xce, 0x49, 0x61, 0x86, 0xf6, 0xdb, 0x35, 0x04, 0x72, 0x9a, 0x25, 0x82, 0x66,
+  0xc3, 0x19, 0x4a, 0x4e, 0x33, 0x13, 0xd9, 0x22, 0x07, 0x91, 0x9f, 0xd8, 0x92, 0x63, 0x08, 0x10,
+  0xe1, 0x3e, 0x19, 0x23, 0x66, 0xd8, 0x0b, 0x20, 0x21, 0x1f, 0x01, 0xc9, 0xd6, 0xe1, 0x2f, 0x05,
+  0x2c, 0x22, 0x0a, 0x62, 0xa9, 0x74, 0x42, 0x18, 0xb1, 0x7a, 0xf1, 0xfa, 0x4c, 0xf4, 0xa0, 0x49,
+  0x62, 0x19, 0x86, 0x64, 0xcc, 0x75, 0x1f, 0x5b, 0x45, 0xb8, 0xbe, 0x00, 0xd5, 0x4c, 0x14, 0x4c,
+  0xc7, 0x76, 0xee, 0x0b, 0x74, 0xaf, 0x11, 0x0b, 0x2b, 0xe5, 0x02, 0xaa, 0x77, 0xec, 0xa1, 0xec,
+  0x99, 0xc6, 0x5c, 0xf8, 0x72, 0xec, 0xde, 0x1f, 0x81, 0xd0, 0x1d, 0x39, 0x54, 0x1e, 0x58, 0x0a,
+  0x84, 0xc8, 0xc2, 0x80, 0xf1, 0x30, 0x69, 0x6d, 0x98, 0x3e, 0x64, 0x66, 0x0d, 0x49, 0x4b, 0xc0,
+  0x98, 0x94, 0x62, 0x73, 0x56, 0x82, 0x19, 0x49, 0xa8, 0xa5, 0x30, 0x24, 0x2e, 0x52, 0xd7, 0xc6,
+  0x1c, 0xf0, 0x44, 0x03, 0x82, 0x56, 0xa1, 0xd9, 0xa1, 0x68, 0x15, 0xe6, 0xa0, 0x96, 0x72, 0xcf,
+  0xb3, 0xfb, 0xad, 0x6f, 0x3b, 0x87, 0xdf, 0xb9, 0x31, 0x53, 0x09, 0x54, 0xc0, 0xc5, 0x72, 0x59,
+  0xee, 0x57, 0x58, 0x26, 0x35, 0x5d, 0xa6, 0x84, 0x0b, 0x62, 0xae, 0x13, 0x85, 0xa2, 0xcb, 0x3e,
+  0x9c, 0xd5, 0xce, 0xce, 0xb5, 0x84, 0x85, 0x48, 0xdc, 0x5c, 0x21, 0xaa, 0x96, 0x4c, 0x98, 0x65,
+  0x7d, 0xdd, 0xee, 0xdb, 0x6e, 0x6d, 0x3b, 0x27, 0x38, 0xed, 0x85, 0x12, 0xb7, 0x72, 0x9a, 0xe5,
+  0xa6, 0x35, 0x27, 0x13, 0x44, 0x7b, 0x6e, 0x8c, 0x0b, 0x33, 0x0b, 0x7e, 0x94, 0x0a, 0xaf, 0x83,
+  0x0a, 0xf2, 0x87, 0x21, 0x18, 0x4f, 0x89, 0x92, 0x5e, 0x59, 0x2e, 0x5d, 0x36, 0x18, 0xf1, 0x08,
+  0xf9, 0x2c, 0x06, 0x4a, 0x0a, 0xfe, 0x0a, 0x96, 0x84, 0x63, 0xc2, 0x2f, 0xa1, 0x1d, 0xf3, 0x3c,
+  0x6c, 0x9b, 0xa1, 0x5e, 0x59, 0xf3, 0x66, 0xaf, 0x5a, 0x92, 0x6f, 0x56, 0xa7, 0xd5, 0x93, 0x08,
+  0x10, 0x78, 0xbf, 0x41, 0x8f, 0x0e, 0x3b, 0x5d, 0x3a, 0x71, 0xd6, 0x4a, 0x3e, 0xa0, 0x71, 0xfb,
+  0xc2, 0x07, 0xb4, 0xe9, 0xf6, 0x52, 0x65, 0x1f, 0x5e, 0xff, 0x4c, 0x2e, 0xaf, 0xce, 0xe7, 0xb7,
+  0x48, 0x07, 0x2f, 0x21, 0x16, 0x92, 0x08, 0x47, 0xf5, 0xf4, 0x9d, 0x9a, 0x9e, 0x2f, 0xdc, 0x79,
+  0x57, 0x54, 0x9e, 0x09, 0x66, 0x59, 0xbf, 0x4b, 0x7b, 0xd3, 0x49, 0x75, 0x3b, 0x97, 0x13, 0x16,
+  0x5d, 0x72, 0xa6, 0xe5, 0x1a, 0xff, 0xf8, 0x05, 0x2b, 0xc9, 0x8b, 0x63, 0x49, 0x8a, 0xfd, 0x2e,
+  0x1c, 0x75, 0x65, 0xff, 0xfc, 0x42, 0xa1, 0x4b, 0xee, 0xd6, 0x93, 0x5d, 0x79, 0x0c, 0xcc, 0xd3,
+  0xbb, 0x71, 0x6c, 0x00, 0xba, 0xb1, 0x89, 0xfa, 0xa6, 0x79, 0x17, 0xb7, 0x4c, 0x26, 0x58, 0xcc,
+  0x47, 0x58, 0x1c, 0x93, 0x27, 0xc7, 0x07, 0x78, 0x73, 0x7f, 0xcf, 0x35, 0x18, 0xf3, 0xc2, 0x4e,
+  0xaa, 0x11, 0x3e, 0x12, 0xac, 0xfe, 0x94, 0x26, 0x77, 0x36, 0x3f, 0xdf, 0x5e, 0xcb, 0x48, 0xad,
+  0xcc, 0x92, 0x27, 0x2a, 0x6c, 0xd1, 0xbe, 0xd6, 0x71, 0xa3, 0x5e, 0xdf, 0xfc, 0x72, 0xcb, 0xdd,
+  0xbc, 0xfb, 0x85, 0xbb, 0xe9, 0xa2, 0xb3, 0x34, 0x4c, 0x64, 0x3d, 0xb3, 0xbf, 0x3a, 0x5d, 0x07,
+  0xe1, 0x49, 0x1f, 0x9e, 0x1c, 0xef, 0xef, 0xc9, 0x28, 0x46, 0xee, 0x0a, 0x9d, 0xef, 0xde, 0x5c,
+  0x46, 0x31, 0xab, 0x64, 0x98, 0xf6, 0x86, 0x21, 0xbe, 0x54, 0x12, 0xf3, 0x60, 0x21, 0xe9, 0xf4,
+  0x9d, 0x08, 0xd1, 0xcf, 0xb8, 0xba, 0x11, 0xd3, 0x72, 0x03, 0x90, 0xb1, 0xe9, 0x42, 0x5e, 0x6d,
+  0x95, 0x3e, 0x7f, 0x11, 0x32, 0x31, 0x30, 0x8a, 0xfe, 0x34, 0xa6, 0x5b, 0x39, 0xa6, 0x99, 0x68,
+  0x58, 0x08, 0x4a, 0x57, 0x68, 0x76, 0x85, 0xa1, 0xbf, 0xf1, 0xf2, 0x83, 0xca, 0x25, 0x07, 0xd3,
+  0x73, 0x1d, 0x18, 0xbf, 0x83, 0x81, 0x62, 0x0a, 0xbb, 0x27, 0x20, 0x35, 0xcc, 0xb2, 0xe8, 0x4d,
+  0x16, 0xee, 0xab, 0x3c, 0x93, 0x7d, 0x88, 0x30, 0xa1, 0xf1, 0x99, 0x90, 0xb3, 0xc0, 0x25, 0x1f,
+  0xc9, 0x4e, 0x9d, 0x25, 0x16, 0x60, 0x04, 0x96, 0x2f, 0x1f, 0x63, 0x5b, 0x3b, 0x10, 0x82, 0x1d,
+  0x34, 0x6c, 0x40, 0x5c, 0x6f, 0x21, 0x40, 0x01, 0x57, 0x11, 0x96, 0x2a, 0x7d, 0x44, 0x70, 0xfa,
+  0x96, 0x47, 0x5c, 0x20, 0x9e, 0xd8, 0xc6, 0x08, 0x06, 0xc4, 0x78, 0x97, 0xcf, 0xf1, 0x59, 0x92,
+  0x09, 0x04, 0xe7, 0x48, 0xc4, 0x13, 0xf3, 0xf5, 0xd5, 0x33, 0xf1, 0x4c, 0x98, 0x45, 0xe8, 0xd6,
+  0xd6, 0x95, 0x59, 0xca, 0x54, 0xc8, 0x14, 0x16, 0x88, 0xc5, 0x05, 0xb3, 0x33, 0xfc, 0x10, 0xcc,
+  0x63, 0x83, 0x2a, 0x79, 0x85, 0x85, 0x89, 0x90, 0xa5, 0xb3, 0x33, 0x0f, 0x67, 0x07, 0x52, 0x0d,
+  0xed, 0x04, 0x16, 0xea, 0x9c, 0x28, 0xd0, 0x43, 0x25, 0x26, 0xcb, 0xd0, 0x76, 0x8a, 0x14, 0xb3,
+  0xb3, 0x4f, 0xa1, 0x38, 0x66, 0x4a, 0x2c, 0xbb, 0x85, 0x3d, 0x72, 0x2d, 0xc2, 0x13, 0xdf, 0xd8,
+  0x2a, 0xb0, 0x2b, 0x1a, 0x5f, 0xce, 0x87, 0x8f, 0xa8, 0x73, 0xa9, 0x6f, 0xac, 0x36, 0x6a, 0x7a,
+  0x1e, 0xfa, 0xd3, 0xf3, 0x4f, 0xfa, 0x82, 0x2f, 0xbd, 0x61, 0x84, 0x7c, 0x73, 0x7f, 0x1a, 0x82,
+  0x4a, 0x33, 0x24, 0x24, 0x5e, 0x0b, 0xb8, 0x41, 0x20, 0x51, 0x82, 0xa5, 0xab, 0xfd, 0xc3, 0xef,
+  0x7f, 0xfe, 0xfd, 0xd7, 0xaf, 0xe4, 0xe2, 0x75, 0x68, 0x91, 0x4f, 0x4c, 0xf7, 0x10, 0x6d, 0x34,
+  0x29, 0x97, 0xec, 0xe0, 0xdd, 0x28, 0x45, 0xaf, 0xfd, 0x00, 0xc0, 0x07, 0xf5, 0x7c, 0xf7, 0x08,
+  0xaf, 0xf5, 0x6c, 0x84, 0xe0, 0x02, 0xab, 0x85, 0x7c, 0xe5, 0xec, 0x2c, 0x2e, 0xa2, 0x4b, 0xc2,
+  0x2b, 0xc5, 0x5b, 0x0e, 0x09, 0x84, 0x70, 0xfa, 0x16, 0x17, 0xba, 0xd7, 0xa8, 0x35, 0x3b, 0xa4,
+  0x79, 0x3b, 0xf4, 0xf0, 0xf5, 0x22, 0xfc, 0x65, 0x2c, 0x32, 0x19, 0x5c, 0xe2, 0x68, 0x0f, 0x91,
+  0xbc, 0x0d, 0x42, 0xd7, 0xf5, 0x15, 0x1e, 0x76, 0x0d, 0x63, 0x5c, 0x95, 0xc3, 0xf5, 0x4d, 0x31,
+  0xc1, 0x27, 0x83, 0xd7, 0xef, 0xca, 0xc3, 0x20, 0xc0, 0xbf, 0xc7, 0x60, 0x45, 0x09, 0xf9, 0x38,
+  0xfa, 0xbf, 0xcf, 0x48, 0x0f, 0x91, 0xbe, 0x86, 0x10, 0x3e, 0x86, 0x14, 0x78, 0xb8, 0x16, 0x15,
+  0xb2, 0x28, 0x01, 0xcc, 0x8c, 0x12, 0xb0, 0xb9, 0xb3, 0x90, 0xab, 0xa4, 0x60, 0xf8, 0x66, 0xff,
+  0x32, 0x78, 0xff, 0x46, 0x5f, 0xcb, 0xd5, 0x2e, 0xd3, 0x43, 0xf6, 0x64, 0xba, 0x5c, 0x10, 0xd5,
+  0x3e, 0x30, 0xa4, 0x50, 0xd2, 0x38, 0xa1, 0x7b, 0x78, 0xcf, 0x21, 0xea, 0xb5, 0x6e, 0x1a, 0x03,
+  0x6d, 0x50, 0x34, 0xf9, 0x90, 0x23, 0x10, 0xd8, 0xb5, 0xfa, 0xcb, 0xda, 0x78, 0x3c, 0xae, 0x05,
+  0x52, 0x45, 0xb5, 0xa1, 0x0a, 0x33, 0x93, 0xf6, 0xd1, 0xf7, 0x5e, 0x48, 0x3f, 0x6d, 0x50, 0x93,
+  0xb8, 0x25, 0xb3, 0xc6, 0xfd, 0x6b, 0x85, 0xad, 0x00, 0x60, 0x19, 0xff, 0xbf, 0xbc, 0xfe, 0xd3,
+  0xf2, 0xc2, 0xf3, 0x7a, 0x8a, 0xc7, 0xba, 0xbd, 0x53, 0x37, 0x94, 0xc0, 0x5f, 0x7d, 0x1d, 0x85,
+  0xed, 0xb5, 0x7f, 0x00,
+};
+const SplicedPage ONLINE_STATUS_PAGE_SPLICED = {
+  ONLINE_STATUS_PAGE_HEAD, sizeof(ONLINE_STATUS_PAGE_HEAD), ONLINE_STATUS_PAGE_TAIL, sizeof(ONLINE_STATUS_PAGE_TAIL),
+  0x872948c3UL, 0x794161c4UL, 0xd6b9935eUL, 7101
+};
+
+// SCHEDULER_PAGE: 11641 bytes -> 3912 bytes gzip + state
+const uint8_t SCHEDULER_PAGE_HEAD[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x9c, 0x58, 0xcd, 0x8e, 0xe3, 0xc6,
+  0x11, 0xbe, 0xeb, 0x29, 0x3a, 0x18, 0x04, 0x94, 0x00, 0x51, 0x43, 0x69, 0x67, 0xb8, 0x12, 0xf5,
+  0x83, 0xac, 0xed, 0xdd, 0xc0, 0xc8, 0xda, 0x0b, 0xac, 0xc6, 0x08, 0x8c, 0xc0, 0x87, 0x16, 0xbb,
+  0x28, 0x75, 0x86, 0x64, 0x13, 0xdd, 0x4d, 0x69, 0x64, 0x61, 0x6e, 0x39, 0x06, 0x48, 0x0e, 0x39,
+  0xe5, 0x62, 0xdf, 0x72, 0xcd, 0xd1, 0x67, 0xe7, 0x4d, 0xf2, 0x02, 0xc9, 0x23, 0xa4, 0xba, 0xf9,
+  0x23, 0x52, 0xd2, 0x4c, 0xd6, 0x83, 0x01, 0xb4, 0x62, 0xb1, 0xab, 0xea, 0xeb, 0xaf, 0x7e, 0xb5,
+  0x9d, 0xd9, 0xaf, 0x98, 0x08, 0xf5, 0x3e, 0x03, 0xb2, 0xd1, 0x49, 0xbc, 0x98, 0x95, 0x9f, 0x40,
+  0xd9, 0x62, 0x96, 0x80, 0xa6, 0x24, 0xdc, 0x50, 0xa9, 0x40, 0xcf, 0x9d, 0x5c, 0x47, 0xee, 0xd8,
+  0xb9, 0x5e, 0x74, 0x0a, 0x79, 0x4a, 0x13, 0x98, 0x3b, 0x5b, 0x0e, 0xbb, 0x4c, 0x48, 0xed, 0x90,
+  0x50, 0xa4, 0x1a, 0x52, 0x3c, 0xb7, 0xe3, 0x4c, 0x6f, 0xe6, 0x0c, 0xb6, 0x3c, 0x04, 0xd7, 0x3e,
+  0xf4, 0x79, 0xca, 0x35, 0xa7, 0xb1, 0xab, 0x42, 0x1a, 0xc3, 0x7c, 0x68, 0x8d, 0x68, 0xae, 0x63,
+  0x58, 0xbc, 0x03, 0x60, 0x20, 0xc9, 0x32, 0xdc, 0x00, 0xcb, 0x63, 0x90, 0xb3, 0xeb, 0x42, 0xde,
+  0x99, 0x29, 0xbd, 0x37, 0xff, 0x06, 0x52, 0x08, 0x7d, 0x70, 0xdd, 0xd5, 0x3a, 0xb8, 0x8a, 0xfc,
+  0xe8, 0x75, 0x34, 0x99, 0xba, 0x6e, 0x84, 0x0f, 0xc3, 0xe1, 0x10, 0xbf, 0x85, 0x54, 0x32, 0x7c,
+  0x11, 0x45, 0xf8, 0x3d, 0xc9, 0x35, 0xe0, 0x83, 0xef, 0xfb, 0xf8, 0x40, 0xc3, 0x10, 0xd1, 0xe0,
+  0x31, 0xfa, 0xfa, 0x15, 0x8c, 0x51, 0x90, 0xf1, 0x38, 0x0e, 0xae, 0x00, 0xa2, 0x51, 0x64, 0xde,
+  0xab, 0x1c, 0x0f, 0x28, 0x15, 0x5c, 0x79, 0x6c, 0x72, 0x33, 0x1e, 0x3f, 0x76, 0x7e, 0x93, 0x00,
+  0xe3, 0x94, 0x74, 0x33, 0x09, 0x11, 0x48, 0xe5, 0x86, 0x22, 0x16, 0x12, 0x11, 0x6f, 0x20, 0x81,
+  0x80, 0x51, 0x79, 0xdf, 0x3b, 0x34, 0xb1, 0x78, 0x80, 0x00, 0xfc, 0x12, 0x0b, 0xf8, 0xe6, 0xaf,
+  0x86, 0x33, 0xf4, 0x87, 0xab, 0xd1, 0xe8, 0x88, 0x88, 0x7a, 0xe6, 0xaf, 0xc6, 0x30, 0x8c, 0x46,
+  0xfe, 0x2b, 0xaf, 0x89, 0x61, 0x78, 0xb3, 0x1a, 0x53, 0xff, 0xf1, 0xb1, 0x63, 0xd8, 0xef, 0xaf,
+  0x04, 0xdb, 0x1f, 0x36, 0xc0, 0xd7, 0x1b, 0x1d, 0x0c, 0x3d, 0xef, 0xd7, 0x8f, 0x1d, 0x2b, 0x49,
+  0xa8, 0x5c, 0xf3, 0x34, 0xf0, 0xa6, 0x2b, 0x1a, 0xde, 0xaf, 0xa5, 0xc8, 0x53, 0x16, 0x6c, 0xa9,
+  0xec, 0x1a, 0x3c, 0xbd, 0xa9, 0x85, 0x5b, 0x3e, 0x47, 0xf8, 0x1c, 0x61, 0x38, 0xdc, 0x88, 0x26,
+  0x3c, 0xde, 0x07, 0x6a, 0xaf, 0x34, 0x24, 0x6e, 0xce, 0xfb, 0x2e, 0xcd, 0xb2, 0x18, 0xdc, 0x42,
+  0xd0, 0x5f, 0xc2, 0x5a, 0x00, 0xf9, 0xe6, 0xcb, 0xfe, 0x47, 0xb1, 0x12, 0x5a, 0xf4, 0xbf, 0x59,
+  0xe5, 0xa9, 0xce, 0xfb, 0x8a, 0xa6, 0xca, 0x55, 0x20, 0x79, 0x34, 0x65, 0x5c, 0x65, 0x31, 0xdd,
+  0x07, 0x6b, 0xc9, 0xd9, 0x14, 0xbf, 0x61, 0x44, 0x39, 0x6a, 0xaa, 0xc0, 0x90, 0x0b, 0xf2, 0xb1,
+  0x33, 0x30, 0x37, 0x3e, 0xd8, 0x28, 0x07, 0x09, 0x4f, 0xbb, 0x93, 0xd1, 0x76, 0xd7, 0xbf, 0xf1,
+  0xbd, 0xec, 0xa1, 0x77, 0x8e, 0xd3, 0x9c, 0x45, 0xb1, 0x90, 0x18, 0x72, 0x57, 0x52, 0xc6, 0x73,
+  0x15, 0x0c, 0x47, 0xd9, 0x03, 0x8a, 0x1e, 0x5c, 0xb5, 0xa1, 0x4c, 0xec, 0x02, 0x8f, 0xa0, 0x80,
+  0x18, 0x29, 0x91, 0xeb, 0x15, 0xed, 0x7a, 0x7d, 0xf3, 0x37, 0xf0, 0xc6, 0xbd, 0x69, 0x46, 0x19,
+  0xe3, 0xe9, 0x3a, 0x18, 0xfa, 0xe6, 0x84, 0x5f, 0x1e, 0x43, 0xd2, 0x46, 0x35, 0x37, 0xc4, 0xb3,
+  0xb2, 0xa9, 0x86, 0x07, 0xed, 0xd2, 0x98, 0xaf, 0xd3, 0x12, 0x69, 0xc1, 0xc7, 0xae, 0x20, 0xd5,
+  0xf7, 0xbc, 0xc7, 0x4e, 0xc4, 0x21, 0x66, 0x98, 0xd8, 0x87, 0x02, 0x0f, 0xf2, 0x5a, 0x1a, 0xb1,
+  0xbe, 0xbd, 0xda, 0x1b, 0x1e, 0x8d, 0x61, 0x0d, 0x29, 0x3b, 0x58, 0x13, 0x8a, 0x7f, 0x0f, 0xc1,
+  0x60, 0x72, 0x2b, 0x21, 0x29, 0x15, 0x5c, 0xe4, 0x4e, 0x8b, 0x24, 0x40, 0x40, 0xad, 0x28, 0xd8,
+  0xe0, 0xf7, 0x50, 0x9b, 0xae, 0x20, 0x3e, 0x54, 0x4c, 0xae, 0x62, 0x11, 0xde, 0x4f, 0x9b, 0xa6,
+  0xd0, 0xd2, 0x63, 0x87, 0xa7, 0x59, 0xae, 0xff, 0x60, 0xea, 0x70, 0xae, 0x79, 0x02, 0xdf, 0xf5,
+  0x1b, 0x82, 0x34, 0x4f, 0x56, 0x20, 0x5b, 0x22, 0x49, 0xd3, 0x35, 0x7c, 0x57, 0xf2, 0x6e, 0x72,
+  0xe4, 0x48, 0x8e, 0x67, 0xf9, 0xb4, 0x57, 0x1a, 0xe2, 0x45, 0x94, 0x88, 0x39, 0x23, 0x57, 0x61,
+  0xc4, 0x7c, 0xb8, 0x39, 0xe1, 0x7e, 0x6c, 0x8e, 0x1e, 0x83, 0xa4, 0xd1, 0xaa, 0xca, 0xa8, 0x44,
+  0xc2, 0xca, 0x8b, 0xf0, 0x74, 0x83, 0x69, 0xa0, 0x8b, 0xf8, 0xf0, 0xef, 0x8d, 0xfd, 0xd2, 0x02,
+  0x4a, 0x5a, 0xa0, 0x4b, 0x40, 0x0d, 0xd2, 0x06, 0x52, 0xec, 0x0e, 0xad, 0xfc, 0x31, 0x1f, 0x2e,
+  0x66, 0x0f, 0x4a, 0x34, 0x98, 0xfa, 0xca, 0x93, 0x14, 0x13, 0x20, 0x92, 0x84, 0xe6, 0x5a, 0x4c,
+  0xd7, 0x34, 0xb3, 0x88, 0x6c, 0xd8, 0x4e, 0xd2, 0x6c, 0x95, 0x23, 0xc5, 0xe9, 0x01, 0xb3, 0x17,
+  0x28, 0xba, 0x0a, 0x21, 0x48, 0x45, 0x0a, 0xd3, 0x3a, 0x74, 0x67, 0xa9, 0x56, 0x94, 0x7f, 0x55,
+  0x16, 0xb6, 0x41, 0x9c, 0xdf, 0xbd, 0xc9, 0x19, 0x19, 0xde, 0xa0, 0xe4, 0x24, 0x4b, 0xa6, 0x61,
+  0x2e, 0x15, 0xea, 0x67, 0x82, 0x37, 0x71, 0x04, 0x34, 0xd4, 0x7c, 0x0b, 0x07, 0x4b, 0x58, 0x24,
+  0x64, 0x52, 0x50, 0x67, 0xae, 0xf5, 0x6d, 0x17, 0x49, 0xef, 0x55, 0x07, 0x07, 0x0a, 0xb0, 0x2d,
+  0x62, 0xf3, 0xd8, 0x1f, 0xce, 0x10, 0x56, 0xe9, 0x71, 0x65, 0xe2, 0xad, 0x6a, 0xa6, 0xa2, 0x18,
+  0x10, 0x06, 0x7e, 0xb8, 0x3b, 0x89, 0x84, 0x98, 0x0f, 0xcb, 0x8c, 0xc9, 0xae, 0x32, 0xdf, 0xb4,
+  0xb0, 0x8f, 0x48, 0xb1, 0xe9, 0x27, 0xe7, 0x96, 0x8d, 0xf4, 0xb4, 0xcc, 0x26, 0x93, 0x49, 0xe3,
+  0xc2, 0x78, 0x55, 0x62, 0x08, 0xa8, 0x9c, 0xf2, 0x34, 0xe6, 0x29, 0xb8, 0xd6, 0xf7, 0x39, 0xfd,
+  0x95, 0xff, 0xd2, 0x21, 0x29, 0x83, 0xf1, 0x6c, 0xe6, 0x34, 0xef, 0x78, 0x2c, 0x25, 0x72, 0x63,
+  0xad, 0xec, 0x00, 0xee, 0x3f, 0x25, 0x35, 0x24, 0x60, 0xb8, 0x75, 0xf7, 0x75, 0x1f, 0x73, 0xa4,
+  0xd7, 0x40, 0x61, 0xf4, 0x49, 0xbb, 0xac, 0x9e, 0x82, 0xfe, 0xc7, 0x5c, 0x69, 0x1e, 0xed, 0xdd,
+  0x72, 0x3a, 0x55, 0xe2, 0x5f, 0x50, 0x20, 0x15, 0xf8, 0xb1, 0xed, 0x0a, 0x8d, 0xc2, 0x1d, 0xdf,
+  0xda, 0xca, 0x1d, 0x44, 0x66, 0x28, 0xb4, 0x70, 0x54, 0x99, 0xfc, 0x84, 0xf3, 0x46, 0x18, 0x6d,
+  0xb5, 0xb6, 0xa3, 0x8d, 0x19, 0x91, 0xa8, 0xf5, 0x01, 0x9b, 0xa9, 0x5b, 0xcd, 0x80, 0xc1, 0x08,
+  0x9b, 0xcd, 0x79, 0x4b, 0x3b, 0x4b, 0x07, 0xa5, 0xa9, 0xce, 0x95, 0xa9, 0xcd, 0x4f, 0x4b, 0x8a,
+  0x56, 0x0d, 0x8c, 0xea, 0x04, 0x3b, 0xbf, 0x6a, 0xd1, 0xa3, 0x1a, 0xf6, 0xc9, 0xa0, 0xa0, 0xff,
+  0x42, 0xb0, 0x4f, 0x19, 0x3a, 0xe9, 0x92, 0x37, 0x27, 0x48, 0xc9, 0x60, 0x4b, 0xe3, 0x1c, 0x0e,
+  0xa7, 0x95, 0x77, 0x34, 0x33, 0x1c, 0x0c, 0x8d, 0x99, 0xa6, 0xab, 0x72, 0x70, 0xf6, 0x8c, 0xa5,
+  0x7d, 0x1a, 0xba, 0xcd, 0x56, 0xd3, 0x8a, 0xc0, 0x85, 0x8c, 0x68, 0xb0, 0x36, 0x2e, 0xb0, 0x94,
+  0x16, 0xaa, 0xbc, 0x36, 0x06, 0x82, 0xe1, 0x63, 0x67, 0x76, 0x5d, 0xac, 0x20, 0xb3, 0xeb, 0x62,
+  0x1b, 0x32, 0x43, 0x18, 0x77, 0x22, 0xca, 0x53, 0x12, 0xc6, 0x54, 0xa9, 0xb9, 0x63, 0xe6, 0x99,
+  0x83, 0xab, 0xca, 0x66, 0x74, 0x61, 0x8f, 0x41, 0x61, 0x67, 0x56, 0x0d, 0x99, 0xc5, 0xac, 0x98,
+  0x21, 0x8b, 0x2f, 0xec, 0x5a, 0x44, 0x96, 0xf6, 0xfe, 0xb3, 0xeb, 0x52, 0xda, 0x99, 0x31, 0xbe,
+  0xad, 0xac, 0x1e, 0xb9, 0x71, 0xda, 0x2f, 0x2c, 0xe5, 0x4e, 0x65, 0xe2, 0x0e, 0xdb, 0x06, 0xe9,
+  0xbe, 0x17, 0xb8, 0x52, 0xf5, 0x66, 0xd7, 0x78, 0xac, 0x7d, 0xd8, 0xb2, 0xea, 0x10, 0xce, 0xe6,
+  0x4e, 0xb1, 0x8a, 0x99, 0xf3, 0xce, 0xe2, 0xbd, 0xa0, 0x26, 0xdc, 0x83, 0xc1, 0xa0, 0xd2, 0x39,
+  0x57, 0xfd, 0x7f, 0x00, 0xbe, 0x15, 0xb9, 0x24, 0x9f, 0x21, 0x63, 0xb8, 0x23, 0x58, 0x18, 0xcf,
+  0xbb, 0x5f, 0x15, 0x27, 0x0b, 0xff, 0xae, 0xfb, 0x8c, 0xdf, 0x32, 0x10, 0xc6, 0x6b, 0x11, 0x0b,
+  0xab, 0x6f, 0xc4, 0x9f, 0xe9, 0xd4, 0xa9, 0x8f, 0x55, 0x3d, 0xd5, 0x59, 0x2c, 0xf1, 0x55, 0x41,
+  0xc4, 0xd7, 0x62, 0x37, 0xbb, 0x2e, 0x94, 0xda, 0xda, 0xb8, 0xcd, 0x49, 0x50, 0x9b, 0x27, 0x0c,
+  0x7c, 0x2c, 0xde, 0xd6, 0xf1, 0xa8, 0x2d, 0x54, 0x20, 0xeb, 0x00, 0x5e, 0x88, 0xa5, 0x89, 0xb9,
+  0xf5, 0xae, 0x48, 0x17, 0xb6, 0x20, 0xf7, 0x84, 0xd1, 0x7d, 0xef, 0x72, 0x50, 0xed, 0xb5, 0x66,
+  0x76, 0x60, 0x5a, 0x58, 0xa6, 0xe9, 0x7f, 0x69, 0x9e, 0x1c, 0x62, 0xe7, 0xa7, 0x15, 0x38, 0x04,
+  0xd7, 0xb2, 0x6c, 0xee, 0xf8, 0x1e, 0x6e, 0xc8, 0xcd, 0x4b, 0x60, 0x8d, 0x16, 0xf4, 0xbd, 0x61,
+  0xac, 0x06, 0xd9, 0x64, 0xb0, 0x32, 0xa9, 0x9c, 0x52, 0xfc, 0x3c, 0xf2, 0xb7, 0x0f, 0x61, 0x9c,
+  0x33, 0x20, 0x5f, 0xd0, 0x3d, 0x62, 0x4f, 0x05, 0x89, 0xf0, 0x2a, 0x4f, 0x20, 0x37, 0xcd, 0xd6,
+  0x44, 0xc4, 0x06, 0xbf, 0xba, 0x42, 0x81, 0x19, 0x93, 0x3d, 0xbc, 0x37, 0x69, 0x52, 0x9f, 0x65,
+  0x0e, 0xb1, 0x91, 0x9f, 0x3b, 0xe6, 0x0a, 0xcb, 0x3c, 0x45, 0x9b, 0x56, 0xef, 0x17, 0xeb, 0x9b,
+  0x1f, 0x09, 0x5f, 0x89, 0x97, 0xeb, 0x8f, 0x50, 0xff, 0x2e, 0x87, 0x17, 0xeb, 0xbf, 0x42, 0xfd,
+  0xdf, 0x03, 0x7b, 0xb1, 0xfe, 0x8d, 0xf1, 0xbf, 0xc9, 0x5f, 0xac, 0x7f, 0x8b, 0xfa, 0xef, 0x24,
+  0x7f, 0xb1, 0xbe, 0x6f, 0xf8, 0xa7, 0xfa, 0xa8, 0xdf, 0xc8, 0x16, 0xdb, 0xd7, 0xe6, 0x4e, 0xb3,
+  0x53, 0x9f, 0x76, 0xd8, 0xb2, 0x99, 0x37, 0x9a, 0x25, 0x36, 0x6e, 0x67, 0xf1, 0xb9, 0xf1, 0x88,
+  0x59, 0xcf, 0x4c, 0xe2, 0xcc, 0xc9, 0xd7, 0x1f, 0x6c, 0xe6, 0x98, 0x86, 0xf2, 0x49, 0x15, 0xb3,
+  0x04, 0xb9, 0x15, 0x64, 0x09, 0x5a, 0xa3, 0x4a, 0xb3, 0xfd, 0x59, 0x90, 0x15, 0xae, 0xf6, 0xaa,
+  0xdc, 0x1e, 0x1f, 0x63, 0x83, 0xa2, 0x53, 0xd8, 0x79, 0x93, 0xae, 0x63, 0x08, 0xc8, 0x0c, 0x37,
+  0x8f, 0xb2, 0x4c, 0x8c, 0xe0, 0x7d, 0xd1, 0xa4, 0x26, 0xde, 0xcf, 0xff, 0xc4, 0x0e, 0x8e, 0xaf,
+  0xd0, 0xfc, 0xb1, 0xee, 0xec, 0x91, 0xaa, 0xe6, 0xec, 0xd2, 0xea, 0x10, 0x1c, 0xb5, 0x26, 0x5f,
+  0x49, 0x42, 0x1f, 0x30, 0xef, 0xc6, 0x5e, 0x55, 0x86, 0xb7, 0x35, 0x99, 0x13, 0x2b, 0xb3, 0xe0,
+  0x1a, 0x2b, 0xf7, 0x09, 0x39, 0xe6, 0x47, 0x6d, 0x3b, 0x5a, 0xcf, 0x5e, 0xa8, 0x1c, 0xdb, 0xa7,
+  0x63, 0x16, 0x6f, 0xf7, 0x21, 0x83, 0x94, 0xb0, 0x5c, 0x52, 0xcd, 0xb1, 0xfe, 0x1b, 0xe0, 0x37,
+  0x22, 0x66, 0x15, 0xf6, 0xe2, 0x47, 0x41, 0x09, 0x7e, 0x58, 0x82, 0xc7, 0xc6, 0x71, 0xcc, 0xdf,
+  0x36, 0xe2, 0xb1, 0x77, 0xbe, 0xef, 0xb5, 0xf0, 0xc4, 0x10, 0xe9, 0xf2, 0x1e, 0x04, 0x3b, 0x64,
+  0xe3, 0x2e, 0xcd, 0x90, 0x36, 0x1a, 0x83, 0xd9, 0x7b, 0x9c, 0x56, 0x9b, 0x52, 0x74, 0x8b, 0x3d,
+  0x6a, 0x89, 0x9f, 0xf5, 0x20, 0x3c, 0x76, 0xab, 0xc6, 0x39, 0x0d, 0x0a, 0x35, 0xef, 0xf0, 0x93,
+  0x98, 0x1e, 0x7a, 0xb1, 0xa3, 0x35, 0x9d, 0x54, 0x37, 0x69, 0x2e, 0x4e, 0x7e, 0xfd, 0x33, 0xa7,
+  0x78, 0x3e, 0xdb, 0xe4, 0xca, 0xc5, 0xa6, 0x78, 0x3b, 0xaa, 0xd6, 0x2c, 0xc6, 0x25, 0x84, 0x86,
+  0xd7, 0xa0, 0x58, 0x32, 0xab, 0x4d, 0xe1, 0x74, 0xe6, 0xec, 0xb8, 0x0e, 0x37, 0x1f, 0x2c, 0x4d,
+  0x76, 0x74, 0x94, 0x08, 0x1a, 0x6b, 0x55, 0xf5, 0x3f, 0x0b, 0xa7, 0xfb, 0x8e, 0xb3, 0xf8, 0xef,
+  0x0f, 0x7f, 0xfe, 0x2b, 0x29, 0x74, 0xc9, 0x57, 0x82, 0x51, 0xf2, 0x5b, 0xf8, 0xd7, 0x3f, 0x2e,
+  0x4f, 0xa7, 0x70, 0x63, 0x52, 0x10, 0x0f, 0x3d, 0xe9, 0x25, 0xba, 0x9d, 0x80, 0xb7, 0xba, 0xe8,
+  0xe5, 0x6f, 0x7f, 0x22, 0x9f, 0x5b, 0x7d, 0xe3, 0x05, 0x77, 0x81, 0xdf, 0x01, 0x64, 0x35, 0xf1,
+  0xbd, 0xa7, 0xc6, 0x21, 0xc6, 0xf1, 0x29, 0x5f, 0x2c, 0x1c, 0xf9, 0x23, 0xff, 0x82, 0xaf, 0x7f,
+  0xff, 0xfd, 0xc7, 0xff, 0xfc, 0xf4, 0x17, 0xf2, 0x0e, 0x7f, 0xf7, 0x08, 0x1c, 0x73, 0x1f, 0x8d,
+  0x11, 0xd2, 0x7d, 0x2b, 0xa9, 0x02, 0xf2, 0x26, 0x8e, 0x7b, 0xe7, 0x83, 0xb3, 0x1a, 0x4a, 0xb8,
+  0xca, 0x3a, 0x75, 0x5c, 0x55, 0x28, 0x79, 0xa6, 0x17, 0xdd, 0x28, 0x4f, 0x6d, 0x0c, 0xba, 0xbd,
+  0x43, 0x07, 0x47, 0x31, 0xa6, 0xc1, 0xf2, 0xee, 0xcd, 0xdd, 0xdb, 0xf9, 0xff, 0x00, 0x00, 0x00,
+  0xff, 0xff,
+};
+const uint8_t SCHEDULER_PAGE_TAIL[] PROGMEM = {
+  0xcd, 0x59, 0x41, 0x73, 0x1b, 0xb7, 0x15, 0xbe, 0xeb, 0x57, 0xac, 0x26, 0x33, 0xc1, 0xee, 0x98,
+  0x5c, 0xd1, 0x76, 0x9b, 0x56, 0xdc, 0xac, 0x32, 0xb6, 0x2a, 0x37, 0xee, 0xc8, 0x56, 0xc6, 0x64,
+  0xdb, 0x49, 0xa3, 0x1c, 0xa0, 0xdd, 0x47, 0x2e, 0x42, 0x10, 0x60, 0x01, 0x2c, 0x29, 0x4a, 0xe2,
+  0x4c, 0x0e, 0xb9, 0xf7, 0xd2, 0x53, 0x2f, 0xee, 0xf4, 0xd2, 0x6b, 0x73, 0xeb, 0xb9, 0xf5, 0x2f,
+  0xc9, 0x1f, 0x68, 0x7f, 0x42, 0x1f, 0x80, 0x25, 0xb5, 0x24, 0x45, 0x9a, 0x52, 0x3b, 0xa9, 0x67,
+  0x3c, 0x22, 0x89, 0x05, 0x1e, 0xde, 0xfb, 0xf0, 0xbd, 0xf7, 0x3e, 0xac, 0x93, 0xbd, 0x5e, 0x29,
+  0x32, 0xc3, 0xa4, 0x08, 0xca, 0x51, 0x4e, 0x0d, 0x3c, 0x13, 0x7d, 0x0e, 0xa7, 0xf4, 0x02, 0x78,
+  0x18, 0x5d, 0x67, 0x52, 0x68, 0x13, 0x00, 0x4f, 0x73, 0x99, 0x95, 0x43, 0x10, 0x26, 0xee, 0x83,
+  0x39, 0xe1, 0x60, 0xbf, 0x3e, 0x9f, 0xbe, 0xcc, 0x43, 0x42, 0xed, 0x74, 0x12, 0x25, 0x7e, 0x26,
+  0xb7, 0xeb, 0xde, 0x33, 0xd9, 0xd9, 0xc6, 0x15, 0xac, 0x17, 0xee, 0x03, 0xbf, 0xb9, 0xd9, 0x77,
+  0x8b, 0x22, 0x05, 0xa6, 0x54, 0xa2, 0xb2, 0x33, 0x4e, 0x81, 0xc7, 0x63, 0xca, 0x4b, 0xb8, 0xb9,
+  0x39, 0x6c, 0x25, 0x6e, 0x46, 0x6c, 0xe0, 0xd2, 0x1c, 0x4b, 0x61, 0xd0, 0x5c, 0x3a, 0x7e, 0x44,
+  0xfe, 0xf1, 0x37, 0x92, 0xcc, 0xf6, 0xfc, 0x7c, 0xc3, 0x86, 0xa0, 0xd3, 0xaf, 0xbe, 0x4e, 0x6a,
+  0x3f, 0x4f, 0xb6, 0x38, 0xe2, 0x26, 0xa0, 0x0f, 0xb7, 0xc1, 0x2b, 0x10, 0x39, 0x28, 0x0c, 0xb9,
+  0x5a, 0x1b, 0x33, 0x21, 0x40, 0x7d, 0xde, 0x7d, 0x75, 0x9a, 0x12, 0x92, 0xb8, 0xc1, 0xb8, 0x27,
+  0xd5, 0x09, 0xcd, 0x8a, 0x30, 0x34, 0x0d, 0x16, 0xa5, 0x47, 0x15, 0x3a, 0xfa, 0x76, 0x9b, 0x4c,
+  0x01, 0x22, 0x58, 0xed, 0x14, 0x12, 0x3d, 0xa2, 0x02, 0x37, 0xd1, 0x71, 0xc6, 0xa9, 0xd6, 0xaf,
+  0xe9, 0x10, 0x52, 0x32, 0x62, 0x9c, 0x13, 0x1c, 0xaa, 0x07, 0x63, 0x1e, 0x91, 0x80, 0x54, 0xae,
+  0x5f, 0x6e, 0xb4, 0x76, 0x51, 0x1a, 0x23, 0xad, 0xbd, 0xcb, 0xa5, 0xc5, 0xe4, 0x92, 0xe0, 0x88,
+  0x14, 0x19, 0x67, 0xd9, 0x20, 0x0d, 0xad, 0x5f, 0xde, 0x5b, 0x3d, 0xc2, 0x11, 0x08, 0x59, 0xe3,
+  0x71, 0x94, 0xcc, 0xa3, 0x4b, 0x66, 0xb8, 0x35, 0x1d, 0x8d, 0xf0, 0xe7, 0x71, 0xc1, 0x78, 0x1e,
+  0x5e, 0x46, 0xc9, 0x3c, 0xe0, 0xfa, 0xb0, 0xc6, 0x99, 0xf8, 0x6f, 0x6f, 0xf3, 0x49, 0xe6, 0x79,
+  0x17, 0xd7, 0x91, 0x68, 0xb1, 0xf3, 0x1c, 0xc9, 0x05, 0x6b, 0xc6, 0xdb, 0xe1, 0x7f, 0x29, 0x46,
+  0xa5, 0xc1, 0xf5, 0xee, 0x94, 0x2d, 0x19, 0xc6, 0x1f, 0x7f, 0xbc, 0xef, 0x3d, 0x67, 0x68, 0xb2,
+  0xcc, 0x41, 0x87, 0xe3, 0xa8, 0x3a, 0x8f, 0x78, 0x54, 0xea, 0x02, 0x7f, 0x56, 0x07, 0xa1, 0xa5,
+  0x32, 0x61, 0x3d, 0xaa, 0x59, 0xed, 0x24, 0x47, 0x52, 0x9b, 0x17, 0x52, 0x0d, 0xc3, 0x52, 0xf1,
+  0x06, 0x32, 0x9a, 0x46, 0xd7, 0x9e, 0x5b, 0x41, 0x0f, 0x0c, 0x9e, 0x9e, 0x1d, 0xbe, 0x1e, 0x82,
+  0x29, 0x64, 0xde, 0x26, 0x5f, 0x9c, 0x75, 0xba, 0xa4, 0x51, 0x00, 0x45, 0x43, 0xba, 0x7d, 0x4d,
+  0x2a, 0x54, 0x9b, 0xdd, 0xe9, 0x08, 0x48, 0x9b, 0x20, 0x26, 0x18, 0x1c, 0xb5, 0x76, 0x0f, 0x2e,
+  0x9b, 0x93, 0xc9, 0xa4, 0x89, 0x1c, 0x18, 0x36, 0xd1, 0x04, 0x88, 0x4c, 0xe6, 0x90, 0x93, 0x59,
+  0xe3, 0x42, 0xe6, 0xd3, 0xb6, 0x80, 0x49, 0xf0, 0xeb, 0x37, 0xa7, 0x1d, 0xa0, 0x2a, 0x2b, 0xbe,
+  0xa0, 0x8a, 0x0e, 0x75, 0xe8, 0xf6, 0x9e, 0x45, 0xb1, 0x29, 0x40, 0x84, 0x2a, 0x3d, 0x52, 0xee,
+  0xdc, 0xc2, 0xc8, 0x02, 0xbb, 0x92, 0x74, 0xcf, 0x95, 0x9c, 0x68, 0x50, 0x16, 0xd2, 0x05, 0x7e,
+  0x42, 0x4e, 0x52, 0x6b, 0xf6, 0x17, 0xf8, 0x1c, 0x63, 0xdc, 0x08, 0xe6, 0xc5, 0xed, 0x5a, 0x84,
+  0xb3, 0x4e, 0x0d, 0xb4, 0x10, 0x1b, 0x79, 0x2a, 0x33, 0xca, 0xa1, 0x63, 0x14, 0x13, 0xfd, 0x90,
+  0x80, 0x68, 0xfe, 0xf2, 0x39, 0x69, 0x5c, 0x4f, 0x00, 0x06, 0x39, 0x9d, 0xb6, 0x89, 0x2e, 0x10,
+  0x4c, 0x84, 0x40, 0x96, 0xaa, 0x4d, 0x9e, 0x34, 0x73, 0xd6, 0x67, 0xf8, 0x73, 0xc8, 0x44, 0x69,
+  0xa0, 0x36, 0xa0, 0x01, 0xbd, 0xca, 0x6b, 0x03, 0x6e, 0xf1, 0xed, 0x7c, 0xdc, 0xb2, 0x58, 0x18,
+  0x9b, 0x22, 0x0c, 0x6d, 0x22, 0xd0, 0x5f, 0xc5, 0x32, 0x32, 0x5b, 0x0a, 0x58, 0x4f, 0x45, 0xb6,
+  0x16, 0xe7, 0x2b, 0x6a, 0x8a, 0xb8, 0xc7, 0xa5, 0x54, 0xa1, 0x0d, 0x37, 0xc6, 0xb1, 0x30, 0x3a,
+  0x78, 0xdc, 0x6a, 0xb5, 0xe6, 0x95, 0xc5, 0x5c, 0xd5, 0xc0, 0xb0, 0x18, 0x58, 0x1b, 0x57, 0x52,
+  0xc0, 0x59, 0xaf, 0xa7, 0xc1, 0x6c, 0x03, 0x68, 0xa8, 0xfb, 0x2b, 0xc0, 0x90, 0x0e, 0x3a, 0x81,
+  0x70, 0xb8, 0x42, 0x11, 0xc7, 0x31, 0x79, 0xdf, 0x62, 0x6d, 0xa6, 0x1c, 0xe2, 0x4c, 0x72, 0xa9,
+  0x52, 0x32, 0xa6, 0x2a, 0x6c, 0x36, 0x87, 0x88, 0x4f, 0x1e, 0x91, 0x64, 0x41, 0x37, 0x72, 0x40,
+  0x47, 0xec, 0x00, 0x7d, 0x69, 0x5a, 0xab, 0x07, 0x88, 0x31, 0x8c, 0x64, 0x56, 0xb4, 0x31, 0x96,
+  0x86, 0xb9, 0x6a, 0x9b, 0xab, 0x39, 0x15, 0x5c, 0x8e, 0xde, 0xc7, 0x5b, 0x1b, 0xaa, 0xc3, 0x0d,
+  0xf2, 0xfd, 0x87, 0xb8, 0xaa, 0xcb, 0x2c, 0x03, 0xad, 0xd1, 0x59, 0xed, 0x71, 0x93, 0xa5, 0x71,
+  0x5e, 0xdc, 0xc7, 0x09, 0xd2, 0x78, 0xea, 0x8e, 0xc3, 0x13, 0xb6, 0x63, 0xa8, 0x29, 0xb5, 0x4d,
+  0xbd, 0x28, 0xc6, 0xfc, 0xb0, 0x45, 0x71, 0x87, 0xa8, 0x96, 0x7c, 0xfb, 0xe8, 0xb0, 0xd5, 0x22,
+  0xf7, 0x3e, 0xb5, 0xa0, 0x47, 0x19, 0xc7, 0xbc, 0x4b, 0x56, 0x58, 0x55, 0xc8, 0x49, 0xe5, 0x93,
+  0x4f, 0x79, 0x2c, 0x28, 0xf6, 0x4b, 0x6c, 0xcf, 0x22, 0xda, 0xec, 0x57, 0x0e, 0x63, 0x2c, 0x92,
+  0x77, 0xe4, 0xce, 0x62, 0x71, 0x32, 0x03, 0xae, 0xe1, 0x01, 0x16, 0xc8, 0x6b, 0x89, 0xcd, 0x01,
+  0x4c, 0xd0, 0x0c, 0x8e, 0x6d, 0x85, 0x0c, 0xac, 0xfb, 0xe8, 0xf7, 0x5a, 0xf2, 0xcf, 0xb1, 0xbc,
+  0xf6, 0xf5, 0xc9, 0xf3, 0x08, 0xb7, 0x69, 0x6a, 0xf7, 0xe0, 0x80, 0xd4, 0x4b, 0xc8, 0x37, 0xda,
+  0x96, 0xd8, 0x6a, 0xe4, 0x36, 0xea, 0xdd, 0x4e, 0x61, 0xb3, 0xaf, 0x27, 0x4a, 0x49, 0x55, 0x81,
+  0xca, 0xd1, 0x67, 0x4c, 0xba, 0x1e, 0xeb, 0xff, 0x06, 0x8b, 0x22, 0xfa, 0x99, 0x8a, 0x92, 0xf3,
+  0x5a, 0x85, 0xb5, 0x55, 0x71, 0x7a, 0xec, 0x66, 0x84, 0x59, 0xaf, 0xef, 0xc0, 0x36, 0x58, 0x30,
+  0x65, 0x2f, 0xc0, 0x9f, 0xf1, 0xd8, 0xaf, 0xda, 0x4f, 0x53, 0x52, 0x62, 0x81, 0xee, 0x31, 0x81,
+  0xe7, 0xe5, 0xb2, 0xbd, 0x66, 0xb2, 0x36, 0x31, 0x99, 0xe1, 0x7a, 0xfb, 0xdb, 0x15, 0xf7, 0x79,
+  0xc5, 0xc7, 0x0a, 0xdb, 0x37, 0x45, 0xda, 0x4a, 0x16, 0x4f, 0x5c, 0x47, 0xc3, 0x46, 0xd8, 0x40,
+  0xe7, 0xe7, 0xad, 0xd8, 0xd8, 0x76, 0x97, 0x9a, 0x18, 0xab, 0xdb, 0x30, 0x74, 0x9a, 0xc2, 0x44,
+  0xb5, 0x8e, 0x61, 0x5c, 0x1f, 0xdb, 0xd0, 0x34, 0x96, 0xbd, 0x76, 0xda, 0x64, 0xd5, 0xe7, 0xf7,
+  0xc9, 0x1e, 0xdf, 0xbd, 0xd2, 0xc5, 0xfa, 0x64, 0x5d, 0x43, 0xad, 0xee, 0x53, 0x48, 0x9e, 0xef,
+  0xbc, 0x8d, 0x9d, 0xbc, 0xb4, 0x8b, 0x1d, 0x58, 0xe0, 0x05, 0x97, 0xae, 0x4f, 0xce, 0x0b, 0x29,
+  0x72, 0xcd, 0xd5, 0xc8, 0x0e, 0x96, 0xc3, 0xda, 0xe3, 0x25, 0xd8, 0x18, 0x37, 0x18, 0xfc, 0x65,
+  0x7a, 0x74, 0x69, 0x7d, 0x20, 0x51, 0xad, 0x6c, 0xfe, 0xbe, 0x04, 0x35, 0xed, 0x00, 0x87, 0xcc,
+  0x48, 0xf5, 0x8c, 0xf3, 0x90, 0xc4, 0x93, 0xbc, 0x06, 0x75, 0x76, 0x61, 0x25, 0xcf, 0x45, 0x9c,
+  0x15, 0x90, 0x0d, 0x20, 0x4f, 0x71, 0xbb, 0xb8, 0xa0, 0x1a, 0xc7, 0xbd, 0x7f, 0x5e, 0x32, 0xd4,
+  0xd8, 0xcd, 0x25, 0xcd, 0x2b, 0x96, 0xac, 0x73, 0xdb, 0xb3, 0x61, 0x0b, 0xb7, 0x6b, 0x24, 0x5b,
+  0x22, 0xf7, 0x72, 0xde, 0x73, 0x36, 0xbe, 0xcd, 0x1f, 0x0f, 0xc3, 0x48, 0x72, 0xee, 0x74, 0x10,
+  0x3a, 0xf8, 0x12, 0xe9, 0xad, 0xd0, 0xbb, 0xb0, 0x9e, 0x69, 0x0d, 0xdf, 0x57, 0xac, 0xfe, 0x9c,
+  0x30, 0x91, 0x63, 0x93, 0x3c, 0x19, 0x23, 0x00, 0x1d, 0xec, 0x80, 0x19, 0x82, 0x69, 0xd7, 0x3b,
+  0x9e, 0x38, 0x3d, 0x3a, 0xb3, 0xd9, 0x60, 0x6b, 0x8e, 0xb6, 0x54, 0xf4, 0x72, 0x58, 0x3b, 0x98,
+  0x6b, 0x8b, 0xaa, 0xb8, 0xc0, 0x8e, 0x58, 0x59, 0x89, 0x6c, 0x43, 0x81, 0xe4, 0x26, 0x9c, 0x32,
+  0x8d, 0x19, 0x86, 0x98, 0x13, 0x9f, 0xcd, 0xa4, 0x01, 0x18, 0xc4, 0xb2, 0xc1, 0x3c, 0xfd, 0x55,
+  0xe7, 0xec, 0x75, 0x3c, 0xa2, 0x4a, 0x43, 0x08, 0xb1, 0x2b, 0x60, 0xd6, 0x3d, 0xa7, 0x93, 0x48,
+  0xc0, 0x44, 0x90, 0x3f, 0xa8, 0x84, 0xb9, 0xb4, 0xb9, 0xb9, 0xd9, 0x58, 0x88, 0x9c, 0xa3, 0xd8,
+  0x42, 0x6d, 0xee, 0x7b, 0xe5, 0x88, 0x9b, 0x3e, 0x7a, 0xe4, 0x9c, 0x3b, 0x4a, 0x9f, 0x46, 0xd7,
+  0x60, 0xa5, 0xab, 0xd4, 0x56, 0x7e, 0x54, 0xa8, 0xa0, 0xd2, 0xda, 0xa2, 0x0a, 0x35, 0x1d, 0x6f,
+  0x95, 0x84, 0x15, 0x23, 0xd3, 0xaf, 0xb0, 0xe7, 0x6e, 0xe7, 0x5d, 0xbb, 0x62, 0x19, 0x89, 0xbe,
+  0x8e, 0x87, 0x74, 0xe4, 0x18, 0x5b, 0xd1, 0x2c, 0xfe, 0x46, 0x32, 0xe1, 0xe8, 0x5c, 0xc1, 0xe7,
+  0x32, 0x2f, 0xdd, 0x2d, 0x55, 0x11, 0x8d, 0xc3, 0xd6, 0x5c, 0x6b, 0xdb, 0x64, 0x4a, 0x77, 0xca,
+  0x3d, 0x5c, 0xf6, 0x74, 0xbe, 0x0a, 0x1b, 0x53, 0xba, 0xbd, 0x6b, 0x25, 0xf8, 0x77, 0xa5, 0x73,
+  0xd1, 0x31, 0xca, 0x0d, 0xa7, 0x34, 0xec, 0xb3, 0x2d, 0x72, 0xa2, 0x62, 0x04, 0x52, 0x20, 0xf5,
+  0x85, 0xb0, 0xed, 0xab, 0xd7, 0x22, 0xe8, 0x46, 0x05, 0x62, 0xbb, 0xfa, 0x6c, 0xb8, 0xf8, 0xda,
+  0xee, 0x6f, 0xc3, 0xfa, 0xdc, 0xb6, 0x7f, 0x66, 0x96, 0x3f, 0x4b, 0x15, 0x17, 0xf3, 0xdd, 0x96,
+  0xf1, 0xc8, 0x35, 0xb6, 0xf1, 0xbc, 0x0a, 0xd7, 0x67, 0x24, 0xf5, 0x1c, 0xf5, 0x4f, 0xc8, 0xff,
+  0x47, 0x29, 0x5b, 0x1e, 0xaa, 0xd8, 0x27, 0x4c, 0x9a, 0xa6, 0x3f, 0x69, 0x1d, 0x46, 0xd7, 0xf5,
+  0x6a, 0x92, 0x98, 0x02, 0x45, 0x6f, 0xe0, 0xb2, 0xd0, 0x92, 0x37, 0x24, 0xc7, 0x05, 0x02, 0x00,
+  0x79, 0x80, 0x25, 0xc1, 0xe7, 0x03, 0x92, 0x5d, 0x81, 0x5d, 0x03, 0x79, 0x03, 0xbf, 0x8d, 0x19,
+  0xce, 0xa5, 0x22, 0x0f, 0x2c, 0x45, 0x03, 0xda, 0xa7, 0xcc, 0xde, 0xa4, 0x6c, 0x21, 0xdd, 0x57,
+  0xb1, 0x1c, 0x54, 0xb7, 0xcf, 0x60, 0x2e, 0xd1, 0xbd, 0x27, 0xae, 0xb9, 0xac, 0xec, 0x64, 0x90,
+  0x0a, 0xbe, 0x59, 0xba, 0x7a, 0xb7, 0x58, 0xe7, 0x6b, 0x57, 0xb2, 0x08, 0x02, 0x8b, 0xc4, 0xd1,
+  0x4a, 0xcb, 0xc3, 0xb1, 0x45, 0xcb, 0xbb, 0x8b, 0x21, 0x4e, 0xdd, 0x6d, 0xa0, 0xc7, 0x46, 0x09,
+  0xb7, 0x66, 0x68, 0xae, 0xd3, 0x16, 0xc2, 0xcc, 0xd6, 0x9b, 0x35, 0xab, 0x5e, 0x7c, 0xad, 0x2e,
+  0x86, 0x18, 0xa9, 0xa6, 0x69, 0x1f, 0x16, 0x41, 0xba, 0x9a, 0x9e, 0x6c, 0xce, 0x78, 0x03, 0xda,
+  0xdc, 0x9d, 0xf1, 0xf7, 0x12, 0xb8, 0x68, 0x65, 0x9e, 0x1f, 0xff, 0x33, 0x25, 0x6e, 0x5d, 0x6b,
+  0xf6, 0x00, 0x72, 0x2b, 0xc5, 0x1f, 0xae, 0xbd, 0xc1, 0x5e, 0x3e, 0x14, 0xeb, 0xf7, 0x41, 0x7d,
+  0x08, 0xf2, 0xfb, 0xc7, 0xd4, 0xdb, 0x2e, 0xf6, 0xba, 0xde, 0xde, 0x42, 0x04, 0x3d, 0x61, 0xe8,
+  0xd5, 0x99, 0xe0, 0x28, 0x69, 0x9e, 0x1b, 0x71, 0x37, 0x27, 0x6c, 0xba, 0xb9, 0x9c, 0xb0, 0x87,
+  0xe4, 0xe7, 0x06, 0x43, 0x99, 0xd3, 0xa0, 0x0f, 0xff, 0xfc, 0xeb, 0x10, 0x06, 0x81, 0x6d, 0x96,
+  0x39, 0x7b, 0xf7, 0x96, 0x09, 0x76, 0x05, 0x01, 0xe0, 0x2d, 0x34, 0x18, 0x32, 0x6d, 0x7f, 0x7d,
+  0x76, 0x2e, 0xce, 0xc5, 0x6f, 0xd9, 0x0b, 0x16, 0xd0, 0x77, 0x6f, 0xdf, 0x7d, 0x2f, 0x68, 0x70,
+  0x81, 0x5f, 0x38, 0x15, 0x43, 0x2a, 0xde, 0x7d, 0x7f, 0x15, 0xd8, 0xe3, 0x19, 0x40, 0x06, 0x83,
+  0xf8, 0x5c, 0xfc, 0x8e, 0xe2, 0x20, 0xc7, 0x3f, 0x01, 0x9d, 0x52, 0xc5, 0xa9, 0xc2, 0xf9, 0x76,
+  0xce, 0x40, 0xaa, 0x52, 0xd0, 0x8c, 0x0e, 0x62, 0x14, 0x3e, 0x55, 0x7f, 0xbf, 0x0f, 0x1e, 0xab,
+  0x1e, 0x33, 0xce, 0xa6, 0x52, 0xdd, 0x9b, 0xb5, 0x1f, 0x3d, 0xa6, 0x3f, 0x7b, 0x0a, 0x3f, 0x5f,
+  0x23, 0x6c, 0xe6, 0x6a, 0x58, 0x13, 0xcd, 0xbb, 0xdb, 0xa3, 0xfd, 0x6c, 0x13, 0xe9, 0xf6, 0x24,
+  0x0f, 0xe6, 0xef, 0xba, 0xcf, 0x39, 0x5b, 0x23, 0x22, 0x97, 0xbe, 0x72, 0xc7, 0xbe, 0x64, 0x86,
+  0x51, 0x25, 0x91, 0x7e, 0x4c, 0xb2, 0x7d, 0x8e, 0x3d, 0xe0, 0xbd, 0x2c, 0xf3, 0x10, 0xbd, 0x42,
+  0x64, 0x76, 0xe3, 0xd8, 0xbf, 0xdf, 0xfe, 0xf1, 0xbb, 0xc0, 0xf7, 0x86, 0x40, 0x8e, 0x40, 0xb9,
+  0x28, 0x2d, 0x18, 0xe0, 0xf8, 0xf4, 0x25, 0xaa, 0xb7, 0x40, 0xa3, 0xd4, 0xc8, 0x4b, 0x0e, 0xae,
+  0x3d, 0x18, 0x77, 0xd5, 0x06, 0x63, 0xcb, 0x91, 0x0e, 0x26, 0x8c, 0xf3, 0xe0, 0x02, 0x82, 0x01,
+  0x8c, 0x0c, 0xf2, 0x0a, 0xb1, 0x9c, 0x06, 0x78, 0x0c, 0xce, 0x00, 0xce, 0xb2, 0x92, 0xc5, 0xda,
+  0x9b, 0x4f, 0xc3, 0x02, 0x8f, 0x9a, 0xf8, 0x61, 0xdc, 0x72, 0x4e, 0xda, 0x57, 0x12, 0xd6, 0xf6,
+  0xfd, 0x29, 0xd5, 0xfb, 0xe9, 0x21, 0xb4, 0x2e, 0xde, 0x47, 0xa9, 0x07, 0xb3, 0xc8, 0x22, 0xee,
+  0xc3, 0xfb, 0x20, 0xb9, 0xf3, 0x62, 0xb7, 0x1a, 0xe5, 0x02, 0xd8, 0x8d, 0x38, 0x3f, 0xfc, 0xe9,
+  0xcf, 0xff, 0xfa, 0xfb, 0x1f, 0x82, 0x17, 0xcf, 0x8e, 0xbb, 0x67, 0x6f, 0xbe, 0x0c, 0xde, 0x9c,
+  0x74, 0x4e, 0xba, 0x96, 0x31, 0xdd, 0x82, 0x55, 0xb4, 0x40, 0x32, 0x69, 0x68, 0x9f, 0x8b, 0x1f,
+  0xbe, 0xfd, 0x4b, 0xf0, 0x6a, 0x89, 0x0f, 0x7e, 0x0c, 0x95, 0x6c, 0x60, 0xbb, 0x8f, 0x7f, 0x19,
+  0xed, 0xc7, 0xba, 0x75, 0x76, 0xf9, 0xa1, 0x0e, 0xde, 0x4f, 0x64, 0x6d, 0xec, 0x5c, 0xd8, 0xa8,
+  0x98, 0x28, 0xe1, 0xb3, 0x87, 0x11, 0xe9, 0x0d, 0x54, 0xc6, 0xee, 0x4f, 0xa2, 0x3c, 0x7b, 0xf2,
+  0xc9, 0x93, 0x4f, 0xd6, 0x48, 0xd4, 0xa3, 0x56, 0x99, 0x4f, 0x9b, 0x0e, 0xbe, 0xff, 0x8a, 0x46,
+  0xce, 0xb7, 0x20, 0xc7, 0x2b, 0xc7, 0x07, 0x49, 0x23, 0xef, 0xde, 0xae, 0x0d, 0x0f, 0x2f, 0x51,
+  0xcb, 0x5c, 0x9a, 0xbf, 0xd9, 0xdc, 0xca, 0xc0, 0x1e, 0xa2, 0x58, 0x2c, 0xaf, 0xab, 0xdf, 0x4d,
+  0x93, 0xbd, 0x3b, 0x5e, 0x08, 0x27, 0xeb, 0x37, 0xd9, 0xda, 0xf3, 0x0a, 0xa8, 0xbd, 0xfa, 0x55,
+  0x38, 0xd9, 0x43, 0x36, 0x77, 0xba, 0xcf, 0xba, 0x27, 0xd1, 0x75, 0xfd, 0x6d, 0x8d, 0x1b, 0x8a,
+  0xbd, 0x2c, 0x45, 0xb3, 0xb7, 0x2f, 0xcd, 0xfc, 0x03, 0xaf, 0xb8, 0xa3, 0xea, 0x95, 0xd7, 0xca,
+  0x9b, 0xbe, 0x25, 0x01, 0x3e, 0xdb, 0xbb, 0x7d, 0x8f, 0x9b, 0xec, 0xd5, 0xee, 0x61, 0x27, 0x3b,
+  0xfc, 0x5f, 0x11, 0xfa, 0x56, 0xcd, 0x45, 0xef, 0xfc, 0x97, 0x3b, 0xee, 0xcb, 0xcc, 0xfd, 0x07,
+  0x41, 0x63, 0xf5, 0x8d, 0x4a, 0x74, 0xe7, 0x3b, 0x96, 0xbd, 0x59, 0x84, 0x1f, 0x9f, 0x1e, 0xe8,
+  0x4c, 0xb1, 0x91, 0x39, 0xfa, 0xf4, 0x60, 0x88, 0x0a, 0x1f, 0x3f, 0xec, 0x95, 0x03, 0x3f, 0x0a,
+  0x33, 0xe4, 0x47, 0x7b, 0xff, 0x01,
+};
+const SplicedPage SCHEDULER_PAGE_SPLICED = {
+  SCHEDULER_PAGE_HEAD, sizeof(SCHEDULER_PAGE_HEAD), SCHEDULER_PAGE_TAIL, sizeof(SCHEDULER_PAGE_TAIL),
+  0xa6b17194UL, 0x630f3c7bUL, 0xd1caec36UL, 11641
+};
+
+#endif // WEB_PORTAL_PAGES_GZ_H
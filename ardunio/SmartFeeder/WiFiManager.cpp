@@ -1,27 +1,44 @@
+#define LOG_MODULE LOG_MOD_WIFI
 #include "WiFiManager.h"
+#include "Metrics.h"
 
 #if defined(ESP32)
   #include <WiFi.h>
   #include <Preferences.h>
+  #include <esp_wifi.h>
 #elif defined(ESP8266)
   #include <ESP8266WiFi.h>
   #include <EEPROM.h>
 #endif
 
 WiFiManager::WiFiManager() 
-  : isConnected(false), lastScanTime(0), lastConnectAttempt(0) {
+  : isConnected(false), lastScanTime(0)
+  , connState(CONN_IDLE), attemptFast(false), associated(false), pendingCredentials(false)
+  , stateSince(0), associatedAt(0), sequenceStartedAt(0), backoffMs(0), failures(0)
+  , connectError(nullptr), lastConnectMs(0), lastOutageMs(0), fastConnects(0), fullConnects(0)
+  , scanState(SCAN_IDLE), scanRetried(false), scanStartedAt(0), scanCount(0) {
+  memset(&link, 0, sizeof(link));
+  scanError[0] = '\0';
 }
 
 bool WiFiManager::begin() {
+  // Reconnects are driven by maintain(); the driver's own retries and flash
+  // writes of the config on every begin() only get in the way
+  WiFi.persistent(false);
+  WiFi.setAutoReconnect(false);
+  
 #if defined(ESP32)
   Preferences prefs;
   if (!prefs.begin(NVS_NAMESPACE, true)) {
-    LOG("WiFiManager: Failed to open NVS");
+    LOGE("WiFiManager: Failed to open NVS");
     return false;
   }
   
   savedSSID = prefs.getString("wifiSSID", "");
   savedPassword = prefs.getString("wifiPass", "");
+  if (prefs.getBytesLength("wifiLink") == sizeof(link)) {
+    prefs.getBytes("wifiLink", &link, sizeof(link));
+  }
   prefs.end();
   
   if (savedSSID.length() > 0) {
@@ -66,253 +83,347 @@ bool WiFiManager::begin() {
   return false;
 }
 
-bool WiFiManager::scanNetworks(String& jsonResult, String& errorMessage) {
-  jsonResult = "[]";
-  errorMessage = "";
-  
-  LOG("WiFiManager: Scanning networks...");
-  
-  // Don't change WiFi mode if already in AP_STA (AP is already running)
-  // Just ensure we're ready to scan
+int WiFiManager::compareBySsid(const void* a, const void* b) {
+  const ScanRecord* x = (const ScanRecord*)a;
+  const ScanRecord* y = (const ScanRecord*)b;
+  int c = strcmp(x->ssid, y->ssid);
+  if (c != 0) return c;
+  return y->rssi - x->rssi;
+}
+
+int WiFiManager::compareByRssi(const void* a, const void* b) {
+  return ((const ScanRecord*)b)->rssi - ((const ScanRecord*)a)->rssi;
+}
+
+bool WiFiManager::beginScan() {
+  // Scanning needs the station interface; leave the AP as the radio policy set it
   wifi_mode_t currentMode = WiFi.getMode();
-  if (currentMode != WIFI_AP_STA) {
-    LOG("WiFiManager: Switching to AP_STA mode for scan");
-    WiFi.mode(WIFI_AP_STA);
-    delay(100);
-  } else {
-    LOG("WiFiManager: Already in AP_STA mode");
-    delay(50);
+  if (!(currentMode & WIFI_STA)) {
+    LOG("WiFiManager: Enabling station interface for scan");
+    WiFi.mode((wifi_mode_t)(currentMode | WIFI_STA));
   }
   
-  // Use synchronous scan (blocking) to ensure we get results
-#if defined(ESP32)
   WiFi.scanDelete();
-  LOG("WiFiManager: Starting synchronous scan...");
-  int n = WiFi.scanNetworks(false, true);  // sync, show_hidden=true (like reference)
-#else
-  int n = WiFi.scanNetworks();
-#endif
+  int result = WiFi.scanNetworks(true, true);  // async, show_hidden=true
+  if (result != WIFI_SCAN_RUNNING && result < 0) {
+    snprintf(scanError, sizeof(scanError), "Tarama başarısız (kod %d)", result);
+    LOG("WiFiManager: Scan could not start (%d)", result);
+    scanState = SCAN_FAILED;
+    return false;
+  }
   
-  LOG("WiFiManager: Scan completed with result: %d", n);
+  scanState = SCAN_RUNNING;
+  scanStartedAt = millis();
+  return true;
+}
+
+void WiFiManager::startScan(bool force) {
+  if (scanState == SCAN_RUNNING) return;
+  if (!force && scanState == SCAN_DONE && millis() - lastScanTime < SCAN_CACHE_MS) return;
   
-  // Retry once if nothing found
-  if (n <= 0) {
-    LOG("WiFiManager: No networks found, retrying...");
-    delay(200);
-#if defined(ESP32)
-    WiFi.scanDelete();
-    n = WiFi.scanNetworks(false, true);  // sync, show_hidden=true
-#else
-    n = WiFi.scanNetworks();
-#endif
-    LOG("WiFiManager: Rescan result: %d", n);
+  LOG("WiFiManager: Starting background scan");
+  scanRetried = false;
+  beginScan();
+}
+
+void WiFiManager::pollScan() {
+  if (scanState != SCAN_RUNNING) return;
+  
+  int n = WiFi.scanComplete();
+  if (n == WIFI_SCAN_RUNNING) {
+    if (millis() - scanStartedAt > SCAN_TIMEOUT_MS) {
+      WiFi.scanDelete();
+      snprintf(scanError, sizeof(scanError), "Tarama zaman aşımına uğradı");
+      LOG("WiFiManager: Scan timed out");
+      scanState = SCAN_FAILED;
+    }
+    return;
   }
   
   if (n < 0) {
-    errorMessage = "Tarama başarısız (kod " + String(n) + ")";
+    snprintf(scanError, sizeof(scanError), "Tarama başarısız (kod %d)", n);
     LOG("WiFiManager: Scan failed with error code: %d", n);
-    return false;
+    scanState = SCAN_FAILED;
+    return;
   }
   
-  if (n == 0) {
-    errorMessage = "Hiç ağ bulunamadı. Modemin 2.4 GHz bandı açık mı?";
-    LOG("WiFiManager: No networks detected. Check 2.4GHz band is enabled.");
-    return false;
+  // Retry once if nothing found
+  if (n == 0 && !scanRetried) {
+    LOG("WiFiManager: No networks found, retrying...");
+    scanRetried = true;
+    beginScan();
+    return;
   }
   
-  LOG("WiFiManager: Found %d networks", n);
-  
-  // Deduplicate and sort by RSSI - use heap to avoid stack overflow
-  const int MAX_NETWORKS = 20;  // Reduced to save memory
-  struct NetworkInfo {
-    String ssid;
-    int rssi;
-    int channel;
-    int encryption;
-  };
+  collectScan(n);
+  WiFi.scanDelete();
+  lastScanTime = millis();
   
-  // Allocate on heap to avoid stack overflow
-  NetworkInfo* networks = new NetworkInfo[MAX_NETWORKS];
-  int count = 0;
+  if (scanCount == 0) {
+    snprintf(scanError, sizeof(scanError), "Hiç ağ bulunamadı. Modemin 2.4 GHz bandı açık mı?");
+    LOG("WiFiManager: No networks detected. Check 2.4GHz band is enabled.");
+    scanState = SCAN_FAILED;
+    return;
+  }
   
-  for (int i = 0; i < n && count < MAX_NETWORKS; i++) {
-    String ssid = WiFi.SSID(i);
-    if (ssid.length() == 0) continue;
+  LOG("WiFiManager: Scan done in %lu ms - %d records, %u networks",
+      (unsigned long)(lastScanTime - scanStartedAt), n, scanCount);
+  scanState = SCAN_DONE;
+}
+
+void WiFiManager::collectScan(int found) {
+  // SSIDs copied straight from the driver's scan records, no String per network
+  uint8_t count = 0;
+  for (int i = 0; i < found && count < MAX_SCAN_RESULTS; i++) {
+    ScanRecord& rec = scanResults[count];
+#if defined(ESP32)
+    wifi_ap_record_t* record = (wifi_ap_record_t*)WiFi.getScanInfoByIndex(i);
+    if (!record) continue;
+    size_t ssidLen = strnlen((const char*)record->ssid, sizeof(rec.ssid) - 1);
+#else
+    bss_info* record = WiFi.getScanInfoByIndex(i);
+    if (!record) continue;
+    size_t ssidLen = record->ssid_len < sizeof(rec.ssid) - 1 ? record->ssid_len : sizeof(rec.ssid) - 1;
+#endif
+    if (ssidLen == 0) continue;
+    memcpy(rec.ssid, record->ssid, ssidLen);
+    rec.ssid[ssidLen] = '\0';
     
     int rssi = WiFi.RSSI(i);
-    int channel = WiFi.channel(i);
-    int encryption = (int)WiFi.encryptionType(i);
-    
-    // Check for duplicate
-    bool found = false;
-    for (int j = 0; j < count; j++) {
-      if (networks[j].ssid == ssid) {
-        found = true;
-        // Keep stronger signal
-        if (rssi > networks[j].rssi) {
-          networks[j].rssi = rssi;
-          networks[j].channel = channel;
-          networks[j].encryption = encryption;
-        }
-        break;
-      }
-    }
-    
-    if (!found) {
-      networks[count].ssid = ssid;
-      networks[count].rssi = rssi;
-      networks[count].channel = channel;
-      networks[count].encryption = encryption;
-      count++;
-    }
+    rec.rssi = (int8_t)(rssi < -128 ? -128 : (rssi > 0 ? 0 : rssi));
+    rec.channel = (uint8_t)WiFi.channel(i);
+    rec.encryption = (uint8_t)WiFi.encryptionType(i);
+    count++;
   }
   
-  // Sort by RSSI (strongest first)
-  for (int i = 0; i < count - 1; i++) {
-    for (int j = i + 1; j < count; j++) {
-      if (networks[j].rssi > networks[i].rssi) {
-        NetworkInfo temp = networks[i];
-        networks[i] = networks[j];
-        networks[j] = temp;
-      }
+  // Dedupe: sort by SSID (strongest first within an SSID), keep one per run
+  qsort(scanResults, count, sizeof(ScanRecord), compareBySsid);
+  uint8_t unique = 0;
+  for (uint8_t i = 0; i < count; i++) {
+    if (unique > 0 && strcmp(scanResults[unique - 1].ssid, scanResults[i].ssid) == 0) continue;
+    if (unique != i) scanResults[unique] = scanResults[i];
+    unique++;
+  }
+  
+  // Strongest first
+  qsort(scanResults, unique, sizeof(ScanRecord), compareByRssi);
+  scanCount = unique;
+}
+
+void WiFiManager::writeScanResults(JsonWriter& networksOut) const {
+  // Weakest networks are left out if the response buffer runs short
+  const size_t MAX_ENTRY_JSON = 32 * 6 + 64;  // Fully escaped SSID plus fields
+  networksOut.beginArray();
+  for (uint8_t i = 0; i < scanCount; i++) {
+    if (networksOut.remaining() < MAX_ENTRY_JSON) {
+      LOG("WiFiManager: Response full, %u weaker networks omitted", scanCount - i);
+      break;
     }
+    networksOut.beginObject()
+      .key("ssid").value(scanResults[i].ssid)
+      .key("rssi").number(scanResults[i].rssi)
+      .key("ch").number(scanResults[i].channel)
+      .key("enc").number(scanResults[i].encryption)
+      .endObject();
   }
+  networksOut.endArray();
+}
+
+void WiFiManager::saveCredentials() {
+#if defined(ESP32)
+  Preferences prefs;
+  if (prefs.begin(NVS_NAMESPACE, false)) {
+    metrics.inc(MET_NVS_WRITES_WIFI);
+    prefs.putString("wifiSSID", savedSSID);
+    prefs.putString("wifiPass", savedPassword);
+    prefs.end();
+    LOG("WiFiManager: Credentials saved to NVS (ESP32)");
+  } else {
+    LOGW("WiFiManager: WARNING - Failed to save credentials to NVS");
+  }
+#elif defined(ESP8266)
+  EEPROM.begin(512);
+  int addr = 0;
   
-  // Build JSON response
-  String json = "[";
-  for (int i = 0; i < count; i++) {
-    String ssid = networks[i].ssid;
-    ssid.replace("\\", "\\\\");
-    ssid.replace("\"", "\\\"");
-    
-    json += "{\"ssid\":\"" + ssid + "\"";
-    json += ",\"rssi\":" + String(networks[i].rssi);
-    json += ",\"ch\":" + String(networks[i].channel);
-    json += ",\"enc\":" + String(networks[i].encryption);
-    json += "}";
-    
-    if (i < count - 1) json += ",";
+  // Write SSID
+  byte ssidLen = savedSSID.length();
+  if (ssidLen > 32) ssidLen = 32;
+  EEPROM.write(addr++, ssidLen);
+  for (int i = 0; i < ssidLen; i++) {
+    EEPROM.write(addr++, savedSSID[i]);
   }
-  json += "]";
   
-  // Clean up heap memory
-  delete[] networks;
+  // Write password
+  byte passLen = savedPassword.length();
+  if (passLen > 64) passLen = 64;
+  EEPROM.write(addr++, passLen);
+  for (int i = 0; i < passLen; i++) {
+    EEPROM.write(addr++, savedPassword[i]);
+  }
   
-  lastScanTime = millis();
-  jsonResult = json;
-  return true;
+  EEPROM.commit();
+  metrics.inc(MET_NVS_WRITES_WIFI);
+  EEPROM.end();
+  LOG("WiFiManager: Credentials saved to EEPROM (ESP8266)");
+#endif
 }
 
-bool WiFiManager::connect(const String& ssid, const String& password, uint32_t timeoutMs) {
-  LOG("WiFiManager: Connecting to %s...", ssid.c_str());
+void WiFiManager::updateLinkCache() {
+  LinkCache next;
+  memset(&next, 0, sizeof(next));
+  const uint8_t* bssid = WiFi.BSSID();
+  if (bssid) memcpy(next.bssid, bssid, sizeof(next.bssid));
+  next.channel = (uint8_t)WiFi.channel();
+  next.ip = (uint32_t)WiFi.localIP();
+  next.gateway = (uint32_t)WiFi.gatewayIP();
+  next.subnet = (uint32_t)WiFi.subnetMask();
+  next.dns = (uint32_t)WiFi.dnsIP();
+  
+  // Unchanged after a normal reconnect: no flash write
+  if (memcmp(&next, &link, sizeof(link)) == 0) return;
+  link = next;
   
-  WiFi.disconnect(true);
-  delay(200);
-  
-  // Keep AP running while connecting to STA so the user doesn't lose the portal
-  WiFi.mode(WIFI_AP_STA);
-  WiFi.begin(ssid.c_str(), password.c_str());
-  delay(50);
-  
-  uint32_t startTime = millis();
-  int lastStatus = -1;
-  while (WiFi.status() != WL_CONNECTED && (millis() - startTime) < timeoutMs) {
-    delay(500);
-    int currentStatus = WiFi.status();
-    if (currentStatus != lastStatus) {
-      LOG("WiFiManager: Status changed to %d (0=IDLE, 1=NO_SSID, 3=CONNECTED, 4=FAILED, 6=DISCONNECTED)", currentStatus);
-      lastStatus = currentStatus;
-    }
+#if defined(ESP32)
+  Preferences prefs;
+  if (prefs.begin(NVS_NAMESPACE, false)) {
+    metrics.inc(MET_NVS_WRITES_WIFI);
+    prefs.putBytes("wifiLink", &link, sizeof(link));
+    prefs.end();
   }
+#endif
+  LOG("WiFiManager: Link cached - BSSID %02X:%02X:%02X:%02X:%02X:%02X, channel %u",
+      link.bssid[0], link.bssid[1], link.bssid[2], link.bssid[3], link.bssid[4], link.bssid[5],
+      link.channel);
+}
+
+const char* WiFiManager::statusMessage(int status) {
+  switch (status) {
+    case WL_NO_SSID_AVAIL:
+      return "Ağ bulunamadı - SSID yanlış veya sinyal zayıf";
+    case WL_CONNECT_FAILED:
+      return "Şifre yanlış veya kimlik doğrulama hatası";
+    case WL_CONNECTED:
+      return "IP alınamadı - Router DHCP kontrol edin";
+    default:
+      return "Bağlantı zaman aşımı - Sinyal çok zayıf";
+  }
+}
+
+void WiFiManager::startAttempt(bool fast) {
+  const String& ssid = pendingCredentials ? pendingSSID : savedSSID;
+  const String& password = pendingCredentials ? pendingPassword : savedPassword;
+  
+  // Keep AP running while connecting to STA so the user doesn't lose the portal,
+  // but don't bring it up if the radio policy has shut it down
+  bool apRunning = WiFi.getMode() & WIFI_AP;
+  WiFi.mode(apRunning ? WIFI_AP_STA : WIFI_STA);
+  if (WiFi.status() == WL_CONNECTED) {
+    WiFi.disconnect(false);
+  }
+  isConnected = false;
   
-  int finalStatus = WiFi.status();
-  LOG("WiFiManager: Connection attempt finished. Final status=%d", finalStatus);
+#if WIFI_REUSE_LEASE
+  // Last lease as static config skips DHCP; a full connect asks DHCP again
+  if (fast && link.ip != 0) {
+    WiFi.config(IPAddress(link.ip), IPAddress(link.gateway), IPAddress(link.subnet), IPAddress(link.dns));
+  } else {
+    WiFi.config(IPAddress(0, 0, 0, 0), IPAddress(0, 0, 0, 0), IPAddress(0, 0, 0, 0));
+  }
+#endif
   
-  // Wait a bit more for DHCP to assign IP
-  if (finalStatus == WL_CONNECTED) {
-    delay(1000);
-    LOG("WiFiManager: Waiting for IP assignment...");
-    uint32_t ipWaitStart = millis();
-    IPAddress ip;
-    
-    while ((ip = WiFi.localIP())[0] == 0 && (millis() - ipWaitStart) < 5000) {
-      delay(500);
-      LOG("WiFiManager: IP: %s", ip.toString().c_str());
-    }
-    
-    if (ip[0] == 0) {
-      LOG("WiFiManager: DHCP failed - no IP assigned");
-      isConnected = false;
-      return false;
-    }
+  if (fast) {
+    // Straight to the known access point: no scan across all channels
+    WiFi.begin(ssid.c_str(), password.c_str(), link.channel, link.bssid, true);
+  } else {
+    WiFi.begin(ssid.c_str(), password.c_str());
   }
   
-  if (finalStatus == WL_CONNECTED) {
-    isConnected = true;
-    savedSSID = ssid;
-    savedPassword = password;
-    
-    // Save credentials
-#if defined(ESP32)
-    Preferences prefs;
-    if (prefs.begin(NVS_NAMESPACE, false)) {
-      prefs.putString("wifiSSID", ssid);
-      prefs.putString("wifiPass", password);
-      prefs.end();
-      LOG("WiFiManager: Credentials saved to NVS (ESP32)");
-    } else {
-      LOG("WiFiManager: WARNING - Failed to save credentials to NVS");
-    }
-#elif defined(ESP8266)
-    EEPROM.begin(512);
-    int addr = 0;
-    
-    // Write SSID
-    byte ssidLen = ssid.length();
-    if (ssidLen > 32) ssidLen = 32;
-    EEPROM.write(addr++, ssidLen);
-    for (int i = 0; i < ssidLen; i++) {
-      EEPROM.write(addr++, ssid[i]);
-    }
-    
-    // Write password
-    byte passLen = password.length();
-    if (passLen > 64) passLen = 64;
-    EEPROM.write(addr++, passLen);
-    for (int i = 0; i < passLen; i++) {
-      EEPROM.write(addr++, password[i]);
+  attemptFast = fast;
+  associated = false;
+  connState = CONN_ASSOCIATING;
+  stateSince = millis();
+  LOG("WiFiManager: Connecting to %s (%s)...", ssid.c_str(), fast ? "cached BSSID/channel" : "full scan");
+}
+
+void WiFiManager::failAttempt(int status) {
+  LOG("WiFiManager: Connection attempt failed - %s (status=%d)", statusMessage(status), status);
+  
+  if (attemptFast) {
+    // Access point moved or changed: find it again
+    startAttempt(false);
+    return;
+  }
+  connectError = statusMessage(status);
+  
+  if (pendingCredentials) {
+    // New network did not work: keep the saved one
+    pendingCredentials = false;
+    pendingSSID = "";
+    pendingPassword = "";
+    if (savedSSID.length() == 0) {
+      WiFi.disconnect(false);
+      connState = CONN_IDLE;
+      return;
     }
-    
-    EEPROM.commit();
-    EEPROM.end();
-    LOG("WiFiManager: Credentials saved to EEPROM (ESP8266)");
-#endif
-    
-    LOG("WiFiManager: Connected! SSID=%s, IP=%s, RSSI=%d", 
-        ssid.c_str(), WiFi.localIP().toString().c_str(), WiFi.RSSI());
-    return true;
   }
   
-  // Connection failed - provide detailed error
-  const char* errorMsg = "Unknown error";
-  switch(finalStatus) {
-    case WL_NO_SSID_AVAIL:
-      errorMsg = "SSID not found (network out of range or wrong name)";
-      break;
-    case WL_CONNECT_FAILED:
-      errorMsg = "Wrong password or authentication failed";
-      break;
-    case WL_DISCONNECTED:
-      errorMsg = "Disconnected (timeout or signal lost)";
-      break;
-    case WL_IDLE_STATUS:
-      errorMsg = "Idle (connection not started)";
-      break;
+  failures++;
+  metrics.inc(MET_WIFI_CONNECT_FAILURES);
+  uint8_t shift = failures - 1 < 6 ? failures - 1 : 6;
+  backoffMs = WIFI_BACKOFF_MIN_MS << shift;
+  if (backoffMs > WIFI_BACKOFF_MAX_MS) backoffMs = WIFI_BACKOFF_MAX_MS;
+  connState = CONN_BACKOFF;
+  stateSince = millis();
+  LOG("WiFiManager: Retrying in %lu ms", (unsigned long)backoffMs);
+}
+
+void WiFiManager::onConnected() {
+  unsigned long now = millis();
+  isConnected = true;
+  connState = CONN_CONNECTED;
+  failures = 0;
+  connectError = nullptr;
+  lastConnectMs = now - stateSince;
+  lastOutageMs = now - sequenceStartedAt;
+  if (attemptFast) {
+    fastConnects++;
+    metrics.inc(MET_WIFI_CONNECTS_FAST);
+  } else {
+    fullConnects++;
+    metrics.inc(MET_WIFI_CONNECTS_FULL);
   }
   
-  LOG("WiFiManager: Connection failed - %s (status=%d)", errorMsg, finalStatus);
-  isConnected = false;
-  return false;
+  if (pendingCredentials) {
+    savedSSID = pendingSSID;
+    savedPassword = pendingPassword;
+    pendingCredentials = false;
+    pendingSSID = "";
+    pendingPassword = "";
+    saveCredentials();
+  }
+  updateLinkCache();
+  
+  LOG("WiFiManager: Connected! SSID=%s, IP=%s, RSSI=%d - %s connect in %lu ms (%lu ms since start)",
+      savedSSID.c_str(), WiFi.localIP().toString().c_str(), WiFi.RSSI(),
+      attemptFast ? "fast" : "full", (unsigned long)lastConnectMs, (unsigned long)lastOutageMs);
+}
+
+void WiFiManager::connect(const String& ssid, const String& password) {
+  connectError = nullptr;
+  failures = 0;
+  sequenceStartedAt = millis();
+  
+  if (ssid == savedSSID && password == savedPassword) {
+    pendingCredentials = false;
+    startAttempt(link.channel != 0);
+    return;
+  }
+  
+  // Saved only once the new network actually works
+  pendingSSID = ssid;
+  pendingPassword = password;
+  pendingCredentials = true;
+  startAttempt(false);
 }
 
 bool WiFiManager::connectSaved() {
@@ -321,12 +432,17 @@ bool WiFiManager::connectSaved() {
     return false;
   }
   
-  return connect(savedSSID, savedPassword);
+  connect(savedSSID, savedPassword);
+  return true;
 }
 
 void WiFiManager::disconnect() {
   WiFi.disconnect(true);
   isConnected = false;
+  connState = CONN_IDLE;
+  pendingCredentials = false;
+  pendingSSID = "";
+  pendingPassword = "";
   LOG("WiFiManager: Disconnected");
 }
 
@@ -345,6 +461,27 @@ String WiFiManager::getLocalIP() const {
   return "0.0.0.0";
 }
 
+void WiFiManager::getStationSSID(char* buf, size_t size) {
+  // Same source as WiFi.SSID(), without building a String
+  size_t len = 0;
+#if defined(ESP32)
+  wifi_config_t conf;
+  if (esp_wifi_get_config(WIFI_IF_STA, &conf) == ESP_OK) {
+    len = strnlen((const char*)conf.sta.ssid, sizeof(conf.sta.ssid));
+    if (len > size - 1) len = size - 1;
+    memcpy(buf, conf.sta.ssid, len);
+  }
+#elif defined(ESP8266)
+  struct station_config conf;
+  if (wifi_station_get_config(&conf)) {
+    len = strnlen((const char*)conf.ssid, sizeof(conf.ssid));
+    if (len > size - 1) len = size - 1;
+    memcpy(buf, conf.ssid, len);
+  }
+#endif
+  buf[len] = '\0';
+}
+
 int WiFiManager::getRSSI() const {
   if (isConnected) {
     return WiFi.RSSI();
@@ -353,26 +490,54 @@ int WiFiManager::getRSSI() const {
 }
 
 void WiFiManager::maintain() {
-  // Check connection status
-  if (WiFi.status() == WL_CONNECTED) {
-    if (!isConnected) {
-      isConnected = true;
-      LOG("WiFiManager: Connection restored - IP=%s", WiFi.localIP().toString().c_str());
-    }
-  } else {
-    if (isConnected) {
-      isConnected = false;
-      LOG("WiFiManager: Connection lost");
-    }
+  unsigned long now = millis();
+  
+  switch (connState) {
+    case CONN_IDLE:
+      break;
+    
+    case CONN_BACKOFF:
+      if (now - stateSince >= backoffMs) {
+        startAttempt(link.channel != 0 && !pendingCredentials);
+      }
+      break;
     
-    // Try to reconnect if we have saved credentials
-    if (savedSSID.length() > 0) {
-      uint32_t now = millis();
-      if (now - lastConnectAttempt > RECONNECT_INTERVAL) {
-        lastConnectAttempt = now;
-        LOG("WiFiManager: Attempting reconnect...");
-        connectSaved();
+    case CONN_CONNECTED:
+      if (WiFi.status() != WL_CONNECTED) {
+        isConnected = false;
+        LOG("WiFiManager: Connection lost");
+        metrics.inc(MET_WIFI_LINK_LOST);
+        failures = 0;
+        sequenceStartedAt = now;
+        startAttempt(link.channel != 0);
       }
+      break;
+    
+    case CONN_ASSOCIATING: {
+      int status = WiFi.status();
+      if (status == WL_CONNECTED) {
+        if (WiFi.localIP()[0] != 0) {
+          onConnected();
+          break;
+        }
+        
+        // Associated, waiting for DHCP
+        if (!associated) {
+          associated = true;
+          associatedAt = now;
+        }
+        if (now - associatedAt > WIFI_DHCP_TIMEOUT_MS) {
+          LOG("WiFiManager: DHCP failed - no IP assigned");
+          failAttempt(status);
+        }
+        break;
+      }
+      
+      uint32_t timeout = attemptFast ? WIFI_FAST_CONNECT_MS : WIFI_CONNECT_TIMEOUT_MS;
+      if (status == WL_CONNECT_FAILED || now - stateSince > timeout) {
+        failAttempt(status);
+      }
+      break;
     }
   }
 }
@@ -381,8 +546,10 @@ void WiFiManager::clearCredentials() {
 #if defined(ESP32)
   Preferences prefs;
   if (prefs.begin(NVS_NAMESPACE, false)) {
+    metrics.inc(MET_NVS_WRITES_WIFI);
     prefs.remove("wifiSSID");
     prefs.remove("wifiPass");
+    prefs.remove("wifiLink");
     prefs.end();
     LOG("WiFiManager: Credentials cleared from NVS (ESP32)");
   }
@@ -393,6 +560,7 @@ void WiFiManager::clearCredentials() {
     EEPROM.write(i, 0);
   }
   EEPROM.commit();
+  metrics.inc(MET_NVS_WRITES_WIFI);
   EEPROM.end();
   LOG("WiFiManager: Credentials cleared from EEPROM (ESP8266)");
 #endif
@@ -400,6 +568,7 @@ void WiFiManager::clearCredentials() {
   savedSSID = "";
   savedPassword = "";
   isConnected = false;
+  memset(&link, 0, sizeof(link));
   
   LOG("WiFiManager: Memory cleared");
 }
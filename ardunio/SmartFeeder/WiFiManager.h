@@ -2,6 +2,7 @@
 #define WIFI_MANAGER_H
 
 #include "Config.h"
+#include "ResponseWriter.h"
 
 /**
  * @brief Manages WiFi connection for online mode
@@ -11,14 +12,118 @@
  */
 class WiFiManager {
 private:
+  enum ScanState : uint8_t {
+    SCAN_IDLE,
+    SCAN_RUNNING,
+    SCAN_DONE,
+    SCAN_FAILED
+  };
+  
+  /**
+   * @brief One network of the last scan (fixed size, no String)
+   */
+  struct ScanRecord {
+    char ssid[33];
+    int8_t rssi;
+    uint8_t channel;
+    uint8_t encryption;
+  };
+  
+  enum ConnectState : uint8_t {
+    CONN_IDLE,         // Nothing to connect to (or disconnected on request)
+    CONN_ASSOCIATING,  // begin() issued, waiting for association and IP
+    CONN_CONNECTED,
+    CONN_BACKOFF       // Waiting before the next full attempt
+  };
+  
+  /**
+   * @brief Access point and lease of the last successful connection
+   * 
+   * Persisted as one NVS blob; lets a reconnect go straight to the known
+   * BSSID and channel instead of scanning every channel.
+   */
+  struct LinkCache {
+    uint8_t bssid[6];
+    uint8_t channel;   // 0 = nothing cached
+    uint32_t ip;
+    uint32_t gateway;
+    uint32_t subnet;
+    uint32_t dns;
+  };
+  
+  static const uint8_t MAX_SCAN_RESULTS = 20;
+  
   String savedSSID;
   String savedPassword;
   bool isConnected;
   unsigned long lastScanTime;
-  unsigned long lastConnectAttempt;
+  
+  // Connect state machine (driven by maintain())
+  ConnectState connState;
+  LinkCache link;
+  bool attemptFast;               // Current attempt targets the cached BSSID/channel
+  bool associated;
+  bool pendingCredentials;        // New credentials, saved only once they work
+  String pendingSSID;
+  String pendingPassword;
+  unsigned long stateSince;
+  unsigned long associatedAt;
+  unsigned long sequenceStartedAt;  // Connection lost / connect requested
+  uint32_t backoffMs;
+  uint8_t failures;
+  const char* connectError;
+  
+  // Statistics
+  uint32_t lastConnectMs;         // begin() to IP of the last successful attempt
+  uint32_t lastOutageMs;          // Loss (or request) to IP, including failed attempts
+  uint32_t fastConnects;
+  uint32_t fullConnects;
+  
+  // Background scan and its cached result
+  ScanState scanState;
+  bool scanRetried;
+  unsigned long scanStartedAt;
+  ScanRecord scanResults[MAX_SCAN_RESULTS];
+  uint8_t scanCount;
+  char scanError[96];
   
   static const uint32_t SCAN_CACHE_MS = 30000;  // Cache scan results for 30s
-  static const uint32_t RECONNECT_INTERVAL = 60000;  // Try reconnect every 60s
+  static const uint32_t SCAN_TIMEOUT_MS = 15000;  // Give up on a scan that never finishes
+  
+  /**
+   * @brief Kick off an async scan in the driver
+   */
+  bool beginScan();
+  
+  /**
+   * @brief Copy the driver's scan records, keep the strongest entry per SSID,
+   *        sort strongest first
+   */
+  void collectScan(int found);
+  
+  /**
+   * @brief qsort orders: by SSID with the strongest record first, by RSSI
+   */
+  static int compareBySsid(const void* a, const void* b);
+  static int compareByRssi(const void* a, const void* b);
+  
+  /**
+   * @brief Issue one connect attempt, to the cached BSSID/channel if fast
+   */
+  void startAttempt(bool fast);
+  
+  /**
+   * @brief Fall back from a fast attempt, or back off before the next one
+   */
+  void failAttempt(int status);
+  
+  void onConnected();
+  void saveCredentials();
+  
+  /**
+   * @brief Remember BSSID, channel and lease (NVS write only when they changed)
+   */
+  void updateLinkCache();
   
 public:
   WiFiManager();
@@ -29,28 +134,67 @@ public:
   bool begin();
   
   /**
-   * @brief Scan for available WiFi networks
-   * @param[out] jsonResult JSON array string with network list
-   * @param[out] errorMessage Human readable error when scan fails
-   * @return true if scan produced at least one network
+   * @brief Start a background scan
+   * 
+   * No-op while a scan is running, or while the last results are younger
+   * than SCAN_CACHE_MS (unless force is set). Never blocks.
+   */
+  void startScan(bool force = false);
+  
+  /**
+   * @brief Pick up a finished background scan (cheap, call before reading results)
+   */
+  void pollScan();
+  
+  bool isScanning() const { return scanState == SCAN_RUNNING; }
+  
+  /**
+   * @brief Error of the last scan, nullptr if it succeeded (or none ran yet)
+   */
+  const char* getScanError() const { return scanState == SCAN_FAILED ? scanError : nullptr; }
+  
+  /**
+   * @brief Age of the cached scan results in ms
+   */
+  uint32_t getScanAge() const { return millis() - lastScanTime; }
+  
+  /**
+   * @brief Write the cached networks, strongest first
+   * @param[out] networks Writer positioned at a JSON value; receives the network array
    */
-  bool scanNetworks(String& jsonResult, String& errorMessage);
+  void writeScanResults(JsonWriter& networks) const;
   
   /**
-   * @brief Connect to WiFi network
+   * @brief Start connecting to a WiFi network (returns at once, see maintain())
+   * 
+   * New credentials are saved only after the connection succeeds; if it
+   * fails, getConnectError() tells why and the saved network is kept.
    * @param ssid Network SSID
    * @param password Network password
-   * @param timeoutMs Connection timeout in milliseconds
-   * @return true if connected successfully
    */
-  bool connect(const String& ssid, const String& password, uint32_t timeoutMs = 20000);
+  void connect(const String& ssid, const String& password);
   
   /**
-   * @brief Try to connect using saved credentials
-   * @return true if connected successfully
+   * @brief Start connecting with the saved credentials (returns at once)
+   * @return true if there are saved credentials
    */
   bool connectSaved();
   
+  /**
+   * @brief Whether a connect attempt is in progress or waiting to retry
+   */
+  bool isConnecting() const { return connState == CONN_ASSOCIATING || connState == CONN_BACKOFF; }
+  
+  /**
+   * @brief Why the last attempt failed, nullptr once connected
+   */
+  const char* getConnectError() const { return connectError; }
+  
+  /**
+   * @brief Map a wl_status_t of a failed attempt to a user-facing message
+   */
+  static const char* statusMessage(int status);
+  
   /**
    * @brief Disconnect from WiFi
    */
@@ -65,7 +209,12 @@ public:
   /**
    * @brief Get connected SSID
    */
-  String getSSID() const { return savedSSID; }
+  const String& getSSID() const { return savedSSID; }
+  
+  /**
+   * @brief SSID the station is configured for, read from the WiFi driver (no allocation)
+   */
+  static void getStationSSID(char* buf, size_t size);
   
   /**
    * @brief Get local IP address
@@ -78,7 +227,11 @@ public:
   int getRSSI() const;
   
   /**
-   * @brief Maintain WiFi connection (call in loop)
+   * @brief Advance the connect state machine (call in loop, never blocks)
+   * 
+   * A lost connection is retried right away on the cached BSSID/channel
+   * (WIFI_FAST_CONNECT_MS), then with a full scan, then with exponential
+   * backoff between WIFI_BACKOFF_MIN_MS and WIFI_BACKOFF_MAX_MS.
    */
   void maintain();
   
@@ -86,6 +239,12 @@ public:
    * @brief Clear saved credentials
    */
   void clearCredentials();
+  
+  uint32_t getLastConnectMs() const { return lastConnectMs; }
+  uint32_t getLastOutageMs() const { return lastOutageMs; }
+  uint32_t getFastConnects() const { return fastConnects; }
+  uint32_t getFullConnects() const { return fullConnects; }
+  uint8_t getFailures() const { return failures; }
 };
 
 #endif // WIFI_MANAGER_H
@@ -0,0 +1,199 @@
+#!/usr/bin/env python3
+"""Decode the binary log stream of a LOG_BINARY build.
+
+With LOG_BINARY 1 the firmware does not format its log lines: each record is
+sent as a frame holding the address of the format string and the raw
+arguments (see Logger::sendBinary). This tool looks the format strings up in
+the firmware ELF and prints the lines the device would have printed. Bytes
+outside frames (boot ROM output, panics) are passed through as text.
+
+Frame: A5 5A <len> <ms:u32> <fmt:u32> <module:u8> <level:u8> <args...>
+(little-endian, len counts from ms to the end of the args).
+
+Usage:
+    python3 tools/log_decode.py build/SmartFeeder.ino.elf < capture.bin
+    python3 tools/log_decode.py build/SmartFeeder.ino.elf /dev/ttyUSB0
+    python3 tools/log_decode.py --levels build/SmartFeeder.ino.elf capture.bin
+"""
+
+import argparse
+import re
+import struct
+import sys
+
+SYNC = b"\xa5\x5a"
+FRAME_HEADER = 10
+
+# Logger.h order
+MODULES = ["MAIN", "MODE", "SERVO", "TIME", "SCHED", "WIFI",
+           "WEB", "BACKEND", "PROV", "OTA", "RADIO", "TRACE"]
+LEVELS = ["NONE", "E", "W", "I", "D"]
+
+# Same grammar as parseSpec() in Logger.cpp
+SPEC_RE = re.compile(rb"%([-+ #0]*)(\*|\d+)?(?:\.(\*|\d*))?(hh|h|ll|l|z|j|t|L)?([diuoxXcspfFeEgGaA%])")
+
+# ESP32 / ESP8266 are ILP32: int, long, size_t and pointers are 4 bytes
+INT_SIZES = {None: 4, b"hh": 4, b"h": 4, b"l": 4, b"ll": 8, b"L": 8, b"z": 4, b"j": 8, b"t": 4}
+
+
+class Elf:
+    """Read-only view of the allocated sections of a 32-bit little-endian ELF."""
+
+    def __init__(self, path):
+        with open(path, "rb") as f:
+            self.data = f.read()
+        if self.data[:4] != b"\x7fELF" or self.data[4] != 1 or self.data[5] != 1:
+            raise ValueError("%s: not a 32-bit little-endian ELF" % path)
+        shoff, = struct.unpack_from("<I", self.data, 0x20)
+        shentsize, shnum = struct.unpack_from("<HH", self.data, 0x2E)
+        self.sections = []
+        for i in range(shnum):
+            _, sh_type, flags, addr, offset, size = struct.unpack_from("<IIIIII", self.data, shoff + i * shentsize)
+            # PROGBITS with SHF_ALLOC: .rodata, .flash.rodata, .irom0.text, ...
+            if sh_type == 1 and flags & 0x2 and size:
+                self.sections.append((addr, offset, size))
+        self.cache = {}
+
+    def string(self, addr):
+        if addr in self.cache:
+            return self.cache[addr]
+        for base, offset, size in self.sections:
+            if base <= addr < base + size:
+                start = offset + addr - base
+                end = self.data.find(b"\0", start, offset + size)
+                text = self.data[start:end if end >= 0 else offset + size]
+                self.cache[addr] = text
+                return text
+        return None
+
+
+def format_record(fmt, args):
+    """Rebuild the line like Logger::format(); '...' where arguments were cut."""
+    out = []
+    used = 0
+    pos = 0
+    for m in SPEC_RE.finditer(fmt):
+        out.append(fmt[pos:m.start()].decode("latin-1"))
+        pos = m.end()
+        flags, width, precision, length, conv = m.groups()
+        if conv == b"%":
+            out.append("%")
+            continue
+
+        def take_star():
+            nonlocal used
+            if used + 4 > len(args):
+                raise IndexError
+            value, = struct.unpack_from("<i", args, used)
+            used += 4
+            return str(value)
+
+        try:
+            if width == b"*":
+                width = take_star().encode()
+            if precision == b"*":
+                precision = take_star().encode()
+
+            if conv == b"s":
+                end = args.find(b"\0", used)
+                if end < 0:
+                    raise IndexError
+                value = args[used:end].decode("utf-8", "replace")
+                used = end + 1
+            elif conv in b"fFeEgGaA":
+                if used + 8 > len(args):
+                    raise IndexError
+                value, = struct.unpack_from("<d", args, used)
+                used += 8
+                if conv in b"aA":
+                    conv = b"e" if conv == b"a" else b"E"  # No %a in Python
+            else:
+                size = 4 if conv in b"cp" else INT_SIZES[length]
+                if used + size > len(args):
+                    raise IndexError
+                signed = conv in b"di"
+                value = int.from_bytes(args[used:used + size], "little", signed=signed)
+                used += size
+                if length in (b"h", b"hh") and conv not in b"c":
+                    bits = 16 if length == b"h" else 8
+                    value &= (1 << bits) - 1
+                    if signed and value >= 1 << (bits - 1):
+                        value -= 1 << bits
+                if conv == b"u":
+                    conv = b"d"
+                elif conv == b"p":
+                    flags, conv = b"#", b"x"
+        except IndexError:
+            out.append("...")
+            return "".join(out)
+
+        spec = b"%" + (flags or b"") + (width or b"")
+        if precision is not None:
+            spec += b"." + precision
+        out.append((spec + conv).decode() % value)
+    out.append(fmt[pos:].decode("latin-1"))
+    return "".join(out)
+
+
+def decode(elf, stream, out, show_levels):
+    buf = b""
+    while True:
+        chunk = stream.read1(4096) if hasattr(stream, "read1") else stream.read(4096)
+        if not chunk:
+            break
+        buf += chunk
+        while True:
+            i = buf.find(SYNC)
+            if i < 0:
+                # Keep a trailing A5 that may start the next frame
+                keep = 1 if buf.endswith(SYNC[:1]) else 0
+                out.write(buf[:len(buf) - keep].decode("latin-1"))
+                buf = buf[len(buf) - keep:]
+                break
+            if i:
+                out.write(buf[:i].decode("latin-1"))
+                buf = buf[i:]
+            if len(buf) < 3 or len(buf) < 3 + buf[2]:
+                break  # Frame incomplete, wait for more
+            length = buf[2]
+            if length < FRAME_HEADER:
+                out.write(buf[:1].decode("latin-1"))
+                buf = buf[1:]
+                continue
+            frame = buf[3:3 + length]
+            buf = buf[3 + length:]
+            ms, addr, module, level = struct.unpack_from("<IIBB", frame)
+            fmt = elf.string(addr)
+            if fmt is None:
+                text = "<unknown format 0x%08x>" % addr
+            else:
+                text = format_record(fmt, frame[FRAME_HEADER:])
+            prefix = "[%d] " % ms
+            if show_levels:
+                mod = MODULES[module] if module < len(MODULES) else str(module)
+                lvl = LEVELS[level] if level < len(LEVELS) else str(level)
+                prefix += "%s/%s " % (lvl, mod)
+            out.write(prefix + text + "\r\n")
+        out.flush()
+    out.write(buf.decode("latin-1"))
+    out.flush()
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    parser.add_argument("elf", help="firmware ELF of the running build")
+    parser.add_argument("input", nargs="?", help="capture file or serial device (default: stdin)")
+    parser.add_argument("--levels", action="store_true", help="prefix lines with level/module")
+    args = parser.parse_args()
+
+    elf = Elf(args.elf)
+    stream = open(args.input, "rb", buffering=0) if args.input else sys.stdin.buffer
+    try:
+        decode(elf, stream, sys.stdout, args.levels)
+    except KeyboardInterrupt:
+        pass
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,170 @@
+#!/usr/bin/env python3
+"""Pack the portal pages of WebPortalPages.h into WebPortalPagesGz.h.
+
+Each page is stored gzip-compressed in PROGMEM with a constexpr length and an
+ETag derived from the page content, so WebPortal can serve it with
+Content-Encoding: gzip and answer repeat loads with 304 Not Modified.
+
+A page containing the STATE placeholder is packed as a SplicedPage instead:
+the deflate stream is cut in two around the placeholder (head sync-flushed,
+tail compressed on its own), so the device can stream head and tail straight
+from flash with the page state as a stored block in between. The CRC-32 of
+both halves and the operator to combine them are precomputed; the device
+only checksums the state it inserts.
+
+Run after editing WebPortalPages.h:
+    python3 tools/pack_pages.py
+"""
+
+import gzip
+import hashlib
+import pathlib
+import re
+import sys
+import zlib
+
+ROOT = pathlib.Path(__file__).resolve().parent.parent
+SOURCE = ROOT / "WebPortalPages.h"
+TARGET = ROOT / "WebPortalPagesGz.h"
+
+PLACEHOLDER = "/*STATE*/null"
+CRC_POLY = 0xEDB88320
+
+PAGE_RE = re.compile(r'const char (\w+)_PAGE\[\] PROGMEM = R"rawliteral\((.*?)\)rawliteral";', re.S)
+
+
+def c_array(data, indent="  ", per_line=16):
+    lines = []
+    for i in range(0, len(data), per_line):
+        lines.append(indent + ", ".join("0x%02x" % b for b in data[i:i + per_line]) + ",")
+    return "\n".join(lines)
+
+
+def crc_mult_mod_p(a, b):
+    """a * b modulo the CRC-32 polynomial (zlib's multmodp)."""
+    m = 1 << 31
+    p = 0
+    while True:
+        if a & m:
+            p ^= b
+            if (a & (m - 1)) == 0:
+                return p
+        m >>= 1
+        b = (b >> 1) ^ CRC_POLY if b & 1 else b >> 1
+
+
+def crc_shift(length):
+    """x^(8 * length) mod P: crc32(a + b) == mult(shift(len(b)), crc32(a)) ^ crc32(b)."""
+    p = 1 << 31  # x^0
+    x = 1 << 30  # x^1
+    n = 8 * length
+    while n:
+        if n & 1:
+            p = crc_mult_mod_p(x, p)
+        x = crc_mult_mod_p(x, x)
+        n >>= 1
+    return p
+
+
+def splice(name, html):
+    head, tail = html.split(PLACEHOLDER, 1)
+    head = head.encode("utf-8")
+    tail = tail.encode("utf-8")
+    # Same header gzip.compress() writes for level 9 with mtime 0
+    gz_header = bytes([0x1f, 0x8b, 0x08, 0x00, 0, 0, 0, 0, 0x02, 0x03])
+    c = zlib.compressobj(9, zlib.DEFLATED, -15)
+    packed_head = gz_header + c.compress(head) + c.flush(zlib.Z_SYNC_FLUSH)
+    c = zlib.compressobj(9, zlib.DEFLATED, -15)
+    packed_tail = c.compress(tail) + c.flush(zlib.Z_FINISH)
+
+    out = ["// %s_PAGE: %d bytes -> %d bytes gzip + state"
+           % (name, len(head) + len(tail), len(packed_head) + len(packed_tail))]
+    out.append("const uint8_t %s_PAGE_HEAD[] PROGMEM = {" % name)
+    out.append(c_array(packed_head))
+    out.append("};")
+    out.append("const uint8_t %s_PAGE_TAIL[] PROGMEM = {" % name)
+    out.append(c_array(packed_tail))
+    out.append("};")
+    out.append("const SplicedPage %s_PAGE_SPLICED = {" % name)
+    out.append("  %s_PAGE_HEAD, sizeof(%s_PAGE_HEAD), %s_PAGE_TAIL, sizeof(%s_PAGE_TAIL),"
+               % (name, name, name, name))
+    out.append("  0x%08xUL, 0x%08xUL, 0x%08xUL, %d"
+               % (zlib.crc32(head), zlib.crc32(tail), crc_shift(len(tail)), len(head) + len(tail)))
+    out.append("};")
+    out.append("")
+    return out, len(head) + len(tail), len(packed_head) + len(packed_tail)
+
+
+def main():
+    pages = PAGE_RE.findall(SOURCE.read_text(encoding="utf-8"))
+    if not pages:
+        sys.exit("no pages found in %s" % SOURCE)
+
+    out = [
+        "#ifndef WEB_PORTAL_PAGES_GZ_H",
+        "#define WEB_PORTAL_PAGES_GZ_H",
+        "",
+        "// Generated by tools/pack_pages.py from WebPortalPages.h - do not edit",
+        "",
+        "#include <Arduino.h>",
+        "",
+        "/**",
+        " * @brief Gzip-compressed portal page in PROGMEM",
+        " */",
+        "struct GzipPage {",
+        "  const uint8_t* data;",
+        "  size_t length;        // Compressed size (Content-Length)",
+        "  const char* etag;     // Quoted content hash",
+        "};",
+        "",
+        "/**",
+        " * @brief Gzip page with the page state spliced in at run time",
+        " * ",
+        " * Stream: head, stored deflate block with the state, tail, gzip trailer",
+        " * (CRC-32 and size of the whole text, computed by the device).",
+        " */",
+        "struct SplicedPage {",
+        "  const uint8_t* head;  // gzip header + deflate of the text before the state",
+        "  size_t headLength;",
+        "  const uint8_t* tail;  // Final deflate block(s) of the text after it",
+        "  size_t tailLength;",
+        "  uint32_t headCrc;     // CRC-32 of the text before the state",
+        "  uint32_t tailCrc;     // CRC-32 of the text after it",
+        "  uint32_t tailShift;   // x^(8 * tail text length) mod P, to combine the CRCs",
+        "  uint32_t textLength;  // Page text length without the state",
+        "};",
+        "",
+    ]
+    total_raw = 0
+    total_gz = 0
+    for name, html in pages:
+        if PLACEHOLDER in html:
+            lines, raw_len, gz_len = splice(name, html)
+            out.extend(lines)
+            total_raw += raw_len
+            total_gz += gz_len
+            continue
+
+        raw = html.encode("utf-8")
+        # mtime=0: identical input gives identical bytes (stable diffs)
+        packed = gzip.compress(raw, compresslevel=9, mtime=0)
+        etag = '\\"%s\\"' % hashlib.sha256(raw).hexdigest()[:16]
+        total_raw += len(raw)
+        total_gz += len(packed)
+
+        out.append("// %s_PAGE: %d bytes -> %d bytes gzip" % (name, len(raw), len(packed)))
+        out.append("const uint8_t %s_PAGE_GZ_DATA[] PROGMEM = {" % name)
+        out.append(c_array(packed))
+        out.append("};")
+        out.append("constexpr size_t %s_PAGE_GZ_LEN = %d;" % (name, len(packed)))
+        out.append("const GzipPage %s_PAGE_GZ = { %s_PAGE_GZ_DATA, %s_PAGE_GZ_LEN, \"%s\" };"
+                   % (name, name, name, etag))
+        out.append("")
+
+    out.append("#endif // WEB_PORTAL_PAGES_GZ_H")
+    TARGET.write_text("\n".join(out) + "\n", encoding="utf-8")
+    print("%d pages: %d bytes -> %d bytes (%s)" % (len(pages), total_raw, total_gz, TARGET.name))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,399 @@
+/**
+ * SmartFeeder fleet load simulator
+ *
+ * Runs the real firmware networking and scheduling modules (BackendBridge,
+ * BackendClient, ProvisionManager, OfflineScheduler, TimeManager, ServoController,
+ * FeedTracer) as N virtual feeders with distinct MACs against a config-service instance,
+ * and reports per-endpoint latency, error rates and database load.
+ *
+ * Each worker thread owns a slice of the fleet and runs the devices' loop()
+ * round-robin, the same way each feeder runs its own loop. Time may be
+ * scaled (--time-scale) to compress hours of fleet traffic into minutes.
+ */
+
+#include <Arduino.h>
+#include <HTTPClient.h>
+#include <WiFiClient.h>
+#include "SimRuntime.h"
+
+#include "BackendBridge.h"
+#include "BackendClient.h"
+#include "FeedTracer.h"
+#include "OfflineScheduler.h"
+#include "ProvisionManager.h"
+#include "ServoController.h"
+#include "TimeManager.h"
+
+#include <sys/resource.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace {
+
+struct Options {
+  uint32_t devices = 100;
+  uint32_t threads = 16;
+  uint32_t durationS = 300;
+  double timeScale = 1.0;
+  std::string host = "127.0.0.1";
+  uint16_t port = 8082;
+  std::string token = BACKEND_AUTH_TOKEN;
+  uint32_t bootSpreadS = 60;
+  uint32_t feedsPerDay = 3;
+  uint32_t seed = 1;
+  bool emitSql = false;
+  bool verbose = false;
+};
+
+/**
+ * @brief One feeder: firmware modules wired like SmartFeeder.ino (online mode)
+ */
+class VirtualFeeder {
+public:
+  SimDevice device;
+
+  VirtualFeeder(const std::string& mac, uint64_t bootAtMs, uint32_t seed)
+    : scheduler(&timeManager, &servoController)
+    , bridge(&backendClient, &provisioning, &scheduler, &timeManager, &servoController, &feedTracer)
+    , started(false) {
+
+    device.mac = mac;
+    device.bootAtMs = bootAtMs;
+    device.rng.seed(seed);
+  }
+
+  /**
+   * @brief Power-on: module init as in initializeModules() (device must be bound)
+   */
+  void setup(const Options& opt) {
+    servoController.begin();
+    timeManager.begin();
+    scheduler.begin();
+    bridge.start(String(opt.host), opt.port, String(opt.token), false);
+    started = true;
+  }
+
+  /**
+   * @brief One pass of the online-mode loop()
+   */
+  void loop() {
+    servoController.tick();
+
+    backendClient.setLocalScheduleActive(bridge.isLocalScheduleActive());
+    backendClient.tick();
+
+    bridge.applyBackendClock();
+    bridge.applyProvisioning();
+    bridge.applyBackendSchedule();
+    bridge.handleFeedCommand();
+
+    bool wasIdle = servoController.isIdle();
+    scheduler.tick();
+    bridge.reportScheduledFeed(wasIdle);
+    bridge.reportFeedTrace();
+  }
+
+  bool isStarted() const { return started; }
+  const BackendClient& backend() const { return backendClient; }
+
+private:
+  ServoController servoController;
+  TimeManager timeManager;
+  OfflineScheduler scheduler;
+  ProvisionManager provisioning;
+  BackendClient backendClient;
+  FeedTracer feedTracer;
+  BackendBridge bridge;
+  bool started;
+};
+
+struct DbRouteStats {
+  uint64_t requests = 0;
+  uint64_t queries = 0;
+  double dbMs = 0;
+};
+
+/**
+ * @brief Simulated MAC of device i (locally administered prefix 02:53:46)
+ */
+std::string deviceMac(uint32_t i) {
+  char buf[18];
+  uint32_t n = i + 1;
+  snprintf(buf, sizeof(buf), "02:53:46:%02X:%02X:%02X", (n >> 16) & 0xFF, (n >> 8) & 0xFF, n & 0xFF);
+  return buf;
+}
+
+void usage() {
+  fprintf(stderr,
+    "Usage: fleet-sim [options]\n"
+    "  --devices N       Virtual feeders (default 100)\n"
+    "  --threads W       Worker threads (default 16)\n"
+    "  --duration S      Run time in real seconds (default 300)\n"
+    "  --time-scale X    Device clocks run X times faster than real time (default 1)\n"
+    "  --host H          config-service host (default 127.0.0.1)\n"
+    "  --port P          config-service port (default 8082, docker-compose)\n"
+    "  --token T         Device auth token\n"
+    "  --boot-spread S   Power-on spread in virtual seconds (default 60, 0 = all at once)\n"
+    "  --seed N          Random seed (default 1)\n"
+    "  --emit-sql        Print SQL that registers the fleet in feeder_db and exit\n"
+    "  --feeds-per-day K Feed times per device in --emit-sql (default 3)\n"
+    "  --verbose         Print firmware logs (prefixed with the device MAC) to stderr\n");
+}
+
+bool parseArgs(int argc, char** argv, Options& opt) {
+  for (int i = 1; i < argc; i++) {
+    std::string a = argv[i];
+    auto next = [&](const char*& out) {
+      if (i + 1 >= argc) return false;
+      out = argv[++i];
+      return true;
+    };
+    const char* v = nullptr;
+    if (a == "--emit-sql") opt.emitSql = true;
+    else if (a == "--verbose") opt.verbose = true;
+    else if (a == "--devices" && next(v)) opt.devices = (uint32_t)atol(v);
+    else if (a == "--threads" && next(v)) opt.threads = (uint32_t)atol(v);
+    else if (a == "--duration" && next(v)) opt.durationS = (uint32_t)atol(v);
+    else if (a == "--time-scale" && next(v)) opt.timeScale = atof(v);
+    else if (a == "--host" && next(v)) opt.host = v;
+    else if (a == "--port" && next(v)) opt.port = (uint16_t)atoi(v);
+    else if (a == "--token" && next(v)) opt.token = v;
+    else if (a == "--boot-spread" && next(v)) opt.bootSpreadS = (uint32_t)atol(v);
+    else if (a == "--feeds-per-day" && next(v)) opt.feedsPerDay = (uint32_t)atol(v);
+    else if (a == "--seed" && next(v)) opt.seed = (uint32_t)atol(v);
+    else return false;
+  }
+  if (opt.devices == 0 || opt.devices > 0xFFFFFE || opt.threads == 0 || opt.timeScale <= 0) return false;
+  opt.threads = std::min(opt.threads, opt.devices);
+  opt.feedsPerDay = std::min<uint32_t>(opt.feedsPerDay, MAX_FEED_TIMES);
+  return true;
+}
+
+/**
+ * @brief SQL registering the simulated fleet (devices by MAC, one schedule each)
+ */
+void emitSql(const Options& opt) {
+  std::mt19937 rng(opt.seed);
+  printf("-- SmartFeeder fleet simulator: %u devices\n", opt.devices);
+  printf("INSERT IGNORE INTO users (email, display_name) VALUES ('fleet-sim@localhost', 'Fleet simulator');\n");
+  printf("SET @uid = (SELECT id FROM users WHERE email = 'fleet-sim@localhost');\n");
+  printf("DELETE FROM devices WHERE user_id = @uid;\n");
+  for (uint32_t i = 0; i < opt.devices; i++) {
+    printf("INSERT INTO devices (user_id, name, serial, esp_host, model) VALUES (@uid, 'sim-%06u', '%s', '127.0.0.1', 'esp32');\n",
+           i + 1, deviceMac(i).c_str());
+    if (opt.feedsPerDay == 0) continue;
+    printf("SET @d = LAST_INSERT_ID();\n");
+    printf("INSERT INTO schedules (device_id, name) VALUES (@d, 'Default');\n");
+    printf("SET @s = LAST_INSERT_ID();\n");
+    printf("INSERT INTO schedule_items (schedule_id, time, amount) VALUES ");
+    for (uint32_t k = 0; k < opt.feedsPerDay; k++) {
+      uint32_t minute = rng() % 1440;
+      printf("%s(@s, '%02u:%02u', 50)", k > 0 ? ", " : "", minute / 60, minute % 60);
+    }
+    printf(";\n");
+  }
+}
+
+/**
+ * @brief Read config-service per-route DB counters (GET /stats/db)
+ * @return false if the endpoint is not reachable
+ */
+bool fetchDbStats(const Options& opt, std::map<std::string, DbRouteStats>& out) {
+  WiFiClient client;
+  HTTPClient http;
+  http.setReuse(false);
+  http.setTimeout(5000);
+  std::string url = "http://" + opt.host + ":" + std::to_string(opt.port) + "/stats/db";
+  if (!http.begin(client, String(url))) return false;
+  int code = http.GET();
+  std::string body = http.getString().str();
+  http.end();
+  if (code != 200) return false;
+
+  // {"routes":[{"route":"POST /heartbeat","requests":1,"queries":3,"dbMs":1.2},...]}
+  out.clear();
+  size_t pos = 0;
+  while ((pos = body.find("\"route\":\"", pos)) != std::string::npos) {
+    pos += 9;
+    size_t end = body.find('"', pos);
+    if (end == std::string::npos) break;
+    std::string route = body.substr(pos, end - pos);
+    size_t objEnd = body.find('}', end);
+    std::string obj = body.substr(end, objEnd - end);
+    auto field = [&](const char* key) {
+      size_t k = obj.find(key);
+      return k == std::string::npos ? 0.0 : atof(obj.c_str() + k + strlen(key));
+    };
+    DbRouteStats& st = out[route];
+    st.requests = (uint64_t)field("\"requests\":");
+    st.queries = (uint64_t)field("\"queries\":");
+    st.dbMs = field("\"dbMs\":");
+    pos = end;
+  }
+  return true;
+}
+
+uint32_t percentile(const std::vector<uint32_t>& sorted, double p) {
+  if (sorted.empty()) return 0;
+  size_t idx = (size_t)(p * (sorted.size() - 1) + 0.5);
+  return sorted[std::min(idx, sorted.size() - 1)];
+}
+
+void raiseFileLimit(uint32_t devices) {
+  // One keep-alive socket per device
+  rlimit lim;
+  if (getrlimit(RLIMIT_NOFILE, &lim) != 0) return;
+  rlim_t wanted = (rlim_t)devices + 64;
+  if (lim.rlim_cur >= wanted) return;
+  lim.rlim_cur = std::min(wanted, lim.rlim_max);
+  setrlimit(RLIMIT_NOFILE, &lim);
+  if (lim.rlim_cur < wanted) {
+    fprintf(stderr, "warning: open file limit %lu < %lu, connections will fail\n",
+            (unsigned long)lim.rlim_cur, (unsigned long)wanted);
+  }
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  Options opt;
+  if (!parseArgs(argc, argv, opt)) {
+    usage();
+    return 2;
+  }
+  if (opt.emitSql) {
+    emitSql(opt);
+    return 0;
+  }
+
+  sim::setTimeScale(opt.timeScale);
+  sim::setVerbose(opt.verbose);
+  raiseFileLimit(opt.devices);
+
+  std::map<std::string, DbRouteStats> dbBefore;
+  bool haveDbStats = fetchDbStats(opt, dbBefore);
+  if (!haveDbStats) {
+    fprintf(stderr, "note: %s:%u/stats/db not reachable, DB load not reported\n", opt.host.c_str(), opt.port);
+  }
+
+  // Fleet: power-on times spread uniformly over --boot-spread (virtual time)
+  std::mt19937 rng(opt.seed);
+  uint64_t startMs = sim::virtualNowMs();
+  std::vector<std::unique_ptr<VirtualFeeder>> fleet;
+  fleet.reserve(opt.devices);
+  for (uint32_t i = 0; i < opt.devices; i++) {
+    uint64_t bootAt = startMs + (opt.bootSpreadS > 0 ? rng() % ((uint64_t)opt.bootSpreadS * 1000) : 0);
+    fleet.emplace_back(new VirtualFeeder(deviceMac(i), bootAt, rng()));
+  }
+
+  fprintf(stderr, "fleet-sim: %u devices, %u threads, %us, time scale %.1f, %s:%u\n",
+          opt.devices, opt.threads, opt.durationS, opt.timeScale, opt.host.c_str(), opt.port);
+
+  std::atomic<bool> stop(false);
+  std::vector<std::map<std::string, EndpointStats>> workerStats(opt.threads);
+  std::vector<std::thread> workers;
+  auto realStart = std::chrono::steady_clock::now();
+
+  for (uint32_t w = 0; w < opt.threads; w++) {
+    workers.emplace_back([&, w]() {
+      while (!stop.load(std::memory_order_relaxed)) {
+        uint64_t now = sim::virtualNowMs();
+        for (uint32_t i = w; i < opt.devices && !stop.load(std::memory_order_relaxed); i += opt.threads) {
+          VirtualFeeder& f = *fleet[i];
+          if (now < f.device.bootAtMs) continue;
+          sim::bind(&f.device, &workerStats[w]);
+          if (!f.isStarted()) f.setup(opt);
+          f.loop();
+        }
+        sim::bind(nullptr, nullptr);
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      }
+    });
+  }
+
+  std::this_thread::sleep_for(std::chrono::seconds(opt.durationS));
+  stop = true;
+  for (auto& t : workers) t.join();
+  double elapsedS = std::chrono::duration<double>(std::chrono::steady_clock::now() - realStart).count();
+
+  // Merge worker statistics
+  std::map<std::string, EndpointStats> total;
+  for (auto& ws : workerStats) {
+    for (auto& kv : ws) {
+      EndpointStats& t = total[kv.first];
+      t.requests += kv.second.requests;
+      t.transportErrors += kv.second.transportErrors;
+      t.status2xx += kv.second.status2xx;
+      t.status304 += kv.second.status304;
+      t.status4xx += kv.second.status4xx;
+      t.status5xx += kv.second.status5xx;
+      t.connects += kv.second.connects;
+      t.latencyUs.insert(t.latencyUs.end(), kv.second.latencyUs.begin(), kv.second.latencyUs.end());
+    }
+  }
+
+  printf("\nSmartFeeder fleet simulation: %u devices, %.0f s real (%.0f s device time)\n\n",
+         opt.devices, elapsedS, elapsedS * opt.timeScale);
+  printf("%-26s %9s %8s %7s %7s %6s %6s %6s %6s %9s %9s %9s %9s\n",
+         "endpoint", "requests", "req/s", "err%", "2xx", "304", "4xx", "5xx", "xport",
+         "p50 ms", "p90 ms", "p99 ms", "max ms");
+  uint64_t connects = 0;
+  for (auto& kv : total) {
+    EndpointStats& st = kv.second;
+    connects += st.connects;
+    if (st.requests == 0) continue;
+    std::sort(st.latencyUs.begin(), st.latencyUs.end());
+    uint64_t errors = st.transportErrors + st.status5xx + st.status4xx;
+    printf("%-26s %9llu %8.1f %6.2f%% %7llu %6llu %6llu %6llu %6llu %9.1f %9.1f %9.1f %9.1f\n",
+           kv.first.c_str(), (unsigned long long)st.requests, st.requests / elapsedS,
+           100.0 * errors / st.requests, (unsigned long long)st.status2xx,
+           (unsigned long long)st.status304, (unsigned long long)st.status4xx,
+           (unsigned long long)st.status5xx, (unsigned long long)st.transportErrors,
+           percentile(st.latencyUs, 0.50) / 1000.0, percentile(st.latencyUs, 0.90) / 1000.0,
+           percentile(st.latencyUs, 0.99) / 1000.0, st.latencyUs.back() / 1000.0);
+  }
+
+  // Firmware-side view: what the devices themselves counted
+  uint64_t sent = 0, failed = 0, dropped = 0, overruns = 0, failovers = 0, eventsDropped = 0, heartbeats = 0;
+  uint32_t booted = 0;
+  for (auto& f : fleet) {
+    if (!f->isStarted()) continue;
+    booted++;
+    const BackendClient& b = f->backend();
+    sent += b.getRequestsSent();
+    failed += b.getRequestsFailed();
+    dropped += b.getRequestsDropped();
+    overruns += b.getBudgetOverruns();
+    failovers += b.getFailoverCount();
+    eventsDropped += b.getEventsDropped();
+    heartbeats += b.getHeartbeatCount();
+  }
+  printf("\nDevices booted: %u  connections opened: %llu\n", booted, (unsigned long long)connects);
+  printf("Firmware counters: sent %llu, failed %llu, dropped %llu, budget overruns %llu, "
+         "failovers %llu, heartbeats %llu, events dropped %llu\n",
+         (unsigned long long)sent, (unsigned long long)failed, (unsigned long long)dropped,
+         (unsigned long long)overruns, (unsigned long long)failovers,
+         (unsigned long long)heartbeats, (unsigned long long)eventsDropped);
+
+  std::map<std::string, DbRouteStats> dbAfter;
+  if (haveDbStats && fetchDbStats(opt, dbAfter)) {
+    printf("\n%-34s %9s %9s %10s %10s %10s\n", "route (config-service)", "requests", "queries",
+           "q/request", "db ms", "ms/request");
+    for (auto& kv : dbAfter) {
+      const DbRouteStats& before = dbBefore[kv.first];
+      uint64_t requests = kv.second.requests - before.requests;
+      if (requests == 0 || kv.first.find("/stats/db") != std::string::npos) continue;
+      uint64_t queries = kv.second.queries - before.queries;
+      double dbMs = kv.second.dbMs - before.dbMs;
+      printf("%-34s %9llu %9llu %10.2f %10.0f %10.2f\n", kv.first.c_str(),
+             (unsigned long long)requests, (unsigned long long)queries,
+             (double)queries / requests, dbMs, dbMs / requests);
+    }
+  }
+  return 0;
+}
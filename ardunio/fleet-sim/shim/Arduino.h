@@ -0,0 +1,142 @@
+#ifndef SIM_ARDUINO_H
+#define SIM_ARDUINO_H
+
+// Minimal host implementation of the Arduino-ESP32 core API used by the
+// firmware modules compiled into the fleet simulator
+
+#include <ctype.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <string>
+
+#ifndef ESP32
+  #define ESP32 1
+#endif
+
+#define PROGMEM
+#define F(x) x
+
+using std::max;
+using std::min;
+
+#define constrain(x, lo, hi) ((x) < (lo) ? (lo) : ((x) > (hi) ? (hi) : (x)))
+
+typedef uint8_t byte;
+
+class String {
+public:
+  String() {}
+  String(const char* c) : s(c ? c : "") {}
+  String(const std::string& c) : s(c) {}
+  explicit String(char c) : s(1, c) {}
+  String(int v) : s(std::to_string(v)) {}
+  String(unsigned int v) : s(std::to_string(v)) {}
+  String(long v) : s(std::to_string(v)) {}
+  String(unsigned long v) : s(std::to_string(v)) {}
+  String(long long v) : s(std::to_string(v)) {}
+  String(unsigned long long v) : s(std::to_string(v)) {}
+
+  unsigned int length() const { return (unsigned int)s.size(); }
+  const char* c_str() const { return s.c_str(); }
+  char operator[](unsigned int i) const { return i < s.size() ? s[i] : 0; }
+  char& operator[](unsigned int i) { return s[i]; }
+
+  int indexOf(char c, unsigned int from = 0) const { return pos(s.find(c, from)); }
+  int indexOf(const String& x, unsigned int from = 0) const { return pos(s.find(x.s, from)); }
+  int indexOf(const char* x, unsigned int from = 0) const { return pos(s.find(x, from)); }
+  int lastIndexOf(char c) const { return pos(s.rfind(c)); }
+
+  String substring(unsigned int from) const { return from >= s.size() ? String() : String(s.substr(from)); }
+  String substring(unsigned int from, unsigned int to) const {
+    if (from > to) std::swap(from, to);
+    if (from >= s.size()) return String();
+    return String(s.substr(from, to - from));
+  }
+
+  long toInt() const { return atol(s.c_str()); }
+  void trim() {
+    size_t a = 0;
+    size_t b = s.size();
+    while (a < b && isspace((unsigned char)s[a])) a++;
+    while (b > a && isspace((unsigned char)s[b - 1])) b--;
+    s = s.substr(a, b - a);
+  }
+  bool startsWith(const String& p) const { return s.compare(0, p.s.size(), p.s) == 0; }
+  bool reserve(unsigned int n) { s.reserve(n); return true; }
+
+  String& operator+=(const String& o) { s += o.s; return *this; }
+  String& operator+=(const char* o) { s += o; return *this; }
+  String& operator+=(char o) { s += o; return *this; }
+
+  bool operator==(const String& o) const { return s == o.s; }
+  bool operator==(const char* o) const { return s == o; }
+  bool operator!=(const String& o) const { return s != o.s; }
+  bool operator!=(const char* o) const { return s != o; }
+
+  const std::string& str() const { return s; }
+
+private:
+  std::string s;
+
+  static int pos(size_t p) { return p == std::string::npos ? -1 : (int)p; }
+};
+
+inline String operator+(const String& a, const String& b) { return String(a.str() + b.str()); }
+inline String operator+(const String& a, const char* b) { return String(a.str() + b); }
+inline String operator+(const char* a, const String& b) { return String(std::string(a) + b.str()); }
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void yield();
+long random(long howBig);
+long random(long howSmall, long howBig);
+
+class Print {
+public:
+  virtual ~Print() {}
+  virtual size_t write(uint8_t c) = 0;
+  virtual size_t write(const uint8_t* buffer, size_t size) {
+    size_t n = 0;
+    while (n < size && write(buffer[n])) n++;
+    return n;
+  }
+  virtual void flush() {}
+  size_t print(const char* s) { return write((const uint8_t*)s, strlen(s)); }
+  size_t print(const String& s) { return print(s.c_str()); }
+  size_t println(const char* s) { return print(s) + print("\n"); }
+  size_t println(const String& s) { return println(s.c_str()); }
+};
+
+class Stream : public Print {
+public:
+  virtual int available() = 0;
+  virtual int read() = 0;
+  virtual int peek() = 0;
+  void setTimeout(unsigned long ms) { timeoutMs = ms; }
+
+protected:
+  unsigned long timeoutMs = 1000;
+};
+
+/**
+ * @brief Serial sink: firmware LOG() output, prefixed with the device MAC (--verbose)
+ */
+class HardwareSerial : public Print {
+public:
+  void begin(unsigned long) {}
+  size_t write(uint8_t c) override { return write(&c, 1); }
+  size_t write(const uint8_t* buffer, size_t size) override;
+};
+extern HardwareSerial Serial;
+
+class EspClass {
+public:
+  uint32_t getFreeHeap() { return 180000; }
+};
+extern EspClass ESP;
+
+#endif  // SIM_ARDUINO_H
@@ -0,0 +1,12 @@
+#ifndef SIM_ESP32_SERVO_H
+#define SIM_ESP32_SERVO_H
+
+class Servo {
+public:
+  int attach(int, int = 544, int = 2400) { return 1; }
+  void writeMicroseconds(int) {}
+  void write(int) {}
+  void detach() {}
+};
+
+#endif  // SIM_ESP32_SERVO_H
@@ -0,0 +1,184 @@
+// Minimal HTTP/1.1 client with ESP32 HTTPClient semantics for the fleet simulator
+
+#include "HTTPClient.h"
+#include "SimRuntime.h"
+
+#include <chrono>
+#include <strings.h>
+
+namespace {
+
+uint64_t nowUs() {
+  return (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(
+      std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+uint32_t remainingMs(uint64_t deadlineUs) {
+  uint64_t now = nowUs();
+  return now >= deadlineUs ? 0 : (uint32_t)((deadlineUs - now + 999) / 1000);
+}
+
+}  // namespace
+
+bool HTTPClient::begin(WiFiClient& c, const String& url) {
+  const std::string& u = url.str();
+  size_t scheme = u.find("://");
+  if (scheme == std::string::npos) return false;
+
+  size_t hostStart = scheme + 3;
+  size_t pathStart = u.find('/', hostStart);
+  std::string authority = u.substr(hostStart, pathStart == std::string::npos ? std::string::npos : pathStart - hostStart);
+  path = pathStart == std::string::npos ? "/" : u.substr(pathStart);
+
+  size_t colon = authority.rfind(':');
+  host = authority.substr(0, colon);
+  port = colon == std::string::npos ? 80 : (uint16_t)atoi(authority.c_str() + colon + 1);
+
+  client = &c;
+  requestHeaders.clear();
+  responseHeaders.clear();
+  body.clear();
+  serverClose = false;
+  return true;
+}
+
+void HTTPClient::end() {
+  if (client != nullptr && (!reuseConnection || serverClose)) {
+    client->stop();
+  }
+  requestHeaders.clear();
+}
+
+void HTTPClient::addHeader(const String& name, const String& value) {
+  requestHeaders.emplace_back(name.str(), value.str());
+}
+
+void HTTPClient::collectHeaders(const char* headerKeys[], size_t count) {
+  collect.assign(headerKeys, headerKeys + count);
+}
+
+String HTTPClient::header(const char* name) const {
+  for (const auto& h : responseHeaders) {
+    if (strcasecmp(h.first.c_str(), name) == 0) return String(h.second);
+  }
+  return String();
+}
+
+int HTTPClient::writeToStream(Stream* stream) {
+  if (stream == nullptr) return HTTPC_ERROR_STREAM_WRITE;
+  size_t written = stream->write((const uint8_t*)body.data(), body.size());
+  return written == body.size() ? (int)written : HTTPC_ERROR_STREAM_WRITE;
+}
+
+int HTTPClient::sendRequest(const char* method, const std::string& payload) {
+  uint64_t start = nowUs();
+  body.clear();
+  responseHeaders.clear();
+  serverClose = false;
+
+  // Like the ESP32 core: reuse the open connection, connect otherwise
+  if (client == nullptr || (!client->connected() && !client->connect(host.c_str(), port, timeoutMs))) {
+    sim::recordRequest(path, HTTPC_ERROR_CONNECTION_REFUSED, (uint32_t)(nowUs() - start));
+    return HTTPC_ERROR_CONNECTION_REFUSED;
+  }
+
+  std::string req = std::string(method) + " " + path + " HTTP/1.1\r\n";
+  req += "Host: " + host + ":" + std::to_string(port) + "\r\n";
+  req += "User-Agent: SmartFeeder-FleetSim\r\n";
+  req += reuseConnection ? "Connection: keep-alive\r\n" : "Connection: close\r\n";
+  for (const auto& h : requestHeaders) {
+    req += h.first + ": " + h.second + "\r\n";
+  }
+  if (!payload.empty() || strcmp(method, "POST") == 0) {
+    req += "Content-Length: " + std::to_string(payload.size()) + "\r\n";
+  }
+  req += "\r\n";
+  req += payload;
+
+  int code;
+  if (client->write((const uint8_t*)req.data(), req.size()) != req.size()) {
+    code = HTTPC_ERROR_SEND_HEADER_FAILED;
+  } else {
+    code = readResponse();
+  }
+
+  if (code < 0) client->stop();
+  sim::recordRequest(path, code, (uint32_t)(nowUs() - start));
+  return code;
+}
+
+int HTTPClient::readResponse() {
+  uint64_t deadline = nowUs() + (uint64_t)timeoutMs * 1000;
+  std::string line;
+
+  if (!readLine(line, deadline)) return HTTPC_ERROR_READ_TIMEOUT;
+  int code = 0;
+  if (sscanf(line.c_str(), "HTTP/%*d.%*d %d", &code) != 1) return HTTPC_ERROR_NO_HTTP_SERVER;
+
+  long contentLength = -1;
+  bool chunked = false;
+  while (true) {
+    if (!readLine(line, deadline)) return HTTPC_ERROR_READ_TIMEOUT;
+    if (line.empty()) break;
+    size_t colon = line.find(':');
+    if (colon == std::string::npos) continue;
+    std::string name = line.substr(0, colon);
+    std::string value = line.substr(colon + 1);
+    value.erase(0, value.find_first_not_of(' '));
+
+    if (strcasecmp(name.c_str(), "Content-Length") == 0) contentLength = atol(value.c_str());
+    if (strcasecmp(name.c_str(), "Transfer-Encoding") == 0 && strcasecmp(value.c_str(), "chunked") == 0) chunked = true;
+    if (strcasecmp(name.c_str(), "Connection") == 0 && strcasecmp(value.c_str(), "close") == 0) serverClose = true;
+    for (const auto& key : collect) {
+      if (strcasecmp(key.c_str(), name.c_str()) == 0) responseHeaders.emplace_back(name, value);
+    }
+  }
+
+  if (code == 204 || code == 304) return code;
+
+  if (chunked) {
+    while (true) {
+      if (!readLine(line, deadline)) return HTTPC_ERROR_READ_TIMEOUT;
+      size_t size = strtoul(line.c_str(), nullptr, 16);
+      if (size == 0) {
+        readLine(line, deadline);  // Trailer terminator
+        break;
+      }
+      if (!readExact(size, deadline) || !readLine(line, deadline)) return HTTPC_ERROR_READ_TIMEOUT;
+    }
+  } else if (contentLength > 0) {
+    if (!readExact((size_t)contentLength, deadline)) return HTTPC_ERROR_READ_TIMEOUT;
+  } else if (contentLength < 0) {
+    // No length: body ends when the server closes
+    serverClose = true;
+    uint8_t buf[1024];
+    int n;
+    while ((n = client->readTimeout(buf, sizeof(buf), remainingMs(deadline))) > 0) {
+      body.append((const char*)buf, n);
+    }
+  }
+  return code;
+}
+
+bool HTTPClient::readLine(std::string& line, uint64_t deadlineUs) {
+  line.clear();
+  uint8_t c;
+  while (true) {
+    int n = client->readTimeout(&c, 1, remainingMs(deadlineUs));
+    if (n <= 0) return false;
+    if (c == '\n') break;
+    if (c != '\r') line += (char)c;
+  }
+  return true;
+}
+
+bool HTTPClient::readExact(size_t size, uint64_t deadlineUs) {
+  uint8_t buf[1024];
+  while (size > 0) {
+    int n = client->readTimeout(buf, size < sizeof(buf) ? size : sizeof(buf), remainingMs(deadlineUs));
+    if (n <= 0) return false;
+    body.append((const char*)buf, n);
+    size -= (size_t)n;
+  }
+  return true;
+}
@@ -0,0 +1,64 @@
+#ifndef SIM_HTTP_CLIENT_H
+#define SIM_HTTP_CLIENT_H
+
+#include <Arduino.h>
+#include <utility>
+#include <vector>
+#include "WiFiClient.h"
+
+#define HTTPC_ERROR_CONNECTION_REFUSED  (-1)
+#define HTTPC_ERROR_SEND_HEADER_FAILED  (-2)
+#define HTTPC_ERROR_SEND_PAYLOAD_FAILED (-3)
+#define HTTPC_ERROR_NOT_CONNECTED       (-4)
+#define HTTPC_ERROR_CONNECTION_LOST     (-5)
+#define HTTPC_ERROR_NO_HTTP_SERVER      (-7)
+#define HTTPC_ERROR_STREAM_WRITE        (-10)
+#define HTTPC_ERROR_READ_TIMEOUT        (-11)
+
+#define HTTP_CODE_OK                    200
+#define HTTP_CODE_NOT_MODIFIED          304
+#define HTTP_CODE_UNPROCESSABLE_ENTITY  422
+
+/**
+ * @brief HTTP/1.1 client with the ESP32 HTTPClient interface
+ *
+ * Responses are read completely (Content-Length or chunked) before GET/POST
+ * return; every request is recorded in the simulator statistics.
+ */
+class HTTPClient {
+public:
+  bool begin(WiFiClient& client, const String& url);
+  void end();
+
+  void setReuse(bool reuse) { reuseConnection = reuse; }
+  void setTimeout(uint16_t ms) { timeoutMs = ms; }
+  void addHeader(const String& name, const String& value);
+  void collectHeaders(const char* headerKeys[], size_t count);
+  String header(const char* name) const;
+
+  int GET() { return sendRequest("GET", std::string()); }
+  int POST(const String& payload) { return sendRequest("POST", payload.str()); }
+
+  String getString() const { return String(body); }
+  int writeToStream(Stream* stream);
+
+private:
+  WiFiClient* client = nullptr;
+  std::string host;
+  uint16_t port = 80;
+  std::string path;
+  bool reuseConnection = true;
+  bool serverClose = false;
+  uint16_t timeoutMs = 5000;
+  std::vector<std::pair<std::string, std::string>> requestHeaders;
+  std::vector<std::string> collect;
+  std::vector<std::pair<std::string, std::string>> responseHeaders;
+  std::string body;
+
+  int sendRequest(const char* method, const std::string& payload);
+  int readResponse();
+  bool readLine(std::string& line, uint64_t deadlineUs);
+  bool readExact(size_t size, uint64_t deadlineUs);
+};
+
+#endif  // SIM_HTTP_CLIENT_H
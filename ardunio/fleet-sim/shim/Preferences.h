@@ -0,0 +1,42 @@
+#ifndef SIM_PREFERENCES_H
+#define SIM_PREFERENCES_H
+
+#include <Arduino.h>
+
+/**
+ * @brief NVS of the device bound to the calling thread (in memory)
+ */
+class Preferences {
+public:
+  bool begin(const char* name, bool readOnly = false);
+  void end() {}
+  bool clear();
+  bool remove(const char* key);
+  bool isKey(const char* key) { return getBytesLength(key) > 0; }
+
+  size_t putBool(const char* key, bool v) { return putBytes(key, &v, sizeof(v)); }
+  size_t putUChar(const char* key, uint8_t v) { return putBytes(key, &v, sizeof(v)); }
+  size_t putUShort(const char* key, uint16_t v) { return putBytes(key, &v, sizeof(v)); }
+  size_t putInt(const char* key, int32_t v) { return putBytes(key, &v, sizeof(v)); }
+  size_t putUInt(const char* key, uint32_t v) { return putBytes(key, &v, sizeof(v)); }
+  size_t putBytes(const char* key, const void* value, size_t len);
+
+  bool getBool(const char* key, bool d = false) { return get(key, d); }
+  uint8_t getUChar(const char* key, uint8_t d = 0) { return get(key, d); }
+  uint16_t getUShort(const char* key, uint16_t d = 0) { return get(key, d); }
+  int32_t getInt(const char* key, int32_t d = 0) { return get(key, d); }
+  uint32_t getUInt(const char* key, uint32_t d = 0) { return get(key, d); }
+  size_t getBytesLength(const char* key);
+  size_t getBytes(const char* key, void* buf, size_t maxLen);
+
+private:
+  std::string ns;
+
+  template <typename T>
+  T get(const char* key, T d) {
+    T v;
+    return getBytesLength(key) == sizeof(T) && getBytes(key, &v, sizeof(T)) == sizeof(T) ? v : d;
+  }
+};
+
+#endif  // SIM_PREFERENCES_H
@@ -0,0 +1,200 @@
+// Arduino core, WiFi, NVS and statistics glue of the fleet simulator
+
+#include "SimRuntime.h"
+
+#include <chrono>
+#include <mutex>
+#include <thread>
+
+#include <Arduino.h>
+#include <Preferences.h>
+#include <WiFi.h>
+
+HardwareSerial Serial;
+EspClass ESP;
+WiFiClass WiFi;
+
+namespace {
+
+thread_local SimDevice* boundDevice = nullptr;
+thread_local std::map<std::string, EndpointStats>* boundStats = nullptr;
+
+const std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+double scale = 1.0;
+bool verboseLog = false;
+std::mutex logMutex;
+
+uint64_t realNowUs() {
+  return (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(
+      std::chrono::steady_clock::now() - startTime).count();
+}
+
+bool isHex(char c) {
+  return isxdigit((unsigned char)c) != 0;
+}
+
+// 12 hex digits, optionally separated by ':' or '-'
+bool isMacSegment(const std::string& seg) {
+  std::string hex;
+  for (char c : seg) {
+    if (c == ':' || c == '-') continue;
+    if (!isHex(c)) return false;
+    hex += c;
+  }
+  return hex.size() == 12;
+}
+
+}  // namespace
+
+namespace sim {
+
+void bind(SimDevice* device, std::map<std::string, EndpointStats>* stats) {
+  boundDevice = device;
+  boundStats = stats;
+}
+
+SimDevice* device() {
+  return boundDevice;
+}
+
+uint64_t virtualNowMs() {
+  return (uint64_t)(realNowUs() / 1000.0 * scale);
+}
+
+void setTimeScale(double s) {
+  scale = s > 0 ? s : 1.0;
+}
+
+double timeScale() {
+  return scale;
+}
+
+void setVerbose(bool v) {
+  verboseLog = v;
+}
+
+bool verbose() {
+  return verboseLog;
+}
+
+std::string normalizeEndpoint(const std::string& path) {
+  std::string route = path.substr(0, path.find('?'));
+  std::string out;
+  size_t start = 0;
+  while (start <= route.size()) {
+    size_t end = route.find('/', start);
+    if (end == std::string::npos) end = route.size();
+    std::string seg = route.substr(start, end - start);
+    if (start > 0) out += '/';
+    out += isMacSegment(seg) ? ":mac" : seg;
+    start = end + 1;
+  }
+  return out;
+}
+
+void recordRequest(const std::string& path, int code, uint32_t latencyUs) {
+  if (boundStats == nullptr) return;
+  EndpointStats& st = (*boundStats)[normalizeEndpoint(path)];
+  st.requests++;
+  st.latencyUs.push_back(latencyUs);
+  if (code < 0) st.transportErrors++;
+  else if (code == 304) st.status304++;
+  else if (code >= 500) st.status5xx++;
+  else if (code >= 400) st.status4xx++;
+  else if (code >= 200 && code < 300) st.status2xx++;
+}
+
+void recordConnect(const std::string& host, uint16_t port) {
+  if (boundStats == nullptr) return;
+  (*boundStats)["(connect " + host + ":" + std::to_string(port) + ")"].connects++;
+}
+
+}  // namespace sim
+
+// ---- Arduino core ----
+
+unsigned long millis() {
+  uint64_t now = sim::virtualNowMs();
+  SimDevice* dev = boundDevice;
+  // Each device's clock starts at its own power-on
+  return (unsigned long)(dev != nullptr && now > dev->bootAtMs ? now - dev->bootAtMs : 0);
+}
+
+unsigned long micros() {
+  return millis() * 1000UL;
+}
+
+void delay(unsigned long ms) {
+  std::this_thread::sleep_for(std::chrono::microseconds((uint64_t)(ms * 1000.0 / scale)));
+}
+
+void yield() {
+}
+
+long random(long howBig) {
+  if (howBig <= 0) return 0;
+  SimDevice* dev = boundDevice;
+  if (dev == nullptr) return rand() % howBig;
+  return (long)(dev->rng() % (uint32_t)howBig);
+}
+
+long random(long howSmall, long howBig) {
+  if (howSmall >= howBig) return howSmall;
+  return howSmall + random(howBig - howSmall);
+}
+
+size_t HardwareSerial::write(const uint8_t* buffer, size_t size) {
+  if (!verboseLog) return size;
+  std::lock_guard<std::mutex> lock(logMutex);
+  SimDevice* dev = boundDevice;
+  fprintf(stderr, "%s ", dev != nullptr ? dev->mac.c_str() : "-");
+  fwrite(buffer, 1, size, stderr);
+  return size;
+}
+
+String WiFiClass::macAddress() {
+  SimDevice* dev = boundDevice;
+  return String(dev != nullptr ? dev->mac.c_str() : "00:00:00:00:00:00");
+}
+
+// ---- NVS ----
+
+bool Preferences::begin(const char* name, bool) {
+  ns = name;
+  return boundDevice != nullptr;
+}
+
+bool Preferences::clear() {
+  if (boundDevice == nullptr) return false;
+  auto& nvs = boundDevice->nvs;
+  std::string prefix = ns + "/";
+  for (auto it = nvs.begin(); it != nvs.end();) {
+    it = it->first.compare(0, prefix.size(), prefix) == 0 ? nvs.erase(it) : std::next(it);
+  }
+  return true;
+}
+
+bool Preferences::remove(const char* key) {
+  return boundDevice != nullptr && boundDevice->nvs.erase(ns + "/" + key) > 0;
+}
+
+size_t Preferences::putBytes(const char* key, const void* value, size_t len) {
+  if (boundDevice == nullptr) return 0;
+  const uint8_t* p = (const uint8_t*)value;
+  boundDevice->nvs[ns + "/" + key].assign(p, p + len);
+  return len;
+}
+
+size_t Preferences::getBytesLength(const char* key) {
+  if (boundDevice == nullptr) return 0;
+  auto it = boundDevice->nvs.find(ns + "/" + key);
+  return it == boundDevice->nvs.end() ? 0 : it->second.size();
+}
+
+size_t Preferences::getBytes(const char* key, void* buf, size_t maxLen) {
+  if (boundDevice == nullptr) return 0;
+  auto it = boundDevice->nvs.find(ns + "/" + key);
+  if (it == boundDevice->nvs.end() || it->second.size() > maxLen) return 0;
+  memcpy(buf, it->second.data(), it->second.size());
+  return it->second.size();
+}
@@ -0,0 +1,67 @@
+#ifndef SIM_RUNTIME_H
+#define SIM_RUNTIME_H
+
+#include <stdint.h>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+/**
+ * @brief One virtual feeder as seen by the Arduino shim
+ *
+ * Firmware code reads "its" MAC, clock, random numbers and NVS through the
+ * device bound to the calling thread (sim::bind()).
+ */
+struct SimDevice {
+  std::string mac;
+  uint64_t bootAtMs;                                    // Virtual time of power-on
+  std::map<std::string, std::vector<uint8_t>> nvs;      // "namespace/key" -> value
+  std::mt19937 rng;
+};
+
+/**
+ * @brief Latency and status counters of one normalized endpoint
+ */
+struct EndpointStats {
+  uint64_t requests = 0;
+  uint64_t transportErrors = 0;   // Negative HTTPClient codes
+  uint64_t status2xx = 0;
+  uint64_t status304 = 0;
+  uint64_t status4xx = 0;
+  uint64_t status5xx = 0;
+  uint64_t connects = 0;
+  std::vector<uint32_t> latencyUs;
+};
+
+namespace sim {
+
+/**
+ * @brief Bind a device (and the worker's stats) to the calling thread
+ */
+void bind(SimDevice* device, std::map<std::string, EndpointStats>* stats);
+
+SimDevice* device();
+
+/**
+ * @brief Virtual milliseconds since simulation start (real time * scale)
+ */
+uint64_t virtualNowMs();
+
+void setTimeScale(double scale);
+double timeScale();
+
+void setVerbose(bool verbose);
+bool verbose();
+
+/**
+ * @brief Map a request path to its route ("/api/schedule/AA:BB:.." -> "/api/schedule/:mac")
+ */
+std::string normalizeEndpoint(const std::string& path);
+
+void recordRequest(const std::string& path, int code, uint32_t latencyUs);
+void recordConnect(const std::string& host, uint16_t port);
+
+}  // namespace sim
+
+#endif  // SIM_RUNTIME_H
@@ -0,0 +1,24 @@
+#ifndef SIM_WIFI_H
+#define SIM_WIFI_H
+
+#include <Arduino.h>
+#include "WiFiClient.h"
+
+typedef enum {
+  WL_IDLE_STATUS = 0,
+  WL_CONNECTED = 3,
+  WL_DISCONNECTED = 6
+} wl_status_t;
+
+/**
+ * @brief Station interface of the device bound to the calling thread
+ */
+class WiFiClass {
+public:
+  wl_status_t status() { return WL_CONNECTED; }
+  String macAddress();
+  int32_t RSSI() { return -60; }
+};
+extern WiFiClass WiFi;
+
+#endif  // SIM_WIFI_H
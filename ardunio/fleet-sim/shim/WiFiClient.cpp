@@ -0,0 +1,128 @@
+// Blocking TCP client for the fleet simulator (POSIX sockets)
+
+#include "WiFiClient.h"
+#include "SimRuntime.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+int WiFiClient::connect(const char* remote, uint16_t remotePort, int32_t connectTimeoutMs) {
+  stop();
+
+  addrinfo hints;
+  memset(&hints, 0, sizeof(hints));
+  hints.ai_family = AF_INET;
+  hints.ai_socktype = SOCK_STREAM;
+  addrinfo* res = nullptr;
+  std::string service = std::to_string(remotePort);
+  if (getaddrinfo(remote, service.c_str(), &hints, &res) != 0 || res == nullptr) {
+    return 0;
+  }
+
+  int s = socket(res->ai_family, res->ai_socktype | SOCK_NONBLOCK, res->ai_protocol);
+  if (s < 0) {
+    freeaddrinfo(res);
+    return 0;
+  }
+
+  int rc = ::connect(s, res->ai_addr, res->ai_addrlen);
+  freeaddrinfo(res);
+  if (rc < 0 && errno != EINPROGRESS) {
+    close(s);
+    return 0;
+  }
+  if (rc < 0) {
+    pollfd pfd = { s, POLLOUT, 0 };
+    int err = 0;
+    socklen_t len = sizeof(err);
+    if (poll(&pfd, 1, connectTimeoutMs > 0 ? connectTimeoutMs : 1) <= 0 ||
+        getsockopt(s, SOL_SOCKET, SO_ERROR, &err, &len) < 0 || err != 0) {
+      close(s);
+      return 0;
+    }
+  }
+
+  int one = 1;
+  setsockopt(s, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+  fd = s;
+  host = remote;
+  port = remotePort;
+  sim::recordConnect(host, port);
+  return 1;
+}
+
+uint8_t WiFiClient::connected() {
+  if (fd < 0) return 0;
+
+  // Peer closed an idle keep-alive connection: readable with 0 bytes
+  char c;
+  ssize_t n = recv(fd, &c, 1, MSG_PEEK | MSG_DONTWAIT);
+  if (n == 0 || (n < 0 && errno != EAGAIN && errno != EWOULDBLOCK)) {
+    stop();
+    return 0;
+  }
+  return 1;
+}
+
+void WiFiClient::stop() {
+  if (fd >= 0) {
+    close(fd);
+    fd = -1;
+  }
+}
+
+size_t WiFiClient::write(const uint8_t* buffer, size_t size) {
+  size_t sent = 0;
+  while (fd >= 0 && sent < size) {
+    ssize_t n = send(fd, buffer + sent, size - sent, MSG_NOSIGNAL);
+    if (n > 0) {
+      sent += (size_t)n;
+      continue;
+    }
+    if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+      pollfd pfd = { fd, POLLOUT, 0 };
+      if (poll(&pfd, 1, (int)timeoutMs) > 0) continue;
+    }
+    stop();
+    break;
+  }
+  return sent;
+}
+
+int WiFiClient::available() {
+  if (fd < 0) return 0;
+  char buf[256];
+  ssize_t n = recv(fd, buf, sizeof(buf), MSG_PEEK | MSG_DONTWAIT);
+  return n > 0 ? (int)n : 0;
+}
+
+int WiFiClient::read() {
+  uint8_t c;
+  return readTimeout(&c, 1, 0) == 1 ? c : -1;
+}
+
+int WiFiClient::peek() {
+  if (fd < 0) return -1;
+  uint8_t c;
+  return recv(fd, &c, 1, MSG_PEEK | MSG_DONTWAIT) == 1 ? c : -1;
+}
+
+int WiFiClient::readTimeout(uint8_t* buffer, size_t size, uint32_t waitMs) {
+  if (fd < 0) return -1;
+  pollfd pfd = { fd, POLLIN, 0 };
+  int ready = poll(&pfd, 1, (int)waitMs);
+  if (ready == 0) return 0;
+  if (ready < 0) return -1;
+
+  ssize_t n = recv(fd, buffer, size, MSG_DONTWAIT);
+  if (n > 0) return (int)n;
+  if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) return 0;
+  stop();
+  return -1;
+}
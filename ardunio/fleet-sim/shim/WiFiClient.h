@@ -0,0 +1,42 @@
+#ifndef SIM_WIFI_CLIENT_H
+#define SIM_WIFI_CLIENT_H
+
+#include <Arduino.h>
+
+/**
+ * @brief Blocking TCP client over POSIX sockets
+ */
+class WiFiClient : public Stream {
+public:
+  WiFiClient() {}
+  ~WiFiClient() override { stop(); }
+  WiFiClient(const WiFiClient&) = delete;
+  WiFiClient& operator=(const WiFiClient&) = delete;
+
+  int connect(const char* host, uint16_t port, int32_t timeoutMs);
+  int connect(const char* host, uint16_t port) { return connect(host, port, (int32_t)timeoutMs); }
+  uint8_t connected();
+  void stop();
+
+  size_t write(uint8_t c) override { return write(&c, 1); }
+  size_t write(const uint8_t* buffer, size_t size) override;
+  int available() override;
+  int read() override;
+  int peek() override;
+
+  /**
+   * @brief Read up to size bytes, waiting at most timeoutMs for the first one
+   * @return Bytes read, 0 on timeout, -1 on error or peer close
+   */
+  int readTimeout(uint8_t* buffer, size_t size, uint32_t timeoutMs);
+
+  const std::string& remoteHost() const { return host; }
+  uint16_t remotePort() const { return port; }
+
+private:
+  int fd = -1;
+  std::string host;
+  uint16_t port = 0;
+};
+
+#endif  // SIM_WIFI_CLIENT_H
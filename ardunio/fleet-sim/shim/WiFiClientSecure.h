@@ -0,0 +1,16 @@
+#ifndef SIM_WIFI_CLIENT_SECURE_H
+#define SIM_WIFI_CLIENT_SECURE_H
+
+#include "WiFiClient.h"
+
+// TLS is not simulated: the secure client is a plain TCP client with the
+// configuration calls of the ESP32 core accepted and ignored
+class WiFiClientSecure : public WiFiClient {
+public:
+  void setCACert(const char*) {}
+  void setInsecure() {}
+  void setHandshakeTimeout(unsigned long) {}
+  bool verify(const char*, const char*) { return true; }
+};
+
+#endif  // SIM_WIFI_CLIENT_SECURE_H
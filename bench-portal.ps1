@@ -0,0 +1,104 @@
+# Benchmark the device web portal with concurrent clients
+# Connect this PC to Feeder_AP first (portal at 192.168.1.1)
+# Long runs (e.g. -DurationSec 3600) double as a heap fragmentation soak test
+param(
+    [string]$PortalUrl = "http://192.168.1.1",
+    [int]$Clients = 4,
+    [int]$DurationSec = 20,
+    [string[]]$Paths = @("/api/get-status/", "/api/get-config/", "/api/wifi-status/", "/control")
+)
+
+Add-Type -AssemblyName System.Net.Http
+
+# One client: requests back to back for the whole run, one latency sample per request
+$clientScript = {
+    param($baseUrl, $paths, $durationSec, $clientIndex)
+
+    Add-Type -AssemblyName System.Net.Http
+    $http = New-Object System.Net.Http.HttpClient
+    $http.Timeout = [TimeSpan]::FromSeconds(10)
+
+    $samples = New-Object System.Collections.Generic.List[object]
+    $deadline = [DateTime]::UtcNow.AddSeconds($durationSec)
+    $i = $clientIndex
+    while ([DateTime]::UtcNow -lt $deadline) {
+        $path = $paths[$i % $paths.Count]
+        $i++
+        $sw = [System.Diagnostics.Stopwatch]::StartNew()
+        try {
+            $response = $http.GetAsync($baseUrl + $path).Result
+            $null = $response.Content.ReadAsByteArrayAsync().Result
+            $status = [int]$response.StatusCode
+        } catch {
+            $status = 0
+        }
+        $sw.Stop()
+        $samples.Add([pscustomobject]@{ Path = $path; Status = $status; Ms = $sw.Elapsed.TotalMilliseconds })
+    }
+    $http.Dispose()
+    return $samples
+}
+
+function Get-Heap {
+    try {
+        return (Invoke-RestMethod -Uri "$PortalUrl/api/get-status/" -TimeoutSec 10).heap
+    } catch {
+        Write-Host "✗ Heap snapshot failed: $_"
+        return $null
+    }
+}
+
+function Get-Percentile($sorted, [double]$p) {
+    if ($sorted.Count -eq 0) { return 0 }
+    $idx = [Math]::Min($sorted.Count - 1, [Math]::Floor($p / 100 * $sorted.Count))
+    return $sorted[[int]$idx]
+}
+
+Write-Host "=== Portal benchmark: $Clients clients, $DurationSec s, $PortalUrl ==="
+$heapBefore = Get-Heap
+
+$pool = [RunspaceFactory]::CreateRunspacePool(1, $Clients)
+$pool.Open()
+$runs = @()
+for ($c = 0; $c -lt $Clients; $c++) {
+    $ps = [PowerShell]::Create()
+    $ps.RunspacePool = $pool
+    $null = $ps.AddScript($clientScript).AddArgument($PortalUrl).AddArgument($Paths).AddArgument($DurationSec).AddArgument($c)
+    $runs += [pscustomobject]@{ Shell = $ps; Handle = $ps.BeginInvoke() }
+}
+
+$samples = @()
+foreach ($run in $runs) {
+    $samples += $run.Shell.EndInvoke($run.Handle)
+    $run.Shell.Dispose()
+}
+$pool.Close()
+$heapAfter = Get-Heap
+
+$ok = @($samples | Where-Object { $_.Status -ge 200 -and $_.Status -lt 400 })
+$throttled = @($samples | Where-Object { $_.Status -eq 429 -or $_.Status -eq 503 })
+$failed = @($samples | Where-Object { $_.Status -eq 0 -or ($_.Status -ge 400 -and $_.Status -ne 429 -and $_.Status -ne 503) })
+
+Write-Host ("Requests: {0} total, {1} ok, {2} throttled (429/503), {3} failed" -f $samples.Count, $ok.Count, $throttled.Count, $failed.Count)
+Write-Host ("Throughput: {0:N1} req/s ok" -f ($ok.Count / $DurationSec))
+
+Write-Host "`n--- Latency (ok responses, ms) ---"
+$groups = @($ok | Group-Object Path) + @([pscustomobject]@{ Name = "ALL"; Group = $ok })
+foreach ($g in $groups) {
+    $sorted = @($g.Group | ForEach-Object { $_.Ms } | Sort-Object)
+    Write-Host ("{0,-20} n={1,-6} p50={2,7:N1} p99={3,7:N1} max={4,7:N1}" -f $g.Name, $sorted.Count,
+        (Get-Percentile $sorted 50), (Get-Percentile $sorted 99), (Get-Percentile $sorted 100))
+}
+
+if ($heapBefore -and $heapAfter) {
+    Write-Host "`n--- Heap (bytes) ---"
+    Write-Host ("Free:          {0,8} -> {1,8}" -f $heapBefore.free, $heapAfter.free)
+    Write-Host ("Largest block: {0,8} -> {1,8}" -f $heapBefore.maxBlock, $heapAfter.maxBlock)
+    if ($null -ne $heapAfter.min) {
+        Write-Host ("Min free ever: {0,8}" -f $heapAfter.min)
+    }
+    # Fragmentation: share of free heap not usable as one block
+    $fragBefore = 100 * (1 - $heapBefore.maxBlock / $heapBefore.free)
+    $fragAfter = 100 * (1 - $heapAfter.maxBlock / $heapAfter.free)
+    Write-Host ("Fragmentation: {0,7:N1}% -> {1,7:N1}%" -f $fragBefore, $fragAfter)
+}
@@ -0,0 +1,61 @@
+// Per-route database load: queries and DB time attributed to the HTTP route
+// that issued them (used by the fleet load simulator to size the backend)
+import express from 'express';
+import { AsyncLocalStorage } from 'async_hooks';
+import type { Pool } from 'mysql2/promise';
+
+interface RequestDbUsage {
+  queries: number;
+  dbMs: number;
+}
+
+interface RouteDbStats {
+  requests: number;
+  queries: number;
+  dbMs: number;
+}
+
+const usageContext = new AsyncLocalStorage<RequestDbUsage>();
+const routeStats = new Map<string, RouteDbStats>();
+
+// Count every pool.query issued while a request is being handled
+export function instrumentPool(pool: Pool) {
+  const query = pool.query.bind(pool) as (...args: any[]) => Promise<any>;
+  (pool as any).query = async (...args: any[]) => {
+    const usage = usageContext.getStore();
+    if (!usage) return query(...args);
+    const start = process.hrtime.bigint();
+    try {
+      return await query(...args);
+    } finally {
+      usage.queries++;
+      usage.dbMs += Number(process.hrtime.bigint() - start) / 1e6;
+    }
+  };
+}
+
+export function dbStatsMiddleware(req: express.Request, res: express.Response, next: express.NextFunction) {
+  const usage: RequestDbUsage = { queries: 0, dbMs: 0 };
+  res.on('finish', () => {
+    // Matched route pattern (e.g. /provision/:mac), not the literal URL
+    const route = `${req.method} ${req.route?.path ?? '(unmatched)'}`;
+    const st = routeStats.get(route) ?? { requests: 0, queries: 0, dbMs: 0 };
+    st.requests++;
+    st.queries += usage.queries;
+    st.dbMs += usage.dbMs;
+    routeStats.set(route, st);
+  });
+  usageContext.run(usage, next);
+}
+
+export function registerDbStatsRoutes(app: express.Express) {
+  app.get('/stats/db', (_req: express.Request, res: express.Response) => {
+    const routes = [...routeStats.entries()].map(([route, st]) => ({
+      route,
+      requests: st.requests,
+      queries: st.queries,
+      dbMs: Math.round(st.dbMs * 10) / 10
+    }));
+    res.json({ routes });
+  });
+}
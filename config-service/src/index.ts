@@ -8,6 +8,8 @@ import http from 'http';
 import bcrypt from 'bcrypt';
 import jwt from 'jsonwebtoken';
 import crypto from 'crypto';
+import { registerOtaRoutes } from './ota.js';
+import { dbStatsMiddleware, instrumentPool, registerDbStatsRoutes } from './dbStats.js';
 
 const app = express();
 app.use(cors({
@@ -17,10 +19,11 @@ app.use(cors({
 }));
 // gzip compression for JSON
 app.use(compression());
-// Keep-Alive headers
+// Keep-Alive headers (devices reuse one connection between polls)
+const KEEP_ALIVE_TIMEOUT_MS = +(process.env.KEEP_ALIVE_TIMEOUT_MS || 75_000);
 app.use((req: express.Request, res: express.Response, next: express.NextFunction) => {
   res.setHeader('Connection', 'keep-alive');
-  res.setHeader('Keep-Alive', 'timeout=5, max=1000');
+  res.setHeader('Keep-Alive', `timeout=${Math.floor(KEEP_ALIVE_TIMEOUT_MS / 1000)}, max=1000`);
   next();
 });
 
@@ -37,6 +40,8 @@ const pool = mysql.createPool({
   waitForConnections: true,
   connectionLimit: 10
 });
+instrumentPool(pool);
+app.use(dbStatsMiddleware);
 
 // (moved below after authMiddleware definition)
 
@@ -213,7 +218,8 @@ app.get('/devices/:deviceId/provision', authMiddleware, async (req: express.Requ
               ds.animal_type, ds.has_weight_sensor, ds.portion_default, ds.max_open_ms, ds.scale_factor,
               ds.telemetry_ms, ds.servo_speed, ds.motor_speed, ds.motor_type, ds.stepper_speed,
               ds.servo_open_angle, ds.servo_close_angle, ds.org, ds.site,
-              ds.mqtt_host, ds.mqtt_port, ds.mqtt_group, ds.admin_user
+              ds.mqtt_host, ds.mqtt_port, ds.mqtt_group, ds.admin_user,
+              ds.servo_closed_us, ds.servo_open_us, ds.servo_angle, ds.exclude_days
        FROM devices d
        LEFT JOIN device_settings ds ON ds.device_id = d.id
        WHERE d.id = ?`,
@@ -475,12 +481,13 @@ app.put('/devices/:deviceId/settings', async (req: express.Request, res: express
   const body = req.body || {};
   // upsert
   await pool.query(
-    `INSERT INTO device_settings (device_id, animal_type, has_weight_sensor, portion_default, max_open_ms, scale_factor, telemetry_ms, servo_speed, motor_speed, motor_type, stepper_speed, org, site, mqtt_host, mqtt_port, mqtt_group, admin_user)
-     VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?)
+    `INSERT INTO device_settings (device_id, animal_type, has_weight_sensor, portion_default, max_open_ms, scale_factor, telemetry_ms, servo_speed, motor_speed, motor_type, stepper_speed, org, site, mqtt_host, mqtt_port, mqtt_group, admin_user, servo_closed_us, servo_open_us, servo_angle, exclude_days)
+     VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?)
      ON DUPLICATE KEY UPDATE
        animal_type=VALUES(animal_type), has_weight_sensor=VALUES(has_weight_sensor), portion_default=VALUES(portion_default), max_open_ms=VALUES(max_open_ms),
        scale_factor=VALUES(scale_factor), telemetry_ms=VALUES(telemetry_ms), servo_speed=VALUES(servo_speed), motor_speed=VALUES(motor_speed), motor_type=VALUES(motor_type), stepper_speed=VALUES(stepper_speed),
-       org=VALUES(org), site=VALUES(site), mqtt_host=VALUES(mqtt_host), mqtt_port=VALUES(mqtt_port), mqtt_group=VALUES(mqtt_group), admin_user=VALUES(admin_user)`,
+       org=VALUES(org), site=VALUES(site), mqtt_host=VALUES(mqtt_host), mqtt_port=VALUES(mqtt_port), mqtt_group=VALUES(mqtt_group), admin_user=VALUES(admin_user),
+       servo_closed_us=VALUES(servo_closed_us), servo_open_us=VALUES(servo_open_us), servo_angle=VALUES(servo_angle), exclude_days=VALUES(exclude_days)`,
     [
       deviceId,
       body.animal_type ?? 'dog_medium',
@@ -498,7 +505,11 @@ app.put('/devices/:deviceId/settings', async (req: express.Request, res: express
       body.mqtt_host ?? null,
       body.mqtt_port ?? null,
       body.mqtt_group ?? 0,
-      body.admin_user ?? null
+      body.admin_user ?? null,
+      body.servo_closed_us ?? null,
+      body.servo_open_us ?? null,
+      body.servo_angle ?? null,
+      body.exclude_days ?? null
     ]
   );
   res.json({ ok: true });
@@ -842,6 +853,158 @@ app.get('/devices/:deviceId/security', async (req: express.Request, res: express
 });
 
 // Check feeding schedule by MAC address (for Arduino/ESP devices)
+// Poll rate hints for /feed/check: seconds until the next enabled item (local time)
+// and a suggested poll interval, so devices poll rarely when nothing is due
+const FEED_DUE_WINDOW_SEC = 90;
+const FEED_POLL_FAST_SEC = 5;
+const FEED_POLL_MAX_SEC = 900;
+async function feedPollHints(deviceId: number, local: Date) {
+  const [rows] = await pool.query<RowDataPacket[]>(
+    `SELECT si.time
+     FROM schedule_items si
+     JOIN schedules s ON s.id = si.schedule_id
+     WHERE s.device_id = ? AND s.enabled = 1 AND si.enabled = 1`,
+    [deviceId]
+  );
+  const nowSec = local.getHours() * 3600 + local.getMinutes() * 60 + local.getSeconds();
+  let nextFeedInSec: number | null = null;
+  for (const r of rows as any[]) {
+    const [h, m] = String(r.time).split(':').map(Number);
+    if (isNaN(h) || isNaN(m)) continue;
+    let delta = h * 3600 + m * 60 - nowSec;
+    if (delta < -60) delta += 86400; // already passed today (±1 minute match window)
+    if (delta < 0) delta = 0;
+    if (nextFeedInSec === null || delta < nextFeedInSec) nextFeedInSec = delta;
+  }
+  let pollIntervalSec = FEED_POLL_MAX_SEC;
+  if (nextFeedInSec !== null) {
+    pollIntervalSec = nextFeedInSec <= FEED_DUE_WINDOW_SEC
+      ? FEED_POLL_FAST_SEC
+      : Math.min(FEED_POLL_MAX_SEC, Math.max(60, nextFeedInSec - FEED_DUE_WINDOW_SEC));
+  }
+  return { nextFeedInSec, pollIntervalSec };
+}
+
+// Liveness probe for device circuit breakers: cheap, no DB access
+app.get('/health', (_req: express.Request, res: express.Response) => {
+  res.json({ ok: true });
+});
+
+// Firmware updates (manifest + images under OTA_DIR)
+registerOtaRoutes(app);
+
+// Reported device poll intervals (/feed/check pollMs param, /heartbeat pollMs field),
+// for backend capacity sizing
+const feedPollStats = new Map<string, { pollMs: number; lastSeen: number }>();
+
+app.get('/stats/polling', (_req: express.Request, res: express.Response) => {
+  const cutoff = Date.now() - 30 * 60_000;
+  let devices = 0;
+  let requestsPerMin = 0;
+  for (const [mac, st] of feedPollStats) {
+    if (st.lastSeen < cutoff) { feedPollStats.delete(mac); continue; }
+    devices++;
+    if (st.pollMs > 0) requestsPerMin += 60_000 / st.pollMs;
+  }
+  res.json({ devices, feedCheckRequestsPerMin: Math.round(requestsPerMin * 10) / 10 });
+});
+
+registerDbStatsRoutes(app);
+
+// Feed decision for a device at local time `local` (±1 minute match, cooldown).
+// Records FEED_EXECUTED when feeding is approved, which arms the cooldown.
+async function decideFeed(deviceId: number, mac: string, local: Date) {
+  const localMs = local.getTime();
+  const hh = String(local.getHours()).padStart(2, '0');
+  const mm = String(local.getMinutes()).padStart(2, '0');
+  const currentTime = `${hh}:${mm}`;
+  // also produce ±1 minute neighbors
+  const prevMin = new Date(localMs - 60_000);
+  const nextMin = new Date(localMs + 60_000);
+  const timesToMatch = [
+    currentTime,
+    `${String(prevMin.getHours()).padStart(2, '0')}:${String(prevMin.getMinutes()).padStart(2, '0')}`,
+    `${String(nextMin.getHours()).padStart(2, '0')}:${String(nextMin.getMinutes()).padStart(2, '0')}`
+  ];
+  console.log('[FEED_CHECK] Times to match:', timesToMatch.join(', '));
+
+  // Find active schedules with matching time (±1 minute tolerance)
+  const [sRows] = await pool.query<RowDataPacket[]>(
+    `SELECT si.id, si.time, si.amount, si.duration_ms, s.name as schedule_name
+     FROM schedule_items si
+     JOIN schedules s ON s.id = si.schedule_id
+     WHERE s.device_id = ? AND s.enabled = 1 AND si.enabled = 1 AND si.time IN (?, ?, ?)
+     ORDER BY FIELD(si.time, ?, ?, ?) LIMIT 1`,
+    [deviceId, timesToMatch[0], timesToMatch[1], timesToMatch[2], timesToMatch[0], timesToMatch[1], timesToMatch[2]]
+  );
+
+  if ((sRows as any[]).length === 0) {
+    console.log('[FEED_CHECK] No matching schedule for time:', currentTime);
+    return { shouldFeed: false as const, currentTime, reason: 'no_schedule', message: 'No feeding scheduled for this time' };
+  }
+
+  const schedule = (sRows as any[])[0];
+  console.log('[FEED_CHECK] Schedule found:', schedule.schedule_name, 'Amount:', schedule.amount);
+
+  // Cooldown: prevent multiple feeds in same time window per device
+  const cooldownMinutes = FEED_COOLDOWN_MINUTES;
+  const [coolRows] = await pool.query<RowDataPacket[]>(
+    `SELECT id, created_at
+     FROM device_logs
+     WHERE device_id = ?
+       AND level = 'info'
+       AND message LIKE '%FEED_EXECUTED%'
+       AND created_at >= (NOW() - INTERVAL ? MINUTE)
+     ORDER BY id DESC
+     LIMIT 1`,
+    [deviceId, cooldownMinutes]
+  );
+
+  if ((coolRows as any[]).length > 0) {
+    const last = (coolRows as any[])[0];
+    console.log('[FEED_CHECK] Cooldown active, last feed at:', last.created_at);
+    return { shouldFeed: false as const, currentTime, reason: 'cooldown', message: 'Feed skipped due to cooldown' };
+  }
+
+  // No cooldown hit -> allow feeding and record FEED_EXECUTED log
+  // Also fetch device_settings.max_open_ms as default duration
+  let maxOpenMs = 5000;
+  try {
+    const [setRows] = await pool.query<RowDataPacket[]>(
+      'SELECT max_open_ms FROM device_settings WHERE device_id = ? LIMIT 1',
+      [deviceId]
+    );
+    if ((setRows as any[]).length > 0) {
+      const row = (setRows as any[])[0];
+      if (row.max_open_ms && row.max_open_ms > 0 && row.max_open_ms < 60000) {
+        maxOpenMs = row.max_open_ms;
+      }
+    }
+  } catch (e) {
+    console.error('[FEED_CHECK] Failed to read device_settings.max_open_ms:', e);
+  }
+
+  const durationMs = (schedule as any).duration_ms || maxOpenMs || 5000;
+  try {
+    await pool.query(
+      'INSERT INTO device_logs (device_id, level, message, meta) VALUES (?, \'info\', \'FEED_EXECUTED\', CAST(? AS JSON))',
+      [deviceId, JSON.stringify({ mac, schedule_id: schedule.id, time: currentTime, duration_ms: durationMs })]
+    );
+  } catch (e) {
+    console.error('[FEED_CHECK] Failed to insert FEED_EXECUTED log:', e);
+  }
+
+  return {
+    shouldFeed: true as const,
+    currentTime,
+    scheduleId: schedule.id,
+    scheduleName: schedule.schedule_name,
+    amount: schedule.amount,
+    durationMs,
+    message: 'Feeding time!'
+  };
+}
+
 app.get('/feed/check', async (req: express.Request, res: express.Response) => {
   try {
     const macRaw = (req.query.mac as string) || (req.headers['x-device-mac'] as string) || '';
@@ -851,6 +1014,8 @@ app.get('/feed/check', async (req: express.Request, res: express.Response) => {
     
     const mac = String(macRaw).replace(/:/g, '').toUpperCase();
     console.log('[FEED_CHECK] MAC:', mac);
+    const pollMs = Number((req.query.pollMs as string) || 0) || 0;
+    feedPollStats.set(mac, { pollMs, lastSeen: Date.now() });
     
     // Find device by MAC (serial)
     const [dRows] = await pool.query<RowDataPacket[]>(
@@ -869,127 +1034,366 @@ app.get('/feed/check', async (req: express.Request, res: express.Response) => {
     
     // Get current time with optional timezone offset (minutes)
     const tzOffsetMin = Number((req.query.tzOffsetMin as string) || 0) || 0; // e.g. +180 for UTC+3
-    const nowUtc = new Date();
-    const localMs = nowUtc.getTime() + tzOffsetMin * 60_000;
-    const local = new Date(localMs);
-    const hh = String(local.getHours()).padStart(2, '0');
-    const mm = String(local.getMinutes()).padStart(2, '0');
-    const currentTime = `${hh}:${mm}`;
-    // also produce ±1 minute neighbors
-    const prevMin = new Date(localMs - 60_000);
-    const nextMin = new Date(localMs + 60_000);
-    const timesToMatch = [
-      currentTime,
-      `${String(prevMin.getHours()).padStart(2, '0')}:${String(prevMin.getMinutes()).padStart(2, '0')}`,
-      `${String(nextMin.getHours()).padStart(2, '0')}:${String(nextMin.getMinutes()).padStart(2, '0')}`
-    ];
-    console.log('[FEED_CHECK] Times to match:', timesToMatch.join(', '));
+    const local = new Date(Date.now() + tzOffsetMin * 60_000);
+    const hints = await feedPollHints(deviceId, local);
+    const decision = await decideFeed(deviceId, mac, local);
     
-    // Find active schedules with matching time (±1 minute tolerance)
-    const [sRows] = await pool.query<RowDataPacket[]>(
-      `SELECT si.id, si.time, si.amount, si.duration_ms, s.name as schedule_name
-       FROM schedule_items si
-       JOIN schedules s ON s.id = si.schedule_id
-       WHERE s.device_id = ? AND s.enabled = 1 AND si.enabled = 1 AND si.time IN (?, ?, ?)
-       ORDER BY FIELD(si.time, ?, ?, ?) LIMIT 1`,
-      [deviceId, timesToMatch[0], timesToMatch[1], timesToMatch[2], timesToMatch[0], timesToMatch[1], timesToMatch[2]]
-    );
+    return res.json({
+      mac,
+      deviceId,
+      deviceName: device.name,
+      ...decision,
+      ...hints
+    });
     
-    if ((sRows as any[]).length === 0) {
-      console.log('[FEED_CHECK] No matching schedule for time:', currentTime);
-      return res.json({ 
-        shouldFeed: false, 
-        mac, 
-        deviceId, 
-        deviceName: device.name,
-        currentTime,
-        reason: 'no_schedule',
-        message: 'No feeding scheduled for this time'
-      });
+  } catch (err) {
+    console.error('[FEED_CHECK] Error:', err);
+    return res.status(500).json({ error: 'Internal server error', shouldFeed: false });
+  }
+});
+
+// Enabled schedule items of a device and a short version tag over them
+async function deviceSchedule(deviceId: number) {
+  const [iRows] = await pool.query<RowDataPacket[]>(
+    `SELECT si.time, si.duration_ms
+     FROM schedule_items si
+     JOIN schedules s ON s.id = si.schedule_id
+     WHERE s.device_id = ? AND s.enabled = 1 AND si.enabled = 1
+     ORDER BY si.time`,
+    [deviceId]
+  );
+  const schedule = (iRows as any[]).map((it: any) => ({ feedTime: it.time, durationMs: it.duration_ms ?? null }));
+  const version = crypto.createHash('sha1').update(JSON.stringify(schedule)).digest('hex').slice(0, 8);
+  return { schedule, version };
+}
+
+// Backend endpoints handed to devices ("host:port,host:port"); empty keeps
+// the list compiled into the firmware
+const BACKEND_ENDPOINTS = (process.env.BACKEND_ENDPOINTS || '')
+  .split(',')
+  .map((e) => e.trim())
+  .filter((e) => /^[^,:]+:\d{1,5}$/.test(e));
+
+// Provisioning bundle of a device: settings, schedule, actuator calibration,
+// telemetry rate and backend endpoints in one document. null fields keep the device value.
+// version is a positive 31-bit integer so firmware can compare it as a number.
+async function deviceProvisioning(deviceId: number) {
+  const [sRows] = await pool.query<RowDataPacket[]>(
+    `SELECT max_open_ms, telemetry_ms, servo_closed_us, servo_open_us, servo_angle, exclude_days
+     FROM device_settings WHERE device_id = ? LIMIT 1`,
+    [deviceId]
+  );
+  const st = (sRows as any[])[0] || {};
+  const { schedule, version: scheduleVersion } = await deviceSchedule(deviceId);
+  const bundle = {
+    settings: {
+      openHoldMs: st.max_open_ms ?? null,
+      servoAngle: st.servo_angle ?? null,
+      excludeDays: st.exclude_days ?? null,
+      telemetryMs: st.telemetry_ms ?? null
+    },
+    actuator: {
+      closedUs: st.servo_closed_us ?? null,
+      openUs: st.servo_open_us ?? null
+    },
+    schedule: schedule.map((it) => ({ feedTime: it.feedTime })),
+    ...(BACKEND_ENDPOINTS.length > 0 ? { backends: BACKEND_ENDPOINTS.slice(0, 3) } : {})
+  };
+  const digest = crypto.createHash('sha1').update(JSON.stringify(bundle)).digest();
+  const version = (digest.readUInt32BE(0) & 0x7fffffff) || 1;
+  return { bundle, version, scheduleVersion };
+}
+
+// Feed commands carry a correlation ID from the UI to the closed lid. User
+// commands wait in feed_commands for the device's next heartbeat; the device
+// answers with a FEED_TRACE event holding its stage timestamps.
+const FEED_COMMAND_TTL_SEC = +(process.env.FEED_COMMAND_TTL_SEC || 600);
+
+function newFeedId() {
+  return crypto.randomBytes(8).toString('hex');
+}
+
+// Oldest undelivered user command of a device, marked delivered
+async function takeFeedCommand(deviceId: number) {
+  const [rows] = await pool.query<RowDataPacket[]>(
+    `SELECT id, correlation_id, duration_ms FROM feed_commands
+     WHERE device_id = ? AND delivered_at IS NULL AND created_at >= (NOW(3) - INTERVAL ? SECOND)
+     ORDER BY id LIMIT 1`,
+    [deviceId, FEED_COMMAND_TTL_SEC]
+  );
+  const cmd = (rows as any[])[0];
+  if (!cmd) return null;
+  // Claim with a conditional UPDATE: of two overlapping polls only the one
+  // that flips delivered_at delivers, the other gets it as already taken
+  const [claim] = await pool.query<ResultSetHeader>(
+    'UPDATE feed_commands SET delivered_at = NOW(3) WHERE id = ? AND delivered_at IS NULL',
+    [cmd.id]
+  );
+  if (claim.affectedRows !== 1) return null;
+  return { feedId: cmd.correlation_id as string, durationMs: (cmd.duration_ms as number | null) ?? null };
+}
+
+// Device stage timestamps (FEED_TRACE events) onto their commands
+async function recordFeedTraces(deviceId: number, events: any[]) {
+  for (const e of events) {
+    if (e?.message !== 'FEED_TRACE' || typeof e?.meta?.feedId !== 'string') continue;
+    await pool.query(
+      'UPDATE feed_commands SET trace = CAST(? AS JSON), completed_at = NOW(3) WHERE correlation_id = ? AND device_id = ?',
+      [JSON.stringify(e.meta), e.meta.feedId, deviceId]
+    );
+  }
+}
+
+app.post('/devices/:deviceId/feed', authMiddleware, async (req: express.Request, res: express.Response) => {
+  const userId = (req as any).user.userId;
+  const { deviceId } = req.params as any;
+  const durationMs = Number(req.body?.durationMs) || null;
+  if (durationMs !== null && (durationMs <= 0 || durationMs >= 60000)) {
+    return res.status(400).json({ error: 'durationMs must be between 1 and 59999' });
+  }
+  try {
+    const [owns] = await pool.query<RowDataPacket[]>('SELECT id FROM devices WHERE id = ? AND user_id = ? LIMIT 1', [deviceId, userId]);
+    if ((owns as any[]).length === 0) return res.status(404).json({ error: 'Device not found' });
+    const feedId = newFeedId();
+    await pool.query(
+      'INSERT INTO feed_commands (device_id, correlation_id, source, duration_ms) VALUES (?, ?, \'user\', ?)',
+      [deviceId, feedId, durationMs]
+    );
+    markAttended(Number(deviceId));
+    // Delivered with the next heartbeat; the device poll interval bounds the wait
+    const st = [...deviceStatus.values()].find((d) => d.deviceId === Number(deviceId));
+    return res.status(202).json({ feedId, expectedWithinMs: st?.status?.pollMs ?? null });
+  } catch (err) {
+    console.error('POST /devices/:deviceId/feed error:', err);
+    return res.status(500).json({ error: 'Internal server error' });
+  }
+});
+
+// Fleet-wide feed latency per stage (ms): percentiles and histogram for plotting.
+// queued uses the backend clock only. transfer is the device's receivedAt
+// minus delivered_at: the device clock is corrected from the heartbeat only
+// beyond CLOCK_MAX_DRIFT_S (5 s), so it can be off by that much either way;
+// negative values (device clock behind) are clamped to 0.
+// Device stages are exact millis() offsets from the trace.
+const FEED_LATENCY_BUCKETS_MS = [10, 25, 50, 100, 250, 500, 1000, 2500, 5000, 10000, 30000, 60000, 300000];
+const FEED_STAGES = ['queued', 'transfer', 'dequeue', 'actuatorStart', 'lidOpen', 'lidClosed', 'total'] as const;
+
+app.get('/stats/feed-latency', async (req: express.Request, res: express.Response) => {
+  const hours = Math.min(Math.max(Number(req.query.hours) || 24, 1), 24 * 30);
+  try {
+    const [rows] = await pool.query<RowDataPacket[]>(
+      `SELECT source, created_at, delivered_at, trace FROM feed_commands
+       WHERE created_at >= (NOW() - INTERVAL ? HOUR) AND trace IS NOT NULL`,
+      [hours]
+    );
+    const samples: Record<string, number[]> = Object.fromEntries(FEED_STAGES.map((st) => [st, [] as number[]]));
+    const results: Record<string, number> = {};
+    for (const r of rows as any[]) {
+      const t = typeof r.trace === 'string' ? JSON.parse(r.trace) : r.trace;
+      results[t.result || 'unknown'] = (results[t.result || 'unknown'] || 0) + 1;
+      if (t.result !== 'ok') continue;
+      const created = new Date(r.created_at).getTime();
+      const delivered = r.delivered_at ? new Date(r.delivered_at).getTime() : created;
+      const queued = r.source === 'user' ? delivered - created : 0;
+      const transfer = t.receivedAt ? Math.max(Number(t.receivedAt) - delivered, 0) : null;
+      if (r.source === 'user') samples.queued.push(queued);
+      if (transfer !== null) samples.transfer.push(transfer);
+      samples.dequeue.push(t.dequeueMs);
+      samples.actuatorStart.push(t.startMs - t.dequeueMs);
+      samples.lidOpen.push(t.openMs - t.startMs);
+      samples.lidClosed.push(t.closeMs - t.openMs);
+      samples.total.push(queued + (transfer ?? 0) + t.closeMs);
     }
-    
-    const schedule = (sRows as any[])[0];
-    console.log('[FEED_CHECK] Schedule found:', schedule.schedule_name, 'Amount:', schedule.amount);
-
-    // Cooldown: prevent multiple feeds in same time window per device
-    const cooldownMinutes = FEED_COOLDOWN_MINUTES;
-    const [coolRows] = await pool.query<RowDataPacket[]>(
-      `SELECT id, created_at
-       FROM device_logs
-       WHERE device_id = ?
-         AND level = 'info'
-         AND message LIKE '%FEED_EXECUTED%'
-         AND created_at >= (NOW() - INTERVAL ? MINUTE)
-       ORDER BY id DESC
-       LIMIT 1`,
-      [deviceId, cooldownMinutes]
+
+    const stages = Object.fromEntries(FEED_STAGES.map((st) => {
+      const v = samples[st].filter((x) => Number.isFinite(x)).sort((a, b) => a - b);
+      const pct = (p: number) => (v.length ? v[Math.min(v.length - 1, Math.round(p * (v.length - 1)))] : null);
+      const histogram = FEED_LATENCY_BUCKETS_MS.map((le) => ({ le, count: 0 }));
+      let overflow = 0;
+      for (const x of v) {
+        const b = histogram.find((h) => x <= h.le);
+        if (b) b.count++; else overflow++;
+      }
+      return [st, { count: v.length, p50: pct(0.5), p90: pct(0.9), p99: pct(0.99), max: v.length ? v[v.length - 1] : null, histogram, overflow }];
+    }));
+    res.json({ hours, traces: (rows as any[]).length, results, stages });
+  } catch (err) {
+    console.error('[FEED_LATENCY] error:', err);
+    res.status(500).json({ error: 'Internal server error' });
+  }
+});
+
+// Unified heartbeat: status + buffered events in; feed decision, schedule
+// version, clock and next interval out. Replaces /feed/check, periodic
+// schedule sync and per-event /logs/ingest for current firmware.
+const HEARTBEAT_LOCAL_SEC = 300;
+// While a user has the device open in the UI (status polls, "feed now") its
+// heartbeat is kept short, so a queued command is picked up in seconds
+const HEARTBEAT_ATTENDED_SEC = 5;
+const ATTENDED_MS = 120_000;
+const attendedUntil = new Map<number, number>();
+function markAttended(deviceId: number) {
+  attendedUntil.set(deviceId, Date.now() + ATTENDED_MS);
+}
+function isAttended(deviceId: number) {
+  const until = attendedUntil.get(deviceId);
+  if (until === undefined) return false;
+  if (until < Date.now()) {
+    attendedUntil.delete(deviceId);
+    return false;
+  }
+  return true;
+}
+const deviceStatus = new Map<string, { deviceId: number; status: any; lastSeen: number }>();
+
+app.post('/heartbeat', async (req: express.Request, res: express.Response) => {
+  try {
+    const macRaw = (req.query.mac as string) || (req.headers['x-device-mac'] as string) || '';
+    if (!macRaw) return res.status(400).json({ error: 'mac required' });
+    const mac = String(macRaw).replace(/:/g, '').toUpperCase();
+
+    const [dRows] = await pool.query<RowDataPacket[]>(
+      'SELECT id FROM devices WHERE REPLACE(UPPER(serial), ":", "") = ? AND active = 1 LIMIT 1',
+      [mac]
     );
+    if ((dRows as any[]).length === 0) return res.status(404).json({ error: 'device not found' });
+    const deviceId = (dRows as any[])[0].id as number;
+
+    const body = req.body || {};
+    const pollMs = Number(body.pollMs) || 0;
+    feedPollStats.set(mac, { pollMs, lastSeen: Date.now() });
+    const { events, ...status } = body;
+    deviceStatus.set(mac, { deviceId, status, lastSeen: Date.now() });
 
-    if ((coolRows as any[]).length > 0) {
-      const last = (coolRows as any[])[0];
-      console.log('[FEED_CHECK] Cooldown active, last feed at:', last.created_at);
-      return res.json({
-        shouldFeed: false,
-        mac,
+    // Buffered device events in one insert
+    if (Array.isArray(events) && events.length > 0) {
+      const rows = events.slice(0, 32).map((e: any) => [
         deviceId,
-        deviceName: device.name,
-        currentTime,
-        reason: 'cooldown',
-        message: 'Feed skipped due to cooldown'
-      });
+        String(e?.level || 'info').toLowerCase(),
+        String(e?.message || ''),
+        e?.meta == null ? null : (typeof e.meta === 'string' ? e.meta : JSON.stringify(e.meta))
+      ]).filter((r: any[]) => r[2]);
+      if (rows.length > 0) {
+        await pool.query('INSERT INTO device_logs (device_id, level, message, meta) VALUES ?', [rows]);
+      }
+      await recordFeedTraces(deviceId, events.slice(0, 32));
     }
 
-    // No cooldown hit -> allow feeding and record FEED_EXECUTED log
-    // Also fetch device_settings.max_open_ms as default duration
-    let maxOpenMs = 5000;
-    try {
-      const [setRows] = await pool.query<RowDataPacket[]>(
-        'SELECT max_open_ms FROM device_settings WHERE device_id = ? LIMIT 1',
-        [deviceId]
-      );
-      if ((setRows as any[]).length > 0) {
-        const row = (setRows as any[])[0];
-        if (row.max_open_ms && row.max_open_ms > 0 && row.max_open_ms < 60000) {
-          maxOpenMs = row.max_open_ms;
-        }
+    const { version: configVersion, scheduleVersion } = await deviceProvisioning(deviceId);
+    const response: Record<string, unknown> = {
+      epoch: Math.floor(Date.now() / 1000),
+      scheduleVersion,
+      configVersion
+    };
+
+    if (body.localSchedule === true) {
+      // Device runs the schedule itself: heartbeat only carries changes and telemetry
+      response.pollIntervalSec = HEARTBEAT_LOCAL_SEC;
+    } else {
+      const tzOffsetMin = Number(body.tzOffsetMin) || 0; // Minutes east of UTC, +180 for UTC+3
+      const local = new Date(Date.now() + tzOffsetMin * 60_000);
+      const decision = await decideFeed(deviceId, mac, local);
+      Object.assign(response, await feedPollHints(deviceId, local));
+      if (decision.shouldFeed) {
+        const feedId = newFeedId();
+        await pool.query(
+          'INSERT INTO feed_commands (device_id, correlation_id, source, duration_ms, delivered_at) VALUES (?, ?, \'schedule\', ?, NOW(3))',
+          [deviceId, feedId, decision.durationMs]
+        );
+        response.shouldFeed = true;
+        response.durationMs = decision.durationMs;
+        response.feedId = feedId;
       }
-    } catch (e) {
-      console.error('[FEED_CHECK] Failed to read device_settings.max_open_ms:', e);
     }
 
-    const durationMs = (schedule as any).duration_ms || maxOpenMs || 5000;
-    try {
-      await pool.query(
-        'INSERT INTO device_logs (device_id, level, message, meta) VALUES (?, \'info\', \'FEED_EXECUTED\', CAST(? AS JSON))',
-        [deviceId, JSON.stringify({ mac, schedule_id: schedule.id, time: currentTime, duration_ms: durationMs })]
-      );
-    } catch (e) {
-      console.error('[FEED_CHECK] Failed to insert FEED_EXECUTED log:', e);
+    // Short poll while the UI has the device open; the device lets this
+    // undercut its provisioned telemetry floor
+    if (isAttended(deviceId)) {
+      response.pollIntervalSec = Math.min(Number(response.pollIntervalSec) || HEARTBEAT_ATTENDED_SEC, HEARTBEAT_ATTENDED_SEC);
+      response.attended = 1;
     }
 
-    // Return feeding instruction
-    return res.json({
-      shouldFeed: true,
-      mac,
-      deviceId,
-      deviceName: device.name,
-      currentTime,
-      scheduleId: schedule.id,
-      scheduleName: schedule.schedule_name,
-      amount: schedule.amount,
-      durationMs: durationMs,
-      message: 'Feeding time!'
-    });
-    
+    // User "feed now" waiting for this device (in either schedule mode)
+    if (!response.shouldFeed) {
+      const cmd = await takeFeedCommand(deviceId);
+      if (cmd) {
+        response.shouldFeed = true;
+        if (cmd.durationMs) response.durationMs = cmd.durationMs;
+        response.feedId = cmd.feedId;
+      }
+    }
+    return res.json(response);
   } catch (err) {
-    console.error('[FEED_CHECK] Error:', err);
-    return res.status(500).json({ error: 'Internal server error', shouldFeed: false });
+    console.error('[HEARTBEAT] error:', err);
+    return res.status(500).json({ error: 'Internal server error' });
+  }
+});
+
+// Last reported device status (heartbeat)
+app.get('/devices/:deviceId/status', authMiddleware, (req: express.Request, res: express.Response) => {
+  const deviceId = Number(req.params.deviceId);
+  for (const [mac, st] of deviceStatus) {
+    if (st.deviceId === deviceId) {
+      return res.json({ mac, ...st.status, lastSeen: new Date(st.lastSeen).toISOString() });
+    }
+  }
+  return res.status(404).json({ error: 'no heartbeat yet' });
+});
+
+// Device schedule by MAC (firmware compiles this into its local scheduler)
+app.get('/api/schedule/:mac', async (req: express.Request, res: express.Response) => {
+  try {
+    const mac = String(req.params.mac || '').replace(/:/g, '').toUpperCase();
+    if (!/^[A-F0-9]{12}$/.test(mac)) {
+      return res.status(400).json({ error: 'invalid mac' });
+    }
+    const [dRows] = await pool.query<RowDataPacket[]>(
+      'SELECT id FROM devices WHERE REPLACE(UPPER(serial), ":", "") = ? AND active = 1 LIMIT 1',
+      [mac]
+    );
+    if ((dRows as any[]).length === 0) {
+      return res.status(404).json({ error: 'device not found' });
+    }
+    const deviceId = (dRows as any[])[0].id;
+    const { schedule, version } = await deviceSchedule(deviceId);
+    return res.json({ schedule, version, epoch: Math.floor(Date.now() / 1000) });
+  } catch (err) {
+    console.error('[SCHEDULE_BY_MAC] error:', err);
+    return res.status(500).json({ error: 'Internal server error' });
+  }
+});
+
+// Provisioning bundle by MAC; 304 when the device already has this version
+app.get('/provision/:mac', async (req: express.Request, res: express.Response) => {
+  try {
+    const mac = String(req.params.mac || '').replace(/:/g, '').toUpperCase();
+    if (!/^[A-F0-9]{12}$/.test(mac)) {
+      return res.status(400).json({ error: 'invalid mac' });
+    }
+    const [dRows] = await pool.query<RowDataPacket[]>(
+      'SELECT id FROM devices WHERE REPLACE(UPPER(serial), ":", "") = ? AND active = 1 LIMIT 1',
+      [mac]
+    );
+    if ((dRows as any[]).length === 0) {
+      return res.status(404).json({ error: 'device not found' });
+    }
+    const deviceId = (dRows as any[])[0].id;
+    const { bundle, version } = await deviceProvisioning(deviceId);
+    if (Number(req.query.version) === version) {
+      return res.status(304).end();
+    }
+    return res.json({ version, ...bundle });
+  } catch (err) {
+    console.error('[PROVISION_BY_MAC] error:', err);
+    return res.status(500).json({ error: 'Internal server error' });
   }
 });
 
 // Reverse proxy by device
 app.use('/api/:deviceId', async (req: express.Request, res: express.Response, next: express.NextFunction) => {
   const { deviceId } = req.params as { deviceId: string };
+  // UI status polling: the user is watching this device
+  if (/^\d+$/.test(deviceId)) markAttended(Number(deviceId));
   const [rows] = await pool.query<RowDataPacket[]>('SELECT esp_host, esp_port FROM devices WHERE id = ?', [deviceId]);
   const row = (rows as any[])[0];
   const host = row?.esp_host || process.env.FALLBACK_ESP_HOST || '192.168.1.50';
@@ -1011,6 +1415,10 @@ app.use('/api', async (req: express.Request, res: express.Response, next: expres
 });
 
 const PORT = +(process.env.PORT || 8080);
-app.listen(PORT, () => {
+const server = app.listen(PORT, () => {
   console.log(`Config Service listening on :${PORT}`);
 });
+// Devices keep one connection open between polls (default poll is 60 s);
+// Node's 5 s default would force a new TCP/TLS handshake on every request
+server.keepAliveTimeout = KEEP_ALIVE_TIMEOUT_MS;
+server.headersTimeout = server.keepAliveTimeout + 5_000;
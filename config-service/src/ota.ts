@@ -0,0 +1,69 @@
+// OTA firmware distribution: manifest + image files produced by otaPack.ts
+import express from 'express';
+import fs from 'fs';
+import path from 'path';
+
+export const OTA_DIR = path.resolve(process.env.OTA_DIR || 'ota');
+
+export interface OtaImage {
+  file: string;
+  downloadSize: number;
+}
+
+export interface OtaDelta extends OtaImage {
+  baseSize: number;
+  baseSha256: string;
+}
+
+export interface OtaManifest {
+  version: string;
+  size: number;        // Target image size (bytes)
+  sha256: string;      // SHA-256 of target image (hex)
+  signature: string;   // ECDSA P-256 over target image, DER, base64
+  full: OtaImage;
+  deltas: Record<string, OtaDelta>;  // Keyed by base firmware version
+}
+
+export function readOtaManifest(): OtaManifest | null {
+  try {
+    return JSON.parse(fs.readFileSync(path.join(OTA_DIR, 'manifest.json'), 'utf8')) as OtaManifest;
+  } catch {
+    return null;
+  }
+}
+
+export function registerOtaRoutes(app: express.Express) {
+  // Device asks for an update: 204 when current, otherwise smallest usable image
+  app.get('/ota/manifest', (req: express.Request, res: express.Response) => {
+    const version = String(req.query.version || '');
+    const forceFull = String(req.query.full || '') === '1';
+    const manifest = readOtaManifest();
+    if (!manifest || !version || manifest.version === version) {
+      return res.status(204).end();
+    }
+
+    const delta = forceFull ? undefined : manifest.deltas[version];
+    const image = delta || manifest.full;
+    res.json({
+      version: manifest.version,
+      url: `/ota/files/${encodeURIComponent(image.file)}`,
+      encoding: 'gzip',
+      delta: !!delta,
+      size: manifest.size,
+      sha256: manifest.sha256,
+      signature: manifest.signature,
+      downloadSize: image.downloadSize,
+      ...(delta ? { baseSize: delta.baseSize, baseSha256: delta.baseSha256 } : {})
+    });
+  });
+
+  // Images are content-addressed by version, so they can be cached forever
+  app.get('/ota/files/:name', (req: express.Request, res: express.Response) => {
+    const name = path.basename(req.params.name);
+    res.sendFile(path.join(OTA_DIR, name), {
+      headers: { 'Content-Type': 'application/octet-stream', 'Cache-Control': 'public, max-age=31536000, immutable' }
+    }, (err) => {
+      if (err && !res.headersSent) res.status(404).json({ error: 'not found' });
+    });
+  });
+}
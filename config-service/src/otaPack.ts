@@ -0,0 +1,140 @@
+// Build OTA artifacts for the firmware updater:
+//   npm run ota:pack -- --image fw.bin --version 4.0.1 --key ota-signing.pem \
+//                       [--base old.bin --base-version 4.0.0] [--out ota]
+// Writes <out>/fw-<version>.bin.gz, an optional delta against the base build
+// and manifest.json (deltas against older bases are kept while still useful).
+import crypto from 'crypto';
+import fs from 'fs';
+import path from 'path';
+import zlib from 'zlib';
+import type { OtaManifest } from './ota.js';
+
+const BLOCK = 32;           // Minimum match length / base index granularity
+const MAX_CANDIDATES = 8;   // Base offsets tried per hash bucket
+
+function arg(name: string): string | undefined {
+  const i = process.argv.indexOf(`--${name}`);
+  return i >= 0 ? process.argv[i + 1] : undefined;
+}
+
+function blockHash(buf: Buffer, off: number): number {
+  let h = 2166136261;
+  for (let i = 0; i < BLOCK; i++) {
+    h ^= buf[off + i];
+    h = Math.imul(h, 16777619);
+  }
+  return h >>> 0;
+}
+
+// Greedy copy/insert delta (format parsed by OtaDeltaApplier in OtaUpdater.cpp)
+function makeDelta(base: Buffer, target: Buffer): Buffer {
+  const index = new Map<number, number[]>();
+  for (let off = 0; off + BLOCK <= base.length; off += BLOCK) {
+    const h = blockHash(base, off);
+    const list = index.get(h);
+    if (!list) index.set(h, [off]);
+    else if (list.length < MAX_CANDIDATES) list.push(off);
+  }
+
+  const parts: Buffer[] = [];
+  const header = Buffer.alloc(8);
+  header.write('SFD1', 0, 'ascii');
+  header.writeUInt32LE(target.length, 4);
+  parts.push(header);
+
+  const emitData = (from: number, to: number) => {
+    if (to <= from) return;
+    const op = Buffer.alloc(5);
+    op.write('D', 0, 'ascii');
+    op.writeUInt32LE(to - from, 1);
+    parts.push(op, target.subarray(from, to));
+  };
+  const emitCopy = (src: number, len: number) => {
+    const op = Buffer.alloc(9);
+    op.write('C', 0, 'ascii');
+    op.writeUInt32LE(src, 1);
+    op.writeUInt32LE(len, 5);
+    parts.push(op);
+  };
+
+  let literalStart = 0;
+  let i = 0;
+  while (i + BLOCK <= target.length) {
+    let bestLen = 0;
+    let bestSrc = 0;
+    for (const src of index.get(blockHash(target, i)) || []) {
+      let n = 0;
+      while (i + n < target.length && src + n < base.length && target[i + n] === base[src + n]) n++;
+      if (n > bestLen) { bestLen = n; bestSrc = src; }
+    }
+    if (bestLen < BLOCK) { i++; continue; }
+
+    // Grow the match backwards into the pending literal run
+    let back = 0;
+    while (i - back > literalStart && bestSrc - back > 0 && target[i - back - 1] === base[bestSrc - back - 1]) back++;
+    emitData(literalStart, i - back);
+    emitCopy(bestSrc - back, bestLen + back);
+    i += bestLen;
+    literalStart = i;
+  }
+  emitData(literalStart, target.length);
+  parts.push(Buffer.from('E', 'ascii'));
+  return Buffer.concat(parts);
+}
+
+function main() {
+  const imagePath = arg('image');
+  const version = arg('version');
+  const keyPath = arg('key');
+  const outDir = path.resolve(arg('out') || process.env.OTA_DIR || 'ota');
+  if (!imagePath || !version || !keyPath) {
+    console.error('usage: otaPack --image fw.bin --version X --key key.pem [--base old.bin --base-version Y] [--out dir]');
+    process.exit(1);
+  }
+
+  const image = fs.readFileSync(imagePath);
+  const key = crypto.createPrivateKey(fs.readFileSync(keyPath));
+  fs.mkdirSync(outDir, { recursive: true });
+
+  const fullFile = `fw-${version}.bin.gz`;
+  const fullGz = zlib.gzipSync(image, { level: 9 });
+  fs.writeFileSync(path.join(outDir, fullFile), fullGz);
+
+  // Keep deltas for older bases only if they already target this version
+  let previous: OtaManifest | null = null;
+  try {
+    previous = JSON.parse(fs.readFileSync(path.join(outDir, 'manifest.json'), 'utf8')) as OtaManifest;
+  } catch { /* first release */ }
+
+  const manifest: OtaManifest = {
+    version,
+    size: image.length,
+    sha256: crypto.createHash('sha256').update(image).digest('hex'),
+    signature: crypto.sign('sha256', image, key).toString('base64'),
+    full: { file: fullFile, downloadSize: fullGz.length },
+    deltas: previous && previous.version === version ? previous.deltas : {}
+  };
+
+  const basePath = arg('base');
+  const baseVersion = arg('base-version');
+  if (basePath && baseVersion) {
+    const base = fs.readFileSync(basePath);
+    const deltaFile = `fw-${baseVersion}-${version}.delta.gz`;
+    const deltaGz = zlib.gzipSync(makeDelta(base, image), { level: 9 });
+    if (deltaGz.length < fullGz.length) {
+      fs.writeFileSync(path.join(outDir, deltaFile), deltaGz);
+      manifest.deltas[baseVersion] = {
+        file: deltaFile,
+        downloadSize: deltaGz.length,
+        baseSize: base.length,
+        baseSha256: crypto.createHash('sha256').update(base).digest('hex')
+      };
+    }
+    console.log(`delta ${baseVersion} -> ${version}: ${deltaGz.length} bytes`);
+  }
+
+  fs.writeFileSync(path.join(outDir, 'manifest.json'), JSON.stringify(manifest, null, 2));
+  console.log(`image ${image.length} bytes, gzip ${fullGz.length} bytes -> ${outDir}`);
+}
+
+main();
@@ -84,6 +84,10 @@ CREATE TABLE IF NOT EXISTS device_settings (
   mqtt_port INT NULL,
   mqtt_group TINYINT(1) NOT NULL DEFAULT 0,
   admin_user VARCHAR(64) NULL,
+  servo_closed_us INT NULL,
+  servo_open_us INT NULL,
+  servo_angle INT NULL,
+  exclude_days TINYINT NULL,
   updated_at TIMESTAMP DEFAULT CURRENT_TIMESTAMP ON UPDATE CURRENT_TIMESTAMP,
   CONSTRAINT fk_device_settings_device FOREIGN KEY (device_id) REFERENCES devices(id) ON DELETE CASCADE,
   UNIQUE KEY uq_device_settings_device (device_id)
@@ -108,6 +112,35 @@ DELIMITER ;
 CALL add_cols_device_settings_motor();
 DROP PROCEDURE IF EXISTS add_cols_device_settings_motor;
 
+-- Backfill: provisioning bundle columns (actuator calibration, angle, excluded days)
+DELIMITER //
+CREATE PROCEDURE IF NOT EXISTS add_cols_device_settings_provision()
+BEGIN
+  IF NOT EXISTS (
+    SELECT 1 FROM INFORMATION_SCHEMA.COLUMNS WHERE TABLE_SCHEMA = DATABASE() AND TABLE_NAME = 'device_settings' AND COLUMN_NAME = 'servo_closed_us'
+  ) THEN
+    ALTER TABLE device_settings ADD COLUMN servo_closed_us INT NULL AFTER admin_user;
+  END IF;
+  IF NOT EXISTS (
+    SELECT 1 FROM INFORMATION_SCHEMA.COLUMNS WHERE TABLE_SCHEMA = DATABASE() AND TABLE_NAME = 'device_settings' AND COLUMN_NAME = 'servo_open_us'
+  ) THEN
+    ALTER TABLE device_settings ADD COLUMN servo_open_us INT NULL AFTER servo_closed_us;
+  END IF;
+  IF NOT EXISTS (
+    SELECT 1 FROM INFORMATION_SCHEMA.COLUMNS WHERE TABLE_SCHEMA = DATABASE() AND TABLE_NAME = 'device_settings' AND COLUMN_NAME = 'servo_angle'
+  ) THEN
+    ALTER TABLE device_settings ADD COLUMN servo_angle INT NULL AFTER servo_open_us;
+  END IF;
+  IF NOT EXISTS (
+    SELECT 1 FROM INFORMATION_SCHEMA.COLUMNS WHERE TABLE_SCHEMA = DATABASE() AND TABLE_NAME = 'device_settings' AND COLUMN_NAME = 'exclude_days'
+  ) THEN
+    ALTER TABLE device_settings ADD COLUMN exclude_days TINYINT NULL AFTER servo_angle;
+  END IF;
+END //
+DELIMITER ;
+CALL add_cols_device_settings_provision();
+DROP PROCEDURE IF EXISTS add_cols_device_settings_provision;
+
 CREATE TABLE IF NOT EXISTS schedules (
   id INT AUTO_INCREMENT PRIMARY KEY,
   device_id INT NOT NULL,
@@ -191,6 +224,24 @@ CREATE TABLE IF NOT EXISTS device_logs (
   INDEX idx_device_logs_created (created_at)
 );
 
+-- Feed commands with correlation IDs: user "feed now" queued for the next
+-- heartbeat and backend schedule decisions; trace = device stage timestamps
+CREATE TABLE IF NOT EXISTS feed_commands (
+  id INT AUTO_INCREMENT PRIMARY KEY,
+  device_id INT NOT NULL,
+  correlation_id CHAR(16) NOT NULL,
+  source VARCHAR(16) NOT NULL DEFAULT 'user',
+  duration_ms INT NULL,
+  created_at TIMESTAMP(3) NOT NULL DEFAULT CURRENT_TIMESTAMP(3),
+  delivered_at TIMESTAMP(3) NULL,
+  completed_at TIMESTAMP(3) NULL,
+  trace JSON NULL,
+  CONSTRAINT fk_feed_commands_device FOREIGN KEY (device_id) REFERENCES devices(id) ON DELETE CASCADE,
+  UNIQUE KEY uq_feed_commands_correlation (correlation_id),
+  INDEX idx_feed_commands_pending (device_id, delivered_at),
+  INDEX idx_feed_commands_created (created_at)
+);
+
 INSERT INTO users (email, password_hash, display_name)
 SELECT 'demo@example.com', '$2b$10$N9qo8uLOickgx2ZMRZoMyeIjZAgcfl7p92ldGxad68LJZdL17lhWy', 'Demo User'
 WHERE NOT EXISTS (SELECT 1 FROM users);
@@ -60,6 +60,7 @@ export default function FeederUI({ token, user, onLogout }: FeederUIProps) {
   const [deviceCodeTab, setDeviceCodeTab] = useState<'esp8266' | 'raspberry'>('esp8266');
   const [logs, setLogs] = useState<any[]>([]);
   const [logsLoading, setLogsLoading] = useState(false);
+  const [feedLatency, setFeedLatency] = useState<any>(null);
   const [logLevel, setLogLevel] = useState('');
   const [logQuery, setLogQuery] = useState('');
   const [logSinceMinutes, setLogSinceMinutes] = useState(1440);
@@ -258,6 +259,16 @@ export default function FeederUI({ token, user, onLogout }: FeederUIProps) {
     };
   }, [activeTab, selectedDeviceId, logLevel, logQuery, logSinceMinutes, logsTick]);
 
+  // Fleet feed latency per stage (FEED_TRACE correlation data)
+  useEffect(() => {
+    if (activeTab !== 'logs') return;
+    const hours = Math.max(1, Math.round(logSinceMinutes / 60));
+    fetch(`/stats/feed-latency?hours=${hours}`, { cache: 'no-store' })
+      .then((res) => (res.ok ? res.json() : null))
+      .then((data) => setFeedLatency(data))
+      .catch(() => setFeedLatency(null));
+  }, [activeTab, logSinceMinutes, logsTick]);
+
   // Fetch settings and start status polling when device or tab changes
   useEffect(() => {
     if (!selectedDeviceId) {
@@ -394,8 +405,17 @@ export default function FeederUI({ token, user, onLogout }: FeederUIProps) {
 
   const handleFeed = async () => {
     try {
-      const url = selectedDeviceId ? `/api/${selectedDeviceId}/feed` : '/api/feed';
-      await fetch(url, { method: 'POST' });
+      if (selectedDeviceId) {
+        // Queued for the device's next heartbeat, traced end to end by its feedId;
+        // while the device is open here the backend keeps that heartbeat at 5 s
+        await fetch(`/devices/${selectedDeviceId}/feed`, {
+          method: 'POST',
+          headers: { 'Content-Type': 'application/json', 'Authorization': `Bearer ${token}` },
+          body: JSON.stringify({})
+        });
+      } else {
+        await fetch('/api/feed', { method: 'POST' });
+      }
       setTimeout(fetchStatus, 500);
     } catch (err) {
       if (demoMode) {
@@ -856,6 +876,40 @@ export default function FeederUI({ token, user, onLogout }: FeederUIProps) {
                 </>
               )}
             </div>
+
+            <div className="bg-gradient-to-br from-slate-800/80 to-slate-700/80 backdrop-blur-sm rounded-xl p-6 border border-slate-600">
+              <h3 className="text-white text-xl font-semibold mb-4 flex items-center gap-2">
+                <Timer className="w-5 h-5 text-blue-400" />
+                Besleme Gecikmesi (tüm cihazlar)
+              </h3>
+              {!feedLatency || feedLatency.traces === 0 ? (
+                <div className="text-slate-400 text-sm">Bu zaman aralığında izlenen besleme komutu yok</div>
+              ) : (
+                <div className="space-y-4">
+                  <div className="text-slate-300 text-sm">
+                    {feedLatency.traces} komut · {Object.entries(feedLatency.results).map(([k, v]) => `${k}: ${v}`).join(' · ')}
+                  </div>
+                  {Object.entries(feedLatency.stages).map(([stage, st]: [string, any]) => {
+                    if (st.count === 0) return null;
+                    const peak = Math.max(1, ...st.histogram.map((h: any) => h.count), st.overflow);
+                    return (
+                      <div key={stage}>
+                        <div className="flex justify-between text-sm text-slate-200 mb-1">
+                          <span className="font-medium">{stage}</span>
+                          <span className="font-mono text-xs text-slate-300">n={st.count} · p50 {st.p50} ms · p90 {st.p90} ms · p99 {st.p99} ms · max {st.max} ms</span>
+                        </div>
+                        <div className="flex items-end gap-1 h-12">
+                          {[...st.histogram, { le: Infinity, count: st.overflow }].map((h: any) => (
+                            <div key={String(h.le)} className="flex-1 bg-blue-500/70 rounded-t" style={{ height: `${(h.count / peak) * 100}%` }}
+                              title={`≤ ${h.le === Infinity ? '∞' : h.le} ms: ${h.count}`} />
+                          ))}
+                        </div>
+                      </div>
+                    );
+                  })}
+                </div>
+              )}
+            </div>
           </div>
         )}
 
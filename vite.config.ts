@@ -21,6 +21,10 @@ export default defineConfig({
       '/auth': {
         target: CONFIG_API,
         changeOrigin: true
+      },
+      '/stats': {
+        target: CONFIG_API,
+        changeOrigin: true
       }
     }
   },